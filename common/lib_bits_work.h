@@ -5,18 +5,87 @@
 ///                                                                             
 ///@par     Classification:  UNCLASSIFIED, OPEN SOURCE                          
 ///                                                                             
+///@version 2026-10-16  DHF     Added Simd, getUnsignedColumn and               
+///                             getSignedColumn.                                
+///                                                                             
+///@version 2026-10-16  DHF     Added loadBigEndian64, extractUnsigned and the  
+///                             compile time width getUnsigned/getSigned.       
+///                                                                             
 ///@version 2020-09-01  DHF     File creation.                                  
 //------------------------------------------------------------------------------
+#ifndef LIB_BITS_WORK_H_FILE_GUARD
+#define LIB_BITS_WORK_H_FILE_GUARD
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <vector>
 
+#ifdef _MSC_VER
+#include <stdlib.h>
+#endif
+
 #include "debug.h"
 
 namespace lib {
 namespace bits {
 namespace work {
 
+//------------------------------------------------------------------------------
+///@brief   Return the 8 bytes at memory (any alignment) as a big endian word.  
+//------------------------------------------------------------------------------
+inline uint64_t loadBigEndian64(void const* memory)
+{
+    uint64_t word;
+    memcpy(&word, memory, sizeof(word));
+
+    #if defined(_MSC_VER)
+    word = _byteswap_uint64(word);
+    #elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    word = __builtin_bswap64(word);
+    #endif
+
+    return word;
+}
+
+//------------------------------------------------------------------------------
+///@brief   Return the bit_count (1 - 64) bits starting at bit shift (0 - 7) of 
+///         the byte at memory.                                                 
+///                                                                             
+///@par Design                                                                  
+///         The bytes holding the field are loaded as one big endian word, so   
+///         the field is taken out with one shift and one mask rather than a    
+///         bit at a time.  Only the bytes that hold the field are read:  a     
+///         field that does not end on a word boundary is read a byte at a      
+///         time into the word, and a field that spans 9 bytes (e.g., 64 bits   
+///         starting part way into a byte) takes its last bits from the ninth.  
+//------------------------------------------------------------------------------
+inline uint64_t extractUnsigned(
+    uint8_t const*  memory
+  , unsigned        shift
+  , unsigned        bit_count
+)
+{
+    const unsigned span(shift + bit_count);
+    uint64_t word;
+
+    if (span >= 64) {
+        word = loadBigEndian64(memory) << shift;
+        if (span > 64) {
+            word |= memory[8] >> (8 - shift);
+        }
+    } else {
+        const unsigned bytes((span + 7) / 8);
+        word = 0;
+        for (unsigned b = 0; b < bytes; ++b) {
+            word = (word << 8) | memory[b];
+        }
+        word <<= 64 - 8 * bytes + shift;
+    }
+
+    return word >> (64 - bit_count);
+}
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 bool isBitSet(const void* memory, uint64_t bit_number);
@@ -116,6 +185,91 @@ bool getSigned(
     return answer;
 }
 
+//------------------------------------------------------------------------------
+///@brief   getUnsigned for a field whose width is known at compile time (the   
+///         shift and mask become constants).                                   
+///@tparam  BIT_COUNT   The number of bits to retrieve (1 - 64).                
+//------------------------------------------------------------------------------
+template <unsigned BIT_COUNT>
+bool getUnsigned(
+    uint64_t&   result
+  , void const* memory
+  , uint64_t    bit_offset
+)
+{
+    static_assert(
+        BIT_COUNT >= 1 && BIT_COUNT <= 64
+      , "lib::bits::work::getUnsigned:  BIT_COUNT must be 1 - 64"
+    );
+
+    result = extractUnsigned(
+        static_cast<uint8_t const*>(memory) + bit_offset / 8
+      , unsigned(bit_offset % 8)
+      , BIT_COUNT
+    );
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+///@brief   getSigned for a field whose width is known at compile time.         
+///@tparam  BIT_COUNT   The number of bits to retrieve (1 - 64).                
+//------------------------------------------------------------------------------
+template <unsigned BIT_COUNT>
+bool getSigned(
+    int64_t&    result
+  , void const* memory
+  , uint64_t    bit_offset
+)
+{
+    uint64_t u;
+    getUnsigned<BIT_COUNT>(u, memory, bit_offset);
+
+    //--------------------------------------------------------------------------
+    //  Move the sign bit to the top and shift back (arithmetic shift) to       
+    //  extend it.                                                              
+    //--------------------------------------------------------------------------
+    result = int64_t(u << (64 - BIT_COUNT)) >> (64 - BIT_COUNT);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+///@brief   The instruction sets the column functions can use.                  
+//------------------------------------------------------------------------------
+enum class Simd
+{
+    portable        ///< Plain C++; a frame at a time.
+  , sse2            ///< x86-64 SSE2; two frames at a time.
+  , avx2            ///< x86-64 AVX2; four frames at a time.
+};
+
+Simd bestSimd();
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void getUnsignedColumn(
+    uint64_t*   column
+  , void const* frames
+  , size_t      frame_count
+  , size_t      frame_size
+  , uint64_t    bit_offset
+  , uint64_t    bit_count
+  , Simd        simd = bestSimd()
+);
+
+void getSignedColumn(
+    int64_t*    column
+  , void const* frames
+  , size_t      frame_count
+  , size_t      frame_size
+  , uint64_t    bit_offset
+  , uint64_t    bit_count
+  , Simd        simd = bestSimd()
+);
+
 } // namespace work
 } // namespace bits
 } // namespace lib
+
+#endif // #ifndef LIB_BITS_WORK_H_FILE_GUARD
@@ -10,12 +10,37 @@
 #include "dev_test_work.h"
 #include "lib_config_work_filepaths.h"
 #include "lib_bits_work.h"
+#include "lib_string.h"
+
+#include <chrono>
 
 namespace lib {
 namespace eu {
 namespace work {
 namespace test {
 
+//------------------------------------------------------------------------------
+//  The bit at a time getUnsigned that the word at a time one replaced; kept    
+//  as the reference to check against (and to measure against).                 
+//------------------------------------------------------------------------------
+static uint64_t bitwiseUnsigned(
+    void const* memory
+  , uint64_t    bit_offset
+  , uint64_t    bit_count
+)
+{
+    uint64_t result(0);
+    for (uint64_t bit = 0; bit < bit_count; ++bit)
+    {
+        result = (result << 1);
+        if (lib::bits::work::isBitSet(memory, bit_offset + bit))
+        {
+            result |= 1;
+        }
+    }
+    return result;
+}
+
 //------------------------------------------------------------------------------
 //  Register the test class for the dev_test_classes.                           
 //------------------------------------------------------------------------------
@@ -66,8 +91,115 @@ void Test::runTest()
     isBitSet();
     getUnsigned();
     getSigned();
+    everyOffset();
+    fixedWidth();
+    column();
 } 
 
+//------------------------------------------------------------------------------
+///@brief   Measure the word at a time getUnsigned against a bit at a time one. 
+//------------------------------------------------------------------------------
+void Test::runTest3()
+{
+    std::vector<uint8_t> data(4096);
+    for (size_t d = 0; d < data.size(); ++d) data[d] = uint8_t(d * 37 + 11);
+
+    const uint64_t bits((data.size() - 9) * 8);
+    const int count(10000000);
+
+    for (uint64_t width = 8; width <= 64; width *= 2) {
+        uint64_t sum(0);
+        uint64_t u;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i) {
+            sum += bitwiseUnsigned(&data[0], (i * 13) % bits, width);
+        }
+        std::chrono::duration<double, std::nano> bitwise(
+            std::chrono::steady_clock::now() - start
+        );
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i) {
+            lib::bits::work::getUnsigned(u, &data[0], (i * 13) % bits, width);
+            sum -= u;
+        }
+        std::chrono::duration<double, std::nano> word(
+            std::chrono::steady_clock::now() - start
+        );
+
+        TEST(sum == 0);
+        output(
+            vSummary
+          , lib::format(
+                "%2d bits:  bit at a time %6.2lf ns; word at a time %6.2lf ns"
+              , int(width)
+              , bitwise.count() / count
+              , word.count() / count
+            )
+        );
+    }
+
+    //--------------------------------------------------------------------------
+    //  A 12-bit field from each of a million 16 byte frames.                   
+    //--------------------------------------------------------------------------
+    const size_t frames(1000000);
+    const size_t frame_size(16);
+    std::vector<uint8_t> memory(frames * frame_size);
+    for (size_t m = 0; m < memory.size(); ++m) memory[m] = uint8_t(m * 7);
+    std::vector<uint64_t> column(frames);
+
+    const lib::bits::work::Simd simds[] = {
+        lib::bits::work::Simd::portable
+      , lib::bits::work::Simd::sse2
+      , lib::bits::work::Simd::avx2
+    };
+    const char* names[] = { "portable", "sse2", "avx2" };
+
+    for (size_t s = 0; s < 3; ++s) {
+        if (simds[s] > lib::bits::work::bestSimd()) continue;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t f = 0; f < frames; ++f) {
+            lib::bits::work::getUnsigned(
+                column[f]
+              , &memory[f * frame_size]
+              , 83
+              , 12
+            );
+        }
+        std::chrono::duration<double, std::nano> single(
+            std::chrono::steady_clock::now() - start
+        );
+
+        start = std::chrono::steady_clock::now();
+        lib::bits::work::getUnsignedColumn(
+            &column[0]
+          , &memory[0]
+          , frames
+          , frame_size
+          , 83
+          , 12
+          , simds[s]
+        );
+        std::chrono::duration<double, std::nano> bulk(
+            std::chrono::steady_clock::now() - start
+        );
+
+        output(
+            vSummary
+          , lib::format(
+                "column %-8s:  getUnsigned %5.2lf ns/frame; "
+                "getUnsignedColumn %5.2lf ns/frame"
+              , names[s]
+              , single.count() / frames
+              , bulk.count() / frames
+            )
+        );
+    }
+
+} // void Test::runTest3() //
+
 //------------------------------------------------------------------------------
 ///@brief   Test the isBitSet functions.                                        
 //------------------------------------------------------------------------------
@@ -366,6 +498,164 @@ void Test::getSigned()
 
 }
 
+//------------------------------------------------------------------------------
+///@brief   Check every offset and width against the bit at a time reference.   
+///@note    The data is exactly as long as the fields read from it, so reading  
+///         a byte too many would show up under a memory checker.               
+//------------------------------------------------------------------------------
+void Test::everyOffset()
+{
+    std::vector<uint8_t> data(17);
+    for (size_t d = 0; d < data.size(); ++d) data[d] = uint8_t(d * 0x5B + 0xA7);
+
+    int unsigned_errors(0);
+    int signed_errors(0);
+
+    for (uint64_t offset = 0; offset < 64; ++offset) {
+        for (uint64_t width = 1; width <= 64; ++width) {
+            std::vector<uint8_t> field(
+                data.begin()
+              , data.begin() + (offset + width + 7) / 8
+            );
+
+            uint64_t expected(bitwiseUnsigned(&field[0], offset, width));
+
+            uint64_t u;
+            lib::bits::work::getUnsigned(u, &field[0], offset, width);
+            if (u != expected) ++unsigned_errors;
+
+            int64_t s;
+            lib::bits::work::getSigned(s, &field[0], offset, width);
+            bool negative(lib::bits::work::isBitSet(&field[0], offset));
+            if (width < 64 && negative) expected |= ~0ULL << width;
+            if (s != int64_t(expected)) ++signed_errors;
+        }
+    }
+
+    TEST_IS_EQUAL(unsigned_errors, 0);
+    TEST_IS_EQUAL(signed_errors, 0);
+
+    uint64_t u(1);
+    TEST((lib::bits::work::getUnsigned(u, &data[0], 5, 0), u == 0));
+
+} // void Test::everyOffset() //
+
+//------------------------------------------------------------------------------
+///@brief   Test the compile time width getUnsigned and getSigned.              
+//------------------------------------------------------------------------------
+void Test::fixedWidth()
+{
+    std::vector<uint8_t> data
+    {
+        0x12
+      , 0x34
+      , 0x56
+      , 0x78
+      , 0x9A
+      , 0xBC
+      , 0xDE
+      , 0xF5
+      , 0x80
+    };
+
+    uint64_t u;
+    int64_t  s;
+
+    TEST((lib::bits::work::getUnsigned< 8>(u, &data[0],  4), u == 0x23));
+    TEST((lib::bits::work::getUnsigned<12>(u, &data[0], 52), u == 0xEF5));
+    TEST((lib::bits::work::getUnsigned<16>(u, &data[0],  0), u == 0x1234));
+    TEST((lib::bits::work::getUnsigned< 3>(u, &data[0],  3), u == 4));
+    TEST((lib::bits::work::getUnsigned<32>(u, &data[0], 28), u == 0x89ABCDEF));
+    TEST((lib::bits::work::getUnsigned<64>(u, &data[0],  0), u == 0x123456789ABCDEF5));
+    TEST((lib::bits::work::getUnsigned<64>(u, &data[0],  4), u == 0x23456789ABCDEF58));
+    TEST((lib::bits::work::getUnsigned<60>(u, &data[0],  5), u == 0x468ACF13579BDEB));
+
+    TEST((lib::bits::work::getSigned< 8>(s, &data[0], 32), s == -102));
+    TEST((lib::bits::work::getSigned< 8>(s, &data[0],  0), s == 0x12));
+    TEST((lib::bits::work::getSigned< 4>(s, &data[0], 60), s == 5));
+    TEST((lib::bits::work::getSigned< 1>(s, &data[0], 64), s == -1));
+    TEST((lib::bits::work::getSigned<40>(s, &data[0], 32), s == 0x9ABCDEF580 - (1LL << 40)));
+    TEST((lib::bits::work::getSigned<64>(s, &data[0],  0), s == 0x123456789ABCDEF5));
+
+} // void Test::fixedWidth() //
+
+//------------------------------------------------------------------------------
+///@brief   Check the column functions (with each instruction set) against      
+///         getUnsigned and getSigned.                                          
+//------------------------------------------------------------------------------
+void Test::column()
+{
+    const lib::bits::work::Simd simds[] = {
+        lib::bits::work::Simd::portable
+      , lib::bits::work::Simd::sse2
+      , lib::bits::work::Simd::avx2
+    };
+
+    //--------------------------------------------------------------------------
+    //  Frame sizes that are not a multiple of 8 and frame counts that leave a  
+    //  remainder for each instruction set, with fields near the end of the     
+    //  frame so that the last frames cannot be read a word at a time.          
+    //--------------------------------------------------------------------------
+    const size_t sizes[] = { 3, 9, 13, 32 };
+    const size_t counts[] = { 0, 1, 2, 3, 4, 5, 7, 11 };
+
+    int errors(0);
+    int checks(0);
+
+    for (size_t s = 0; s < 3; ++s) {
+        for (size_t z = 0; z < 4; ++z) {
+            for (size_t n = 0; n < 8; ++n) {
+                const size_t size(sizes[z]);
+                const size_t count(counts[n]);
+
+                std::vector<uint8_t> frames(size * count + 1);
+                for (size_t b = 0; b < frames.size(); ++b) {
+                    frames[b] = uint8_t(b * 0x3D + 0x91);
+                }
+
+                for (uint64_t width = 1; width <= 64; ++width) {
+                    for (uint64_t offset = 0; offset + width <= size * 8;
+                         offset += 5
+                    ) {
+                        std::vector<uint64_t> u(count + 1, 0xA5A5);
+                        std::vector<int64_t>  i(count + 1, 0xA5A5);
+
+                        lib::bits::work::getUnsignedColumn(
+                            u.data(), frames.data(), count, size
+                          , offset, width, simds[s]
+                        );
+                        lib::bits::work::getSignedColumn(
+                            i.data(), frames.data(), count, size
+                          , offset, width, simds[s]
+                        );
+
+                        for (size_t f = 0; f < count; ++f) {
+                            uint64_t eu;
+                            int64_t  ei;
+                            lib::bits::work::getUnsigned(
+                                eu, &frames[f * size], offset, width
+                            );
+                            lib::bits::work::getSigned(
+                                ei, &frames[f * size], offset, width
+                            );
+                            if (u[f] != eu) ++errors;
+                            if (i[f] != ei) ++errors;
+                        }
+                        if (u[count] != 0xA5A5 || i[count] != 0xA5A5) {
+                            ++errors;
+                        }
+                        ++checks;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(checks > 1000);
+    TEST_IS_EQUAL(errors, 0);
+
+} // void Test::column() //
+
 
 } // namespace test 
 } // namespace work
@@ -20,6 +20,10 @@ namespace test {
 ///                                                                             
 ///@author  Make Test Utility       MTU     Utility by DHF                      
 ///                                                                             
+///@version 2026-10-16  DHF     Added column.                                   
+///                                                                             
+///@version 2026-10-16  DHF     Added everyOffset, fixedWidth and runTest3.     
+///                                                                             
 //------------------------------------------------------------------------------
 class Test : public dev::test::work::Test {
     public:
@@ -30,10 +34,14 @@ class Test : public dev::test::work::Test {
 
     protected:
         void runTest();
+        void runTest3();
 
         void isBitSet();
         void getUnsigned();
         void getSigned();
+        void everyOffset();
+        void fixedWidth();
+        void column();
 
 
     private:
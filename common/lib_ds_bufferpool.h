@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+///@file lib_ds_bufferpool.h                                                    
+///@brief Holds lib::ds::BufferPool, recycled lib::ds::VectorWithOffset buffers 
+///       handed out as lib::ds::shared_ptr's.                                  
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_DS_BUFFERPOOL_H_FILE_GUARD
+#define LIB_DS_BUFFERPOOL_H_FILE_GUARD
+
+#include "lib_ds_shared_ptr.h"
+#include "lib_ds_vectorwithoffset.h"
+
+#include <atomic>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//  thread_local is redefined by lib_ds_enum.h, so use the compiler's own.      
+//------------------------------------------------------------------------------
+#ifdef IS_VISUAL_STUDIO
+    #define LIB_DS_BUFFERPOOL_THREAD_LOCAL __declspec(thread)
+#else
+    #define LIB_DS_BUFFERPOOL_THREAD_LOCAL __thread
+#endif
+
+namespace lib {
+namespace ds {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   A free list of same sized blocks:  a small list per thread backed by
+///         a shared (mutex guarded) depot.                                     
+///                                                                             
+///@tparam  TAG     Names the list; TAG::dispose(void*) frees a block the depot 
+///                 has no room for.                                            
+///                                                                             
+///@par Design                                                                  
+///         Pushing and popping use the calling thread's list; only when that   
+///         list is empty (pop) or full (push) is half a list's worth moved     
+///         from or to the depot under the mutex.  A buffer allocated by a      
+///         reader thread and released by a subscriber thread makes its way     
+///         back through the depot.                                             
+///                                                                             
+///@note    Blocks left on a thread's list when the thread exits are not freed  
+///         (at most LOCAL_SIZE per thread per TAG).                            
+///                                                                             
+///@par Thread Safety:  class                                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+template <typename TAG>
+class FreeList
+{
+    public:
+        enum { LOCAL_SIZE = 64, DEPOT_SIZE = 4096 };
+
+        //----------------------------------------------------------------------
+        ///@return  A recycled block; nullptr if there are none.                
+        //----------------------------------------------------------------------
+        static void* pop()
+        {
+            Local& local(localList());
+
+            if (local.m_Count == 0) {
+                Depot& depot(depotList());
+                boost::mutex::scoped_lock lock(depot.m_Mutex);
+                while (local.m_Count < LOCAL_SIZE / 2 && !depot.m_Items.empty()) {
+                    local.m_Items[local.m_Count++] = depot.m_Items.back();
+                    depot.m_Items.pop_back();
+                }
+            }
+
+            return local.m_Count == 0 ? nullptr : local.m_Items[--local.m_Count];
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Keep the block for a later pop (or dispose of it if all of  
+        ///         the lists are full).                                        
+        //----------------------------------------------------------------------
+        static void push(void* block)
+        {
+            Local& local(localList());
+
+            if (local.m_Count == LOCAL_SIZE) {
+                Depot& depot(depotList());
+                boost::mutex::scoped_lock lock(depot.m_Mutex);
+                while (local.m_Count > LOCAL_SIZE / 2) {
+                    void* p(local.m_Items[--local.m_Count]);
+                    if (depot.m_Items.size() < DEPOT_SIZE) {
+                        depot.m_Items.push_back(p);
+                    } else {
+                        TAG::dispose(p);
+                    }
+                }
+            }
+
+            local.m_Items[local.m_Count++] = block;
+        }
+
+    private:
+        //----------------------------------------------------------------------
+        ///@note    Plain old data so that it can be thread local.              
+        //----------------------------------------------------------------------
+        struct Local
+        {
+            void*   m_Items[LOCAL_SIZE];
+            size_t  m_Count;
+        };
+
+        struct Depot
+        {
+            Depot() { m_Items.reserve(DEPOT_SIZE); }
+
+            boost::mutex        m_Mutex;
+            std::vector<void*>  m_Items;
+        };
+
+        static Local& localList()
+        {
+            static LIB_DS_BUFFERPOOL_THREAD_LOCAL Local s_Local;
+            return s_Local;
+        }
+
+        static Depot& depotList()
+        {
+            static Depot* s_Depot(new Depot);   // never freed:  outlives users
+            return *s_Depot;
+        }
+
+}; // class FreeList //
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Hand out lib::ds::VectorWithOffset<TYPE> buffers that go back to a  
+///         free list (rather than the heap) when the last reference is gone.   
+///                                                                             
+///@par Purpose:                                                                
+///         A publisher that news a VectorWithOffset per record costs three     
+///         heap allocations per record:  the vector, its storage and the       
+///         shared_ptr control block.  A pooled buffer keeps its storage (and   
+///         capacity) when it is recycled, and its control block comes from a   
+///         free list too (via the shared_ptr allocator), so once the pipeline  
+///         reaches a steady state nothing is allocated at all.                 
+///                                                                             
+///@par Expected Usage:                                                         
+///         @code                                                               
+///             using Pool = lib::ds::BufferPool<uint8_t>;                      
+///                                                                             
+///             Pool::BufferPtr buffer(Pool::get(record_size, file_offset));    
+///             file.read((char*) buffer->memory(), record_size);               
+///             publish(buffer);        // returns to the pool when processed   
+///         @endcode                                                            
+///                                                                             
+///@note    A recycled buffer is resized, not cleared:  the contents left by    
+///         its last user are still there.                                      
+///                                                                             
+///@par Thread Safety:  class                                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+template <typename TYPE>
+class BufferPool
+{
+    public:
+        using Buffer = lib::ds::VectorWithOffset<TYPE>;
+        using BufferPtr = lib::ds::shared_ptr<Buffer>;
+
+        //----------------------------------------------------------------------
+        ///@brief   Return a buffer of size items.                              
+        ///@param   file_offset     See lib::ds::VectorWithOffset.              
+        //----------------------------------------------------------------------
+        static BufferPtr get(size_t size, uint64_t file_offset = -1)
+        {
+            Buffer* buffer(static_cast<Buffer*>(Buffers::pop()));
+            if (buffer == nullptr) {
+                buffer = new Buffer;
+                ++counter();
+            }
+
+            buffer->resize(size);
+            buffer->setFileOffset(file_offset);
+
+            return BufferPtr(buffer, Recycle(), BlockAllocator<Buffer>());
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the number of buffers that have come from the heap.  
+        //----------------------------------------------------------------------
+        static size_t created() { return counter(); }
+
+    private:
+        //----------------------------------------------------------------------
+        ///@brief   The shared_ptr deleter:  back to the free list.             
+        //----------------------------------------------------------------------
+        struct Recycle
+        {
+            void operator()(Buffer* buffer) const
+            {
+                Buffers::push(buffer);
+            }
+        };
+
+        struct BufferTag
+        {
+            static void dispose(void* p) { delete static_cast<Buffer*>(p); }
+        };
+        using Buffers = FreeList<BufferTag>;
+
+        //----------------------------------------------------------------------
+        ///@brief   The shared_ptr allocator:  control blocks from a free list. 
+        //----------------------------------------------------------------------
+        template <typename T>
+        struct BlockAllocator
+        {
+            using value_type = T;
+
+            BlockAllocator() noexcept { }
+
+            template <typename U>
+            BlockAllocator(const BlockAllocator<U>&) noexcept { }
+
+            T* allocate(size_t n)
+            {
+                if (n == 1) {
+                    void* p(FreeList<BlockTag<T> >::pop());
+                    if (p != nullptr) return static_cast<T*>(p);
+                }
+                return static_cast<T*>(::operator new(n * sizeof(T)));
+            }
+
+            void deallocate(T* p, size_t n)
+            {
+                if (n == 1) {
+                    FreeList<BlockTag<T> >::push(p);
+                } else {
+                    ::operator delete(p);
+                }
+            }
+
+            template <typename U>
+            bool operator==(const BlockAllocator<U>&) const { return true; }
+
+            template <typename U>
+            bool operator!=(const BlockAllocator<U>&) const { return false; }
+        };
+
+        template <typename T>
+        struct BlockTag
+        {
+            static void dispose(void* p) { ::operator delete(p); }
+        };
+
+        static std::atomic<size_t>& counter()
+        {
+            static std::atomic<size_t> s_Created(0);
+            return s_Created;
+        }
+
+}; // class BufferPool //
+
+} // namespace ds //
+} // namespace lib //
+
+#endif // #ifndef LIB_DS_BUFFERPOOL_H_FILE_GUARD
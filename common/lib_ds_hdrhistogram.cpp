@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+///@file lib_ds_hdrhistogram.cpp                                                
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   A log-linear histogram of latencies.                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_ds_hdrhistogram.h"
+#include "lib_string.h"
+
+#include <math.h>
+
+namespace lib {
+namespace ds {
+
+const unsigned HdrHistogram::SUB_BUCKET_BITS;
+const uint64_t HdrHistogram::SUB_BUCKETS;
+const unsigned HdrHistogram::MAXIMUM_BITS;
+const uint64_t HdrHistogram::MAXIMUM;
+const size_t HdrHistogram::BUCKETS;
+
+//------------------------------------------------------------------------------
+//  The index of the highest bit set (value > 0).                               
+//------------------------------------------------------------------------------
+static unsigned highestBit(uint64_t value)
+{
+    #ifdef __GNUC__
+        return 63 - __builtin_clzll(value);
+    #else
+        unsigned result(0);
+        while (value >>= 1) ++result;
+        return result;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+///@brief   Construct an empty histogram.                                       
+//------------------------------------------------------------------------------
+HdrHistogram::HdrHistogram()
+{
+    clear();
+
+} // HdrHistogram::HdrHistogram() //
+
+//------------------------------------------------------------------------------
+///@brief   Copy the counts (as they are at the moment).                        
+//------------------------------------------------------------------------------
+HdrHistogram::HdrHistogram(const HdrHistogram& that)
+{
+    clear();
+    add(that);
+
+} // HdrHistogram::HdrHistogram(const HdrHistogram& that) //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+HdrHistogram::~HdrHistogram()
+{
+
+} // HdrHistogram::~HdrHistogram() //
+
+//------------------------------------------------------------------------------
+///@brief   Copy the counts (as they are at the moment).                        
+//------------------------------------------------------------------------------
+HdrHistogram& HdrHistogram::operator=(const HdrHistogram& that)
+{
+    if (this != &that) {
+        clear();
+        add(that);
+    }
+    return *this;
+
+} // HdrHistogram::operator=(const HdrHistogram& that) //
+
+//------------------------------------------------------------------------------
+///@brief   Count value (count times).                                          
+//------------------------------------------------------------------------------
+void HdrHistogram::record(uint64_t value, uint64_t count)
+{
+    m_Buckets[bucket(value)].fetch_add(count, std::memory_order_relaxed);
+    m_Count.fetch_add(count, std::memory_order_relaxed);
+    m_Sum.fetch_add(value * count, std::memory_order_relaxed);
+
+    uint64_t maximum(m_Maximum.load(std::memory_order_relaxed));
+    while (value > maximum
+        && !m_Maximum.compare_exchange_weak(
+                maximum, value, std::memory_order_relaxed
+           )
+    ) { }
+
+} // void HdrHistogram::record(uint64_t value, uint64_t count) //
+
+//------------------------------------------------------------------------------
+///@brief   Add that histogram's counts to these.                               
+//------------------------------------------------------------------------------
+void HdrHistogram::add(const HdrHistogram& that)
+{
+    for (size_t b = 0; b < BUCKETS; ++b) {
+        const uint64_t count(that.m_Buckets[b].load(std::memory_order_relaxed));
+        if (count != 0) {
+            m_Buckets[b].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+    m_Count.fetch_add(
+        that.m_Count.load(std::memory_order_relaxed), std::memory_order_relaxed
+    );
+    m_Sum.fetch_add(
+        that.m_Sum.load(std::memory_order_relaxed), std::memory_order_relaxed
+    );
+
+    const uint64_t value(that.maximum());
+    uint64_t maximum(m_Maximum.load(std::memory_order_relaxed));
+    while (value > maximum
+        && !m_Maximum.compare_exchange_weak(
+                maximum, value, std::memory_order_relaxed
+           )
+    ) { }
+
+} // void HdrHistogram::add(const HdrHistogram& that) //
+
+//------------------------------------------------------------------------------
+///@brief   Forget every value.                                                 
+//------------------------------------------------------------------------------
+void HdrHistogram::clear()
+{
+    for (size_t b = 0; b < BUCKETS; ++b) {
+        m_Buckets[b].store(0, std::memory_order_relaxed);
+    }
+    m_Count.store(0, std::memory_order_relaxed);
+    m_Sum.store(0, std::memory_order_relaxed);
+    m_Maximum.store(0, std::memory_order_relaxed);
+
+} // void HdrHistogram::clear() //
+
+//------------------------------------------------------------------------------
+///@brief   Return the number of values recorded.                               
+//------------------------------------------------------------------------------
+uint64_t HdrHistogram::count() const
+{
+    return m_Count.load(std::memory_order_relaxed);
+
+} // uint64_t HdrHistogram::count() const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the mean of the values recorded (exact; 0 if none).          
+//------------------------------------------------------------------------------
+double HdrHistogram::mean() const
+{
+    const uint64_t count(m_Count.load(std::memory_order_relaxed));
+    return count == 0
+         ? 0
+         : double(m_Sum.load(std::memory_order_relaxed)) / double(count);
+
+} // double HdrHistogram::mean() const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the value that percentile percent of the values are at or    
+///         below (the top of its bucket, but never above maximum()).           
+///@param   percentile  0 through 100.                                          
+//------------------------------------------------------------------------------
+uint64_t HdrHistogram::valueAtPercentile(double percentile) const
+{
+    const uint64_t total(count());
+    if (total == 0) return 0;
+
+    if (percentile < 0) percentile = 0;
+    if (percentile > 100) percentile = 100;
+
+    uint64_t wanted(uint64_t(ceil(percentile / 100 * double(total))));
+    if (wanted == 0) wanted = 1;
+
+    uint64_t seen(0);
+    for (size_t b = 0; b < BUCKETS; ++b) {
+        seen += m_Buckets[b].load(std::memory_order_relaxed);
+        if (seen >= wanted) {
+            const uint64_t value(highest(b));
+            return value < maximum() ? value : maximum();
+        }
+    }
+
+    return maximum();
+
+} // uint64_t HdrHistogram::valueAtPercentile(double percentile) const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the count, mean, median, 99th percentile and maximum.        
+//------------------------------------------------------------------------------
+std::string HdrHistogram::toString(const char* units) const
+{
+    return format(
+        "n %llu  mean %.0lf  p50 %llu  p99 %llu  p99.9 %llu  max %llu %s"
+      , (unsigned long long) count()
+      , mean()
+      , (unsigned long long) valueAtPercentile(50)
+      , (unsigned long long) valueAtPercentile(99)
+      , (unsigned long long) valueAtPercentile(99.9)
+      , (unsigned long long) maximum()
+      , units
+    );
+
+} // std::string HdrHistogram::toString(const char* units) const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the bucket value is counted in.                              
+//------------------------------------------------------------------------------
+size_t HdrHistogram::bucket(uint64_t value)
+{
+    if (value < SUB_BUCKETS) return size_t(value);
+    if (value > MAXIMUM) value = MAXIMUM;
+
+    const unsigned bit(highestBit(value));
+    const unsigned shift(bit - SUB_BUCKET_BITS);
+    return size_t(
+        SUB_BUCKETS * (shift + 1) + ((value >> shift) & (SUB_BUCKETS - 1))
+    );
+
+} // size_t HdrHistogram::bucket(uint64_t value) //
+
+//------------------------------------------------------------------------------
+///@brief   Return the smallest value counted in the bucket.                    
+//------------------------------------------------------------------------------
+uint64_t HdrHistogram::lowest(size_t bucket)
+{
+    if (bucket < SUB_BUCKETS) return bucket;
+
+    const unsigned shift(unsigned(bucket / SUB_BUCKETS) - 1);
+    return (SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+
+} // uint64_t HdrHistogram::lowest(size_t bucket) //
+
+//------------------------------------------------------------------------------
+///@brief   Return the largest value counted in the bucket.                     
+//------------------------------------------------------------------------------
+uint64_t HdrHistogram::highest(size_t bucket)
+{
+    if (bucket < SUB_BUCKETS) return bucket;
+
+    const unsigned shift(unsigned(bucket / SUB_BUCKETS) - 1);
+    return lowest(bucket) + (uint64_t(1) << shift) - 1;
+
+} // uint64_t HdrHistogram::highest(size_t bucket) //
+
+} // namespace ds
+} // namespace lib
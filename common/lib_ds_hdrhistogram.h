@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+///@file lib_ds_hdrhistogram.h                                                  
+///@brief Holds lib::ds::HdrHistogram, a log-linear histogram of latencies.     
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_DS_HDRHISTOGRAM_H_FILE_GUARD
+#define LIB_DS_HDRHISTOGRAM_H_FILE_GUARD
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace ds {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   A histogram of (non-negative) values, e.g., nanoseconds, with a     
+///         fixed relative precision over a wide range:  the HdrHistogram       
+///         layout.                                                             
+///                                                                             
+///@par Buckets                                                                 
+///         Values below SUB_BUCKETS have a bucket each.  Above that each       
+///         power of two is split into SUB_BUCKETS equal buckets, so a value    
+///         is known to within 1 / SUB_BUCKETS (6.25%) of itself, from a        
+///         nanosecond to MAXIMUM (about 18 minutes of them).  Larger values    
+///         go into the last bucket; maximum() is still exact.                  
+///                                                                             
+///@par Concurrency                                                             
+///         The buckets are atomic counters:  record() from any number of       
+///         threads (relaxed adds, no lock) while others read.  A reader        
+///         racing writers sees each bucket whole, but not necessarily all of   
+///         them at the same instant.                                           
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::ds::HdrHistogram latency;                                      
+///         ...                                                                 
+///         latency.record(end - start);                                        
+///         ...                                                                 
+///         printf("p99 %" PRIu64 " ns\n", latency.valueAtPercentile(99));      
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class HdrHistogram
+{
+    public:
+        static const unsigned SUB_BUCKET_BITS = 4;
+        static const uint64_t SUB_BUCKETS = uint64_t(1) << SUB_BUCKET_BITS;
+        static const unsigned MAXIMUM_BITS = 40;
+        static const uint64_t MAXIMUM = (uint64_t(1) << MAXIMUM_BITS) - 1;
+        static const size_t BUCKETS
+            = SUB_BUCKETS * (MAXIMUM_BITS - SUB_BUCKET_BITS + 1);
+
+        HdrHistogram();
+        HdrHistogram(const HdrHistogram& that);
+        virtual ~HdrHistogram();
+        HdrHistogram& operator=(const HdrHistogram& that);
+
+        void record(uint64_t value, uint64_t count = 1);
+        void add(const HdrHistogram& that);
+        void clear();
+
+        uint64_t count() const;
+        uint64_t maximum() const
+            { return m_Maximum.load(std::memory_order_relaxed); }
+        double mean() const;
+        uint64_t valueAtPercentile(double percentile) const;
+
+        std::string toString(const char* units = "ns") const;
+
+        static size_t bucket(uint64_t value);
+        static uint64_t lowest(size_t bucket);
+        static uint64_t highest(size_t bucket);
+
+    private:
+        std::atomic<uint64_t>   m_Buckets[BUCKETS];
+        std::atomic<uint64_t>   m_Count;
+        std::atomic<uint64_t>   m_Sum;
+        std::atomic<uint64_t>   m_Maximum;
+
+}; // class HdrHistogram //
+
+} // namespace ds
+} // namespace lib
+
+#endif // #ifndef LIB_DS_HDRHISTOGRAM_H_FILE_GUARD
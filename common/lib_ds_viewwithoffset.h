@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+///@file lib_ds_viewwithoffset.h                                                
+///@brief Holds lib::ds::ViewWithOffset, a read-only view of data that someone  
+///       else owns, with the file offset the data came from.                   
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_DS_VIEWWITHOFFSET_H_FILE_GUARD
+#define LIB_DS_VIEWWITHOFFSET_H_FILE_GUARD
+
+#include "lib_ds_offset.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace lib {
+namespace ds {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: ViewWithOffset                                                   
+///                                                                             
+///@brief   The read-only counterpart of VectorWithOffset:  a pointer and a     
+///         size rather than a vector of its own.                               
+///                                                                             
+///@par Purpose:                                                                
+///         A reader that copies each record into a VectorWithOffset touches    
+///         every byte twice.  A ViewWithOffset points into memory that lives   
+///         elsewhere (e.g., a mapped file); whoever hands the view out keeps   
+///         that memory alive for as long as the view is (see                   
+///         lib::io::msg::MappedFileReader, which publishes views that share    
+///         ownership of their mapping through the shared_ptr aliasing          
+///         constructor).                                                       
+///                                                                             
+///@par Thread Safety:  class                                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+template <typename TYPE>
+class ViewWithOffset : public Offset
+{
+    public:
+        using value_type = TYPE;
+        using const_iterator = TYPE const*;
+
+        ViewWithOffset() : Offset(-1), m_Data(nullptr), m_Size(0) { }
+
+        ViewWithOffset(TYPE const* data, size_t size, uint64_t fileoffset = -1)
+            : Offset(fileoffset)
+            , m_Data(data)
+            , m_Size(size)
+        { }
+
+        ViewWithOffset(const ViewWithOffset& that) = default;
+        ViewWithOffset& operator=(const ViewWithOffset& that) = default;
+        virtual ~ViewWithOffset() { }
+
+        uint64_t    fileOffset() const { return m_FileOffset; }
+
+        size_t      size() const { return m_Size; }
+        bool        empty() const { return m_Size == 0; }
+        uint64_t    sizeInBytes() const { return m_Size * sizeof(TYPE); }
+
+        TYPE const* data() const { return m_Data; }
+        const void* memory() const { return m_Data; }
+
+        TYPE const& operator[](size_t index) const { return m_Data[index]; }
+
+        const_iterator begin() const { return m_Data; }
+        const_iterator end() const { return m_Data + m_Size; }
+
+    private:
+        TYPE const* m_Data;
+        size_t      m_Size;
+
+}; // class ViewWithOffset //
+
+} // namespace ds
+} // namespace lib
+
+#endif // #ifndef LIB_DS_VIEWWITHOFFSET_H_FILE_GUARD
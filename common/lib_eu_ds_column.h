@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_ds_column.h                                                     
+///@brief Holds lib::eu::ds::RawColumn and lib::eu::ds::EuColumn, one           
+///       parameter's values over a run of frames.                              
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_DS_COLUMN_H_FILE_GUARD
+#define LIB_EU_DS_COLUMN_H_FILE_GUARD
+
+#include "lib_eu_work_metadata.h"
+
+#include <stddef.h>                     /// size_t
+#include <stdint.h>
+#include <vector>
+
+
+namespace lib {
+namespace eu {
+namespace ds {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   One parameter's raw (decoded, unscaled) values, a value per frame,  
+///         as lib::eu::work::decodeColumn produces them.                       
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+struct RawColumn
+{
+    lib::eu::work::ConstMetaDataPtr m_MetaData;
+    std::vector<int64_t>            m_Values;
+
+}; // struct RawColumn //
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   One parameter's values in engineering units, with a validity bit    
+///         per value.                                                          
+///                                                                             
+///@par Validity                                                                
+///         Bit (i % 8) of m_Valid[i / 8] is set if m_Values[i] was in range.   
+///         A value that was out of range has been clamped to the range.        
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+struct EuColumn
+{
+    EuColumn() : m_InvalidCount(0) { }
+
+    bool isValid(size_t index) const
+        { return ((m_Valid[index / 8] >> (index % 8)) & 1) != 0; }
+
+    lib::eu::work::ConstMetaDataPtr m_MetaData;
+    std::vector<double>             m_Values;
+    std::vector<uint8_t>            m_Valid;
+    size_t                          m_InvalidCount;
+
+}; // struct EuColumn //
+
+} // namespace ds
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_DS_COLUMN_H_FILE_GUARD
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_msg_conversionlab.h                                             
+///@brief Holds lib::eu::msg::ConversionLab, the publisher/subscriber form of   
+///       lib::eu::work::ConversionLab.                                         
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::eu::msg::ConversionLabPtr eu;                                  
+///         lib::new_shared(eu);                                                
+///         threads.push_back(eu);                                              
+///                                                                             
+///         columns->connect(eu);           // publishes RawColumn              
+///         eu->connect(archive);           // subscribes to EuColumn           
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_MSG_CONVERSIONLAB_H_FILE_GUARD
+#define LIB_EU_MSG_CONVERSIONLAB_H_FILE_GUARD
+
+#include "lib_ds_shared_ptr.h"
+#include "lib_eu_ds_column.h"
+#include "lib_eu_work_conversionlab.h"
+#include "lib_msg_conversionlab.h"
+
+
+namespace lib {
+namespace eu {
+namespace msg {
+
+using ConversionLab = lib::msg::ConversionLab<
+    lib::eu::work::ConversionLab
+  , lib::eu::ds::RawColumn
+  , lib::eu::ds::EuColumn
+>;
+
+using ConversionLabPtr = lib::ds::shared_ptr<ConversionLab>;
+
+} // namespace msg
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_MSG_CONVERSIONLAB_H_FILE_GUARD
@@ -0,0 +1,313 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_conversion.cpp                                             
+///                                                                             
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_eu_work_conversion.h"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define LIB_EU_WORK_CONVERSION_X86_64
+#include <immintrin.h>
+#endif
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///@brief   What a kernel needs of the Conversion.                              
+//------------------------------------------------------------------------------
+struct Kernel
+{
+    double  m_Scale;
+    double  m_Offset;
+    double  m_Low;
+    double  m_High;
+    bool    m_Clamp;
+};
+
+//------------------------------------------------------------------------------
+///@brief   Return the number of bits set in a bitmap byte.                     
+//------------------------------------------------------------------------------
+static size_t bitsSet(unsigned byte)
+{
+    byte = byte - ((byte >> 1) & 0x55);
+    byte = (byte & 0x33) + ((byte >> 2) & 0x33);
+    return (byte + (byte >> 4)) & 0x0F;
+}
+
+//------------------------------------------------------------------------------
+///@brief   Convert values [first, count) a value at a time.                    
+///@note    first is a multiple of 8 (the start of a bitmap byte).              
+///@return  The number of values that were not valid.                           
+//------------------------------------------------------------------------------
+static size_t convertPortable(
+    double*         eu
+  , uint8_t*        valid
+  , double const*   raw
+  , size_t          first
+  , size_t          count
+  , Kernel const&   k
+)
+{
+    size_t invalid(0);
+
+    for (size_t i = first; i < count; i += 8) {
+        const size_t end(i + 8 < count ? i + 8 : count);
+
+        unsigned byte(0);
+        for (size_t j = i; j < end; ++j) {
+            double y(raw[j] * k.m_Scale + k.m_Offset);
+            if (y >= k.m_Low && y <= k.m_High) byte |= 1u << (j - i);
+
+            //------------------------------------------------------------------
+            //  The same comparisons (and NaN handling) as maxpd/minpd.         
+            //------------------------------------------------------------------
+            if (k.m_Clamp) {
+                y = y > k.m_Low ? y : k.m_Low;
+                y = y < k.m_High ? y : k.m_High;
+            }
+            eu[j] = y;
+        }
+
+        valid[i / 8] = uint8_t(byte);
+        invalid += (end - i) - bitsSet(byte);
+    }
+
+    return invalid;
+
+} // static size_t convertPortable() //
+
+#ifdef LIB_EU_WORK_CONVERSION_X86_64
+//------------------------------------------------------------------------------
+///@brief   Convert the values two at a time, a bitmap byte per loop.           
+///@param   invalid     Incremented by the number that were not valid.          
+///@return  The number of values converted (a multiple of 8).                   
+//------------------------------------------------------------------------------
+static size_t convertSse2(
+    double*         eu
+  , uint8_t*        valid
+  , double const*   raw
+  , size_t          count
+  , Kernel const&   k
+  , size_t&         invalid
+)
+{
+    const __m128d scale(_mm_set1_pd(k.m_Scale));
+    const __m128d offset(_mm_set1_pd(k.m_Offset));
+    const __m128d low(_mm_set1_pd(k.m_Low));
+    const __m128d high(_mm_set1_pd(k.m_High));
+
+    size_t i(0);
+    for (; i + 8 <= count; i += 8) {
+        unsigned byte(0);
+        for (unsigned j = 0; j < 8; j += 2) {
+            __m128d y(
+                _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(raw + i + j), scale), offset)
+            );
+            __m128d ok(_mm_and_pd(_mm_cmpge_pd(y, low), _mm_cmple_pd(y, high)));
+            byte |= unsigned(_mm_movemask_pd(ok)) << j;
+
+            if (k.m_Clamp) y = _mm_min_pd(_mm_max_pd(y, low), high);
+            _mm_storeu_pd(eu + i + j, y);
+        }
+
+        valid[i / 8] = uint8_t(byte);
+        invalid += 8 - bitsSet(byte);
+    }
+
+    return i;
+
+} // static size_t convertSse2() //
+
+#if defined(__GNUC__)
+//------------------------------------------------------------------------------
+///@brief   Convert the values four at a time, a bitmap byte per loop.          
+///@param   invalid     Incremented by the number that were not valid.          
+///@return  The number of values converted (a multiple of 8).                   
+//------------------------------------------------------------------------------
+__attribute__((target("avx")))
+static size_t convertAvx(
+    double*         eu
+  , uint8_t*        valid
+  , double const*   raw
+  , size_t          count
+  , Kernel const&   k
+  , size_t&         invalid
+)
+{
+    const __m256d scale(_mm256_set1_pd(k.m_Scale));
+    const __m256d offset(_mm256_set1_pd(k.m_Offset));
+    const __m256d low(_mm256_set1_pd(k.m_Low));
+    const __m256d high(_mm256_set1_pd(k.m_High));
+
+    size_t i(0);
+    for (; i + 8 <= count; i += 8) {
+        __m256d y0(
+            _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(raw + i), scale), offset)
+        );
+        __m256d y1(
+            _mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(raw + i + 4), scale)
+              , offset
+            )
+        );
+
+        __m256d ok0(
+            _mm256_and_pd(
+                _mm256_cmp_pd(y0, low, _CMP_GE_OQ)
+              , _mm256_cmp_pd(y0, high, _CMP_LE_OQ)
+            )
+        );
+        __m256d ok1(
+            _mm256_and_pd(
+                _mm256_cmp_pd(y1, low, _CMP_GE_OQ)
+              , _mm256_cmp_pd(y1, high, _CMP_LE_OQ)
+            )
+        );
+        unsigned byte(
+            unsigned(_mm256_movemask_pd(ok0))
+          | unsigned(_mm256_movemask_pd(ok1)) << 4
+        );
+
+        if (k.m_Clamp) {
+            y0 = _mm256_min_pd(_mm256_max_pd(y0, low), high);
+            y1 = _mm256_min_pd(_mm256_max_pd(y1, low), high);
+        }
+        _mm256_storeu_pd(eu + i, y0);
+        _mm256_storeu_pd(eu + i + 4, y1);
+
+        valid[i / 8] = uint8_t(byte);
+        invalid += 8 - bitsSet(byte);
+    }
+
+    return i;
+
+} // static size_t convertAvx() //
+#endif // #if defined(__GNUC__) //
+#endif // #ifdef LIB_EU_WORK_CONVERSION_X86_64 //
+
+//------------------------------------------------------------------------------
+///@brief   No conversion:  scale 1, offset 0 and no range.                     
+//------------------------------------------------------------------------------
+Conversion::Conversion()
+    : m_Scale(1)
+    , m_Offset(0)
+    , m_Low(-std::numeric_limits<double>::infinity())
+    , m_High(std::numeric_limits<double>::infinity())
+    , m_HasRange(false)
+{
+} // Conversion::Conversion() //
+
+//------------------------------------------------------------------------------
+///@param   low, high   The valid range; no range if low is not less than high. 
+//------------------------------------------------------------------------------
+Conversion::Conversion(double scale, double offset, double low, double high)
+    : m_Scale(scale)
+    , m_Offset(offset)
+    , m_Low(low)
+    , m_High(high)
+    , m_HasRange(low < high)
+{
+    if (!m_HasRange) {
+        m_Low = -std::numeric_limits<double>::infinity();
+        m_High = std::numeric_limits<double>::infinity();
+    }
+
+} // Conversion::Conversion(double, double, double, double) //
+
+//------------------------------------------------------------------------------
+///@brief   The parameter's conversion (see the class description).             
+//------------------------------------------------------------------------------
+Conversion::Conversion(MetaData const& md)
+    : Conversion(1, 0, md.rangeLow(), md.rangeHigh())
+{
+    if (md.scale() != 0) {
+        m_Scale = md.scale();
+    } else if (md.msbValue() != 0 && md.bitCount() > 0) {
+        m_Scale = std::ldexp(md.msbValue(), 1 - int(md.bitCount()));
+    }
+
+} // Conversion::Conversion(MetaData const& md) //
+
+//------------------------------------------------------------------------------
+///@brief   Convert a column of raw values.                                     
+///@param   eu      Gets count values.                                          
+///@param   valid   Gets bitmapSize(count) bytes; see the class description.    
+///@param   simd    The best instruction set to use (the machine's best at      
+///                 most).                                                      
+///@return  The number of values that were not valid.                           
+//------------------------------------------------------------------------------
+size_t Conversion::convert(
+    double*         eu
+  , uint8_t*        valid
+  , double const*   raw
+  , size_t          count
+  , Simd            simd
+) const
+{
+    const Kernel k = { m_Scale, m_Offset, m_Low, m_High, m_HasRange };
+
+    if (simd > lib::bits::work::bestSimd()) simd = lib::bits::work::bestSimd();
+
+    size_t invalid(0);
+    size_t done(0);
+
+    #ifdef LIB_EU_WORK_CONVERSION_X86_64
+    switch (simd)
+    {
+        #if defined(__GNUC__)
+        case Simd::avx2:
+            done = convertAvx(eu, valid, raw, count, k, invalid);
+            break;
+        #endif
+        case Simd::sse2:
+            done = convertSse2(eu, valid, raw, count, k, invalid);
+            break;
+        default:
+            break;
+    }
+    #endif
+
+    return invalid + convertPortable(eu, valid, raw, done, count, k);
+
+} // size_t Conversion::convert(double const*) const //
+
+//------------------------------------------------------------------------------
+///@brief   Convert a column of raw integers (e.g., from decodeColumn).         
+///@note    Converted to double a block at a time (x86-64 has no packed         
+///         int64 to double before AVX-512) and then as the double version.     
+//------------------------------------------------------------------------------
+size_t Conversion::convert(
+    double*         eu
+  , uint8_t*        valid
+  , int64_t const*  raw
+  , size_t          count
+  , Simd            simd
+) const
+{
+    const size_t block(256);            // a multiple of 8:  whole bitmap bytes
+    double values[block];
+
+    size_t invalid(0);
+    for (size_t i = 0; i < count; i += block) {
+        const size_t n(count - i < block ? count - i : block);
+        for (size_t j = 0; j < n; ++j) values[j] = double(raw[i + j]);
+
+        invalid += convert(eu + i, valid + i / 8, values, n, simd);
+    }
+
+    return invalid;
+
+} // size_t Conversion::convert(int64_t const*) const //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_conversion.h                                               
+///@brief Holds lib::eu::work::Conversion, the raw to engineering unit          
+///       conversion of a parameter applied to whole columns.                   
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_WORK_CONVERSION_H_FILE_GUARD
+#define LIB_EU_WORK_CONVERSION_H_FILE_GUARD
+
+#include "lib_bits_work.h"
+#include "lib_eu_work_metadata.h"
+
+#include <stddef.h>                     /// size_t
+#include <stdint.h>
+
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: Conversion                                                       
+///                                                                             
+///@brief   Scale, offset and range check a column of raw values.               
+///                                                                             
+///@par Conversion                                                              
+///         eu = raw * scale + offset.  A value is valid if it is within        
+///         [low, high]; one that is not (or is NaN) is clamped to the range    
+///         (NaN to low) and its bit in the validity bitmap is clear.  If       
+///         low is not less than high there is no range:  only NaN is invalid   
+///         and nothing is clamped.                                             
+///                                                                             
+///@par From MetaData                                                           
+///         The scale is MetaData::scale(); if that is 0, it is the weight of   
+///         the least significant bit (msbValue / 2^(bitCount - 1)); if that    
+///         is 0 too, 1.  MetaData has no offset, so the offset is 0.           
+///                                                                             
+///@par Validity Bitmap                                                         
+///         Bit (i % 8) of valid[i / 8] is value i's; the bitmap needs          
+///         bitmapSize(count) bytes.                                            
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::eu::work::Conversion conversion(*md);                          
+///                                                                             
+///         std::vector<double>  eu(raw.size());                                
+///         std::vector<uint8_t> valid(Conversion::bitmapSize(raw.size()));     
+///         size_t bad(conversion.convert(&eu[0], &valid[0], &raw[0], n));      
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class Conversion
+{
+    public:
+        using Simd = lib::bits::work::Simd;
+
+        Conversion();
+        Conversion(double scale, double offset, double low, double high);
+        explicit Conversion(MetaData const& md);
+        Conversion(const Conversion& that) = default;
+        Conversion& operator=(const Conversion& that) = default;
+        virtual ~Conversion() = default;
+
+        double scale()  const { return m_Scale; }
+        double offset() const { return m_Offset; }
+        double low()    const { return m_Low; }
+        double high()   const { return m_High; }
+        bool hasRange() const { return m_HasRange; }
+
+        size_t convert(
+            double*         eu
+          , uint8_t*        valid
+          , double const*   raw
+          , size_t          count
+          , Simd            simd = lib::bits::work::bestSimd()
+        ) const;
+
+        size_t convert(
+            double*         eu
+          , uint8_t*        valid
+          , int64_t const*  raw
+          , size_t          count
+          , Simd            simd = lib::bits::work::bestSimd()
+        ) const;
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the bytes a validity bitmap of count values needs.   
+        //----------------------------------------------------------------------
+        static size_t bitmapSize(size_t count) { return (count + 7) / 8; }
+
+    private:
+        double  m_Scale;
+        double  m_Offset;
+        double  m_Low;
+        double  m_High;
+        bool    m_HasRange;
+
+}; // class Conversion //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_WORK_CONVERSION_H_FILE_GUARD
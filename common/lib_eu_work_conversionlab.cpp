@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_conversionlab.cpp                                          
+///                                                                             
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_eu_work_conversionlab.h"
+#include "lib_ds_shared_ptr.h"
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+ConversionLab::ConversionLab()
+{
+} // ConversionLab::ConversionLab() //
+
+//------------------------------------------------------------------------------
+///@brief   Convert the column and push_back the result.                        
+///@note    A column without MetaData is passed through unconverted (each       
+///         value valid unless it is NaN).                                      
+//------------------------------------------------------------------------------
+void ConversionLab::put(lib::eu::ds::RawColumn const& column)
+{
+    Conversion conversion;
+
+    if (column.m_MetaData) {
+        MetaData const* key(column.m_MetaData.get());
+        auto found(m_Conversions.find(key));
+        if (found == m_Conversions.end()) {
+            Entry entry = { column.m_MetaData, Conversion(*key) };
+            found = m_Conversions.insert(std::make_pair(key, entry)).first;
+        }
+        conversion = found->second.m_Conversion;
+    }
+
+    const size_t count(column.m_Values.size());
+
+    lib::ds::shared_ptr<lib::eu::ds::EuColumn> result;
+    lib::new_shared(result);
+    result->m_MetaData = column.m_MetaData;
+    result->m_Values.resize(count);
+    result->m_Valid.resize(Conversion::bitmapSize(count));
+
+    if (count > 0) {
+        result->m_InvalidCount = conversion.convert(
+            &result->m_Values[0]
+          , &result->m_Valid[0]
+          , &column.m_Values[0]
+          , count
+        );
+    }
+
+    push_back(result);
+
+} // void ConversionLab::put(lib::eu::ds::RawColumn const& column) //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_conversionlab.h                                            
+///@brief Holds lib::eu::work::ConversionLab, which converts raw columns to     
+///       engineering units.                                                    
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_WORK_CONVERSIONLAB_H_FILE_GUARD
+#define LIB_EU_WORK_CONVERSIONLAB_H_FILE_GUARD
+
+#include "lib_eu_ds_column.h"
+#include "lib_eu_work_conversion.h"
+#include "lib_work_conversionlab.h"
+
+#include <map>
+#include <string>
+
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: ConversionLab                                                    
+///                                                                             
+///@brief   Convert each RawColumn put to an EuColumn using its parameter's     
+///         Conversion.                                                         
+///                                                                             
+///@par Purpose:                                                                
+///         The work half of lib::eu::msg::ConversionLab; it can also be used   
+///         on its own (put, then get).                                         
+///                                                                             
+///@note    A Conversion is made once per MetaData (the first time one of its   
+///         columns is put) and reused after that.                              
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ConversionLab
+    : public lib::work::ConversionLabByReference<
+        lib::eu::ds::RawColumn
+      , lib::eu::ds::EuColumn
+    >
+{
+    public:
+        ConversionLab();
+        virtual ~ConversionLab() = default;
+
+        void put(lib::eu::ds::RawColumn const& column) override;
+
+        std::string className() const override
+            { return "eu conversion lab"; }
+
+    private:
+        //----------------------------------------------------------------------
+        ///@brief   The conversions made so far; the MetaData is held so that   
+        ///         its address is not reused.                                  
+        //----------------------------------------------------------------------
+        struct Entry
+        {
+            ConstMetaDataPtr    m_MetaData;
+            Conversion          m_Conversion;
+        };
+
+        std::map<MetaData const*, Entry> m_Conversions;
+
+}; // class ConversionLab //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_WORK_CONVERSIONLAB_H_FILE_GUARD
@@ -0,0 +1,362 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_conversiontest.cpp                                         
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_eu_work_conversiontest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_ds_shared_ptr.h"
+#include "lib_eu_msg_conversionlab.h"
+#include "lib_eu_work_conversion.h"
+#include "lib_mp_work_threadable.h"
+#include "lib_mp_work_threadablecollection.h"
+#include "lib_msg_publisher.h"
+#include "lib_msg_subscriber.h"
+#include "lib_string.h"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lib {
+namespace eu {
+namespace work {
+namespace test {
+
+using Simd = lib::bits::work::Simd;
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::eu::work::test::ConversionTest);
+
+//------------------------------------------------------------------------------
+//  Raw values spread over (and past) -1000 to 1000, with a NaN and the         
+//  infinities mixed in.                                                        
+//------------------------------------------------------------------------------
+static std::vector<double> rawValues(size_t count)
+{
+    std::vector<double> result(count);
+
+    uint32_t seed(12345);
+    for (size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        result[i] = double(int32_t(seed >> 8) % 3000) / 2;
+    }
+
+    if (count > 20) {
+        result[5]  = std::numeric_limits<double>::quiet_NaN();
+        result[13] = std::numeric_limits<double>::infinity();
+        result[17] = -std::numeric_limits<double>::infinity();
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+//  The conversion written out the slow way.                                    
+//------------------------------------------------------------------------------
+static bool expected(Conversion const& c, double raw, double& eu)
+{
+    eu = raw * c.scale() + c.offset();
+    bool valid(!std::isnan(eu));
+
+    if (c.hasRange()) {
+        valid = valid && eu >= c.low() && eu <= c.high();
+        if (std::isnan(eu) || eu < c.low()) eu = c.low();
+        if (eu > c.high()) eu = c.high();
+    }
+
+    return valid;
+}
+
+//------------------------------------------------------------------------------
+//  Return the number of values that differ from expected.                      
+//------------------------------------------------------------------------------
+static int check(
+    Conversion const&               c
+  , std::vector<double> const&      raw
+  , std::vector<double> const&      eu
+  , std::vector<uint8_t> const&     valid
+  , size_t                          invalid
+)
+{
+    int errors(0);
+    size_t bad(0);
+
+    for (size_t i = 0; i < raw.size(); ++i) {
+        double e;
+        bool ok(expected(c, raw[i], e));
+        if (!ok) ++bad;
+
+        bool is_valid(((valid[i / 8] >> (i % 8)) & 1) != 0);
+        bool same(eu[i] == e || (std::isnan(eu[i]) && std::isnan(e)));
+        if (is_valid != ok || !same) ++errors;
+    }
+
+    if (bad != invalid) ++errors;
+
+    return errors;
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+class ColumnPublisher
+    : public lib::msg::Publisher<lib::eu::ds::RawColumn>
+    , public lib::mp::work::Threadable
+{
+    public:
+        ColumnPublisher(ConstMetaDataPtr md) : m_MetaData(md) { }
+
+        void operator()()
+        {
+            for (int c = 0; c < 3; ++c) {
+                lib::ds::shared_ptr<lib::eu::ds::RawColumn> column;
+                lib::new_shared(column);
+                column->m_MetaData = m_MetaData;
+                for (int v = 0; v < 10 + c; ++v) {
+                    column->m_Values.push_back(v * 100 - 300);
+                }
+                publish(column);
+            }
+
+            endPublication();
+        }
+
+    private:
+        ConstMetaDataPtr m_MetaData;
+};
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+class ColumnSubscriber
+    : public lib::msg::Subscriber<lib::eu::ds::EuColumn>
+    , public std::vector<lib::ds::shared_ptr<const lib::eu::ds::EuColumn> >
+{
+    public:
+        void process(lib::ds::shared_ptr<const lib::eu::ds::EuColumn>& c)
+        {
+            push_back(c);
+        }
+};
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+ConversionTest::ConversionTest() : Test("lib::eu::work::Conversion")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    ConversionTest object to copy.                              
+//------------------------------------------------------------------------------
+ConversionTest::ConversionTest(const ConversionTest& that) : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+ConversionTest::~ConversionTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+ConversionTest& ConversionTest::operator=(const ConversionTest& that)
+{
+    Test::operator=(that);
+    return *this;
+} // ConversionTest::operator=(const ConversionTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Check each kernel against the slow way, then the pipeline.           
+//------------------------------------------------------------------------------
+void ConversionTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  Scale from the MetaData.                                                
+    //--------------------------------------------------------------------------
+    MetaData scaled("s", "V", 1, 12, 16, 0.5, 0, -100, 100, true, DataType::Integer);
+    MetaData msb("m", "V", 1, 12, 16, 0, 1024, 0, 0, true, DataType::Integer);
+    MetaData plain("p", "V", 1, 12, 16, 0, 0, 0, 0, true, DataType::Integer);
+
+    TEST_IS_EQUAL(Conversion(scaled).scale(), 0.5);
+    TEST(Conversion(scaled).hasRange());
+    TEST_IS_EQUAL(Conversion(scaled).low(), -100);
+    TEST_IS_EQUAL(Conversion(msb).scale(), 0.5);     // 1024 / 2^11
+    TEST(!Conversion(msb).hasRange());
+    TEST_IS_EQUAL(Conversion(plain).scale(), 1);
+    TEST_IS_EQUAL(Conversion(plain).offset(), 0);
+
+    //--------------------------------------------------------------------------
+    //  Each kernel, with and without a range, over counts that do and do not   
+    //  fill the last bitmap byte.                                              
+    //--------------------------------------------------------------------------
+    const Conversion conversions[] = {
+        Conversion(0.25, 10, -200, 300)
+      , Conversion(-2, 0.5, -1000, 1000)
+      , Conversion(3, -7, 0, 0)                        // no range
+    };
+    const size_t counts[] = { 0, 1, 7, 8, 9, 31, 1003 };
+    const Simd simds[] = { Simd::portable, Simd::sse2, Simd::avx2 };
+
+    int errors(0);
+    for (Conversion const& c : conversions) {
+        for (size_t count : counts) {
+            std::vector<double> raw(rawValues(count));
+            std::vector<double> eu(count + 1, -1);
+            std::vector<uint8_t> valid(Conversion::bitmapSize(count) + 1, 0xAA);
+
+            for (Simd simd : simds) {
+                size_t invalid(c.convert(&eu[0], &valid[0], raw.data(), count, simd));
+                errors += check(c, raw, eu, valid, invalid);
+
+                if (eu[count] != -1) ++errors;          // nothing past the end
+                if (valid[Conversion::bitmapSize(count)] != 0xAA) ++errors;
+            }
+        }
+    }
+    TEST_IS_EQUAL(errors, 0);
+
+    //--------------------------------------------------------------------------
+    //  Integers go the same way as the doubles they convert to (more than one  
+    //  block's worth).                                                         
+    //--------------------------------------------------------------------------
+    {
+        Conversion c(0.125, 1, -50, 50);
+        std::vector<int64_t> integers(1000);
+        std::vector<double> raw(integers.size());
+        for (size_t i = 0; i < integers.size(); ++i) {
+            integers[i] = int64_t(i * 37 % 1001) - 500;
+            raw[i] = double(integers[i]);
+        }
+
+        std::vector<double> eu(raw.size());
+        std::vector<uint8_t> valid(Conversion::bitmapSize(raw.size()));
+        size_t invalid(c.convert(&eu[0], &valid[0], &integers[0], integers.size()));
+
+        TEST_IS_EQUAL(check(c, raw, eu, valid, invalid), 0);
+        TEST(invalid > 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  In a pipeline.                                                          
+    //--------------------------------------------------------------------------
+    {
+        ConstMetaDataPtr md(
+            new MetaData("p", "V", 1, 16, 16, 0.5, 0, -100, 200, true, DataType::Integer)
+        );
+
+        lib::mp::work::ThreadableCollection threads;
+
+        lib::ds::shared_ptr<ColumnPublisher> publisher;
+        lib::new_shared(publisher, md);
+        threads.push_back(publisher);
+
+        lib::eu::msg::ConversionLabPtr lab;
+        lib::new_shared(lab);
+        threads.push_back(lab);
+
+        lib::ds::shared_ptr<ColumnSubscriber> subscriber;
+        lib::new_shared(subscriber);
+        threads.push_back(subscriber);
+
+        publisher->connect(lab);
+        lab->connect(subscriber);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST_IS_EQUAL(subscriber->size(), 3);
+        if (subscriber->size() == 3) {
+            lib::eu::ds::EuColumn const& c(*subscriber->at(2));
+            TEST(c.m_MetaData.get() == md.get());
+            TEST_IS_EQUAL(c.m_Values.size(), 12);
+            TEST_IS_EQUAL(c.m_Values[0], -100);         // -300 * 0.5 clamped
+            TEST_IS_EQUAL(c.m_Values[1], -100);         // -200 * 0.5
+            TEST_IS_EQUAL(c.m_Values[11], 200);         //  800 * 0.5 clamped
+            TEST(!c.isValid(0));
+            TEST(c.isValid(1));
+            TEST(c.isValid(7));                         //  400 * 0.5
+            TEST(!c.isValid(8));
+            TEST_IS_EQUAL(c.m_InvalidCount, 5);
+        }
+    }
+
+} // void ConversionTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure each kernel against the slow way.                            
+//------------------------------------------------------------------------------
+void ConversionTest::runTest3()
+{
+    const size_t count(1 << 20);
+    const int passes(20);
+
+    Conversion c(0.25, 10, -200, 300);
+    std::vector<double> raw(rawValues(count));
+    std::vector<double> eu(count);
+    std::vector<uint8_t> valid(Conversion::bitmapSize(count));
+
+    size_t invalid(0);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; ++p) {
+        for (size_t i = 0; i < count; ++i) {
+            double e;
+            if (expected(c, raw[i], e)) {
+                valid[i / 8] |= uint8_t(1 << (i % 8));
+            } else {
+                valid[i / 8] &= uint8_t(~(1 << (i % 8)));
+                ++invalid;
+            }
+            eu[i] = e;
+        }
+    }
+    std::chrono::duration<double, std::nano> slow(
+        std::chrono::steady_clock::now() - start
+    );
+
+    const Simd simds[] = { Simd::portable, Simd::sse2, Simd::avx2 };
+    const char* names[] = { "portable", "sse2", "avx2" };
+    for (size_t s = 0; s < 3; ++s) {
+        size_t bad(0);
+        start = std::chrono::steady_clock::now();
+        for (int p = 0; p < passes; ++p) {
+            bad += c.convert(&eu[0], &valid[0], raw.data(), count, simds[s]);
+        }
+        std::chrono::duration<double, std::nano> fast(
+            std::chrono::steady_clock::now() - start
+        );
+
+        TEST_IS_EQUAL(bad, invalid);
+
+        output(
+            vSummary
+          , lib::format(
+                "%d values:  slow %6.3lf ns/value; %-8s %6.3lf ns/value"
+              , int(count)
+              , slow.count() / (double(count) * passes)
+              , names[s]
+              , fast.count() / (double(count) * passes)
+            )
+        );
+    }
+
+} // void ConversionTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace eu
+} // namespace lib
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_conversiontest.h                                           
+//------------------------------------------------------------------------------
+#ifndef LIB_EU_WORK_CONVERSIONTEST_H
+#define LIB_EU_WORK_CONVERSIONTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace eu {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: ConversionTest                                                   
+///                                                                             
+///@par Purpose:                                                                
+///         The ConversionTest class provides the regression test for the       
+///         lib::eu::work::Conversion and lib::eu::msg::ConversionLab classes.  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ConversionTest : public dev::test::work::Test {
+    public:
+        ConversionTest();
+        ConversionTest(const ConversionTest& that);
+        virtual ~ConversionTest();
+        ConversionTest& operator=(const ConversionTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class ConversionTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_EU_WORK_CONVERSIONTEST_H //
@@ -0,0 +1,136 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_decodeplan.cpp                                             
+///                                                                             
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_eu_work_decodeplan.h"
+#include "lib_bits_work.h"
+
+#include <algorithm>
+
+namespace lib {
+namespace eu {
+namespace work {
+
+static const uint32_t g_BitsPerByte(8);
+
+//------------------------------------------------------------------------------
+///@brief   Compile the parameters into decode steps.                           
+///@param   parameters  The parameters of the frame; the plan's Frame values    
+///                     are in the same order.                                  
+//------------------------------------------------------------------------------
+DecodePlan::DecodePlan(std::vector<ConstMetaDataPtr> const& parameters)
+    : m_Parameters(parameters)
+    , m_FrameSize(0)
+{
+    for (size_t p = 0; p < m_Parameters.size(); ++p)
+    {
+        MetaData const& md(*m_Parameters[p]);
+
+        if (   md.dataType() != DataType::Integer
+            || md.bitCount() == 0
+            || md.bitCount() > 64
+        ) {
+            continue;
+        }
+
+        const uint32_t msb(md.msbOffset());
+
+        Step step;
+        step.m_Byte     = msb / g_BitsPerByte;
+        step.m_Shift    = uint8_t(msb % g_BitsPerByte);
+        step.m_BitCount = uint8_t(md.bitCount());
+        step.m_End      = step.m_Byte
+                        + (step.m_Shift + step.m_BitCount + 7) / g_BitsPerByte;
+        step.m_Index    = uint32_t(p);
+        step.m_Sign     = md.isSigned()
+                        ? uint64_t(1) << (md.bitCount() - 1)
+                        : 0;
+
+        m_Steps.push_back(step);
+        m_FrameSize = std::max(m_FrameSize, size_t(step.m_End));
+    }
+
+    //--------------------------------------------------------------------------
+    //  Front to back through the frame.                                        
+    //--------------------------------------------------------------------------
+    std::sort(
+        m_Steps.begin()
+      , m_Steps.end()
+      , [](Step const& a, Step const& b) {
+            return a.m_Byte != b.m_Byte
+                 ? a.m_Byte < b.m_Byte
+                 : a.m_Index < b.m_Index;
+        }
+    );
+
+} // DecodePlan::DecodePlan() //
+
+//------------------------------------------------------------------------------
+///@brief   Decode every parameter of the frame into values.                    
+///@param   frame   The frame, laid out the way Value expects its data.         
+///@param   size    The number of bytes in the frame; parameters that do not    
+///                 fit are left invalid.                                       
+//------------------------------------------------------------------------------
+void DecodePlan::decode(void const* frame, size_t size, Frame& values) const
+{
+    const size_t count(m_Parameters.size());
+    if (values.m_Valid.size() != count)
+    {
+        values.m_Unsigned.assign(count, 0);
+        values.m_Integer.assign(count, 0);
+        values.m_Double.assign(count, 0.0);
+        values.m_Valid.assign(count, 0);
+    }
+
+    uint8_t const* bytes(static_cast<uint8_t const*>(frame));
+
+    for (size_t s = 0; s < m_Steps.size(); ++s)
+    {
+        Step const& step(m_Steps[s]);
+        const uint32_t i(step.m_Index);
+
+        if (step.m_End > size)
+        {
+            values.m_Unsigned[i] = 0;
+            values.m_Integer[i]  = 0;
+            values.m_Double[i]   = 0.0;
+            values.m_Valid[i]    = 0;
+            continue;
+        }
+
+        uint64_t u;
+        if (step.m_Byte + 8 <= size && step.m_Shift + step.m_BitCount <= 64)
+        {
+            u = (lib::bits::work::loadBigEndian64(bytes + step.m_Byte)
+                    << step.m_Shift
+                ) >> (64 - step.m_BitCount);
+        } else {
+            u = lib::bits::work::extractUnsigned(
+                bytes + step.m_Byte
+              , step.m_Shift
+              , step.m_BitCount
+            );
+        }
+
+        //----------------------------------------------------------------------
+        //  Flipping the sign bit and subtracting it sign extends (and leaves   
+        //  an unsigned value, whose m_Sign is 0, alone).                       
+        //----------------------------------------------------------------------
+        const int64_t integer(int64_t((u ^ step.m_Sign) - step.m_Sign));
+
+        values.m_Unsigned[i] = u;
+        values.m_Integer[i]  = integer;
+        values.m_Double[i]   = step.m_Sign != 0 ? double(integer) : double(u);
+        values.m_Valid[i]    = 1;
+    }
+
+} // void DecodePlan::decode() //
+
+} // namespace work //
+} // namespace eu //
+} // namespace lib //
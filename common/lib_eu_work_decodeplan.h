@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_decodeplan.h                                               
+///@brief Holds lib::eu::work::DecodePlan, a set of MetaData compiled for       
+///       decoding whole frames.                                                
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_WORK_DECODEPLAN_H_FILE_GUARD
+#define LIB_EU_WORK_DECODEPLAN_H_FILE_GUARD
+
+#include "lib_eu_work_metadata.h"
+
+#include <stdint.h>
+#include <stddef.h>                     /// size_t
+#include <vector>
+
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: DecodePlan                                                       
+///                                                                             
+///@brief   The parameters of a frame, compiled once so that every frame after  
+///         that is decoded in a single pass.                                   
+///                                                                             
+///@par Purpose:                                                                
+///         Decoding a frame through a Value per parameter works out each       
+///         parameter's word index and bit offset, and switches on its          
+///         DataType, for every sample.  The plan does that once:  each         
+///         Integer parameter becomes a step holding its byte offset, shift,    
+///         width and sign bit, and the steps are sorted by byte offset so      
+///         that a frame is read front to back.                                 
+///                                                                             
+///@par Decoded Values                                                          
+///         The values go into a DecodePlan::Frame, a struct of arrays indexed  
+///         like the MetaData the plan was made from.  They are the values a    
+///         Value would give:  m_Unsigned holds the field's bits, m_Integer     
+///         the field sign extended if the parameter is signed, and m_Double    
+///         the m_Integer (signed) or m_Unsigned (unsigned) value.              
+///         Parameters that are not Integers, or do not fit in the frame,       
+///         are 0 with m_Valid 0.                                               
+///                                                                             
+///@par Thread Safety:  object                                                  
+///         A plan can be shared by any number of threads, each decoding into   
+///         its own Frame.                                                      
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::eu::work::DecodePlan plan(parameters);                         
+///         lib::eu::work::DecodePlan::Frame values;                            
+///                                                                             
+///         while (read(frame)) {                                               
+///             plan.decode(&frame[0], frame.size(), values);                   
+///             ... values.m_Double[p] is parameters[p] ...                     
+///         }                                                                   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class DecodePlan
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   One frame's values, indexed like the plan's MetaData.       
+        //----------------------------------------------------------------------
+        struct Frame
+        {
+            std::vector<uint64_t>   m_Unsigned;
+            std::vector<int64_t>    m_Integer;
+            std::vector<double>     m_Double;
+            std::vector<uint8_t>    m_Valid;
+        };
+
+        explicit DecodePlan(std::vector<ConstMetaDataPtr> const& parameters);
+        DecodePlan(const DecodePlan& that) = default;
+        DecodePlan& operator=(const DecodePlan& that) = default;
+        virtual ~DecodePlan() = default;
+
+        size_t size() const { return m_Parameters.size(); }
+        ConstMetaDataPtr metaData(size_t index) const
+            { return m_Parameters[index]; }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the bytes a frame needs to hold every parameter.     
+        //----------------------------------------------------------------------
+        size_t frameSize() const { return m_FrameSize; }
+
+        void decode(void const* frame, size_t size, Frame& values) const;
+
+    private:
+        //----------------------------------------------------------------------
+        ///@brief   How to decode one parameter.                                
+        //----------------------------------------------------------------------
+        struct Step
+        {
+            uint32_t    m_Byte;         ///< The first byte of the field.
+            uint32_t    m_End;          ///< One past the last byte.
+            uint32_t    m_Index;        ///< Into the MetaData and the Frame.
+            uint8_t     m_Shift;        ///< Bits to skip in the first byte.
+            uint8_t     m_BitCount;
+            uint64_t    m_Sign;         ///< The sign bit; 0 if unsigned.
+        };
+
+        std::vector<ConstMetaDataPtr>   m_Parameters;
+        std::vector<Step>               m_Steps;
+        size_t                          m_FrameSize;
+
+}; // class DecodePlan //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_WORK_DECODEPLAN_H_FILE_GUARD
@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_decodeplantest.cpp                                         
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_eu_work_decodeplantest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_eu_work_decodeplan.h"
+#include "lib_eu_work_value.h"
+#include "lib_string.h"
+
+#include <chrono>
+
+namespace lib {
+namespace eu {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::eu::work::test::DecodePlanTest);
+
+//------------------------------------------------------------------------------
+//  A frame's worth of parameters:  words of 16 bits holding fields of 1 - 32   
+//  bits at assorted least significant bits, signed and not, with a Fixed       
+//  parameter mixed in.  Listed back to front so that the plan has to sort.     
+//------------------------------------------------------------------------------
+static std::vector<ConstMetaDataPtr> parameters(uint32_t words)
+{
+    std::vector<ConstMetaDataPtr> result;
+
+    for (uint32_t w = words; w >= 1; --w) {
+        uint32_t bits(1 + (w * 7) % 32);
+        uint32_t lsb(bits > 16 ? 16 : 16 - (w % (17 - bits)));
+        bool     is_signed((w % 3) == 0);
+        DataType type(w % 11 == 0 ? DataType::Fixed : DataType::Integer);
+
+        result.push_back(
+            ConstMetaDataPtr(
+                new MetaData(
+                    lib::format("p-%02d-%02d-%02d", w, bits, lsb)
+                  , "", w, bits, lsb, 1, 0, 0, 0, is_signed, type
+                )
+            )
+        );
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+DecodePlanTest::DecodePlanTest() : Test("lib::eu::work::DecodePlan")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    DecodePlanTest object to copy.                              
+//------------------------------------------------------------------------------
+DecodePlanTest::DecodePlanTest(const DecodePlanTest& that) : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+DecodePlanTest::~DecodePlanTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+DecodePlanTest& DecodePlanTest::operator=(const DecodePlanTest& that)
+{
+    Test::operator=(that);
+    return *this;
+} // DecodePlanTest::operator=(const DecodePlanTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Check the plan against a Value per parameter.                        
+//------------------------------------------------------------------------------
+void DecodePlanTest::runTest()
+{
+    std::vector<ConstMetaDataPtr> md(parameters(40));
+    DecodePlan plan(md);
+
+    TEST_IS_EQUAL(plan.size(), md.size());
+    TEST(plan.metaData(0).get() == md[0].get());
+    TEST_IS_EQUAL(plan.frameSize(), 82);    // word 40 is 25 bits:  2 words
+
+    std::vector<uint8_t> frame(plan.frameSize());
+    DecodePlan::Frame values;
+
+    int errors(0);
+    int invalid(0);
+    for (int f = 0; f < 10; ++f) {
+        for (size_t b = 0; b < frame.size(); ++b) {
+            frame[b] = uint8_t(b * 53 + f * 101 + 7);
+        }
+
+        plan.decode(&frame[0], frame.size(), values);
+        TEST_IS_EQUAL(values.m_Double.size(), md.size());
+
+        for (size_t p = 0; p < md.size(); ++p) {
+            if (md[p]->dataType() != DataType::Integer) {
+                if (values.m_Valid[p] != 0) ++errors;
+                ++invalid;
+                continue;
+            }
+
+            //------------------------------------------------------------------
+            //  Value's m_Double for a signed parameter goes through its        
+            //  m_Unsigned; the plan's is the signed value.                     
+            //------------------------------------------------------------------
+            Value v(md[p], frame);
+            double expected(
+                md[p]->isSigned()
+              ? double(int64_t(v.toInteger()))
+              : v.toDouble()
+            );
+            if (   values.m_Valid[p] != 1
+                || values.m_Unsigned[p] != v.toUnsigned()
+                || uint64_t(values.m_Integer[p]) != v.toInteger()
+                || values.m_Double[p] != expected
+            ) {
+                ++errors;
+            }
+        }
+    }
+    TEST_IS_EQUAL(errors, 0);
+    TEST_IS_EQUAL(invalid, 30);
+
+    //--------------------------------------------------------------------------
+    //  A short frame:  the parameters past its end are invalid.                
+    //--------------------------------------------------------------------------
+    plan.decode(&frame[0], 40, values);
+    int valid(0);
+    for (size_t p = 0; p < md.size(); ++p) {
+        if (values.m_Valid[p] == 0) continue;
+        ++valid;
+        if (md[p]->wordSequence() > 20) ++errors;
+    }
+    TEST(valid > 0);
+    TEST_IS_EQUAL(errors, 0);
+
+} // void DecodePlanTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure the plan against a Value per parameter.                      
+//------------------------------------------------------------------------------
+void DecodePlanTest::runTest3()
+{
+    std::vector<ConstMetaDataPtr> md(parameters(1000));
+    DecodePlan plan(md);
+
+    std::vector<uint8_t> frame(plan.frameSize());
+    for (size_t b = 0; b < frame.size(); ++b) frame[b] = uint8_t(b * 53 + 7);
+
+    const int frames(200);
+    uint64_t sum(0);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; ++f) {
+        for (size_t p = 0; p < md.size(); ++p) {
+            Value v(md[p], frame);
+            sum += v.toUnsigned();
+        }
+    }
+    std::chrono::duration<double, std::nano> values(
+        std::chrono::steady_clock::now() - start
+    );
+
+    DecodePlan::Frame decoded;
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; ++f) {
+        plan.decode(&frame[0], frame.size(), decoded);
+        for (size_t p = 0; p < md.size(); ++p) sum -= decoded.m_Unsigned[p];
+    }
+    std::chrono::duration<double, std::nano> planned(
+        std::chrono::steady_clock::now() - start
+    );
+
+    TEST(sum == 0);
+
+    const double samples(double(frames) * md.size());
+    output(
+        vSummary
+      , lib::format(
+            "%d parameters:  Value %6.2lf ns/sample; DecodePlan %6.2lf ns/sample"
+          , int(md.size())
+          , values.count() / samples
+          , planned.count() / samples
+        )
+    );
+
+} // void DecodePlanTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace eu
+} // namespace lib
+
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_decodeplantest.h                                           
+//------------------------------------------------------------------------------
+#ifndef LIB_EU_WORK_DECODEPLANTEST_H
+#define LIB_EU_WORK_DECODEPLANTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace eu {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: DecodePlanTest                                                   
+///                                                                             
+///@par Purpose:                                                                
+///         The DecodePlanTest class provides the regression test for the       
+///         lib::eu::work::DecodePlan class.                                    
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class DecodePlanTest : public dev::test::work::Test {
+    public:
+        DecodePlanTest();
+        DecodePlanTest(const DecodePlanTest& that);
+        virtual ~DecodePlanTest();
+        DecodePlanTest& operator=(const DecodePlanTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class DecodePlanTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_EU_WORK_DECODEPLANTEST_H //
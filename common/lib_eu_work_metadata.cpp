@@ -4,6 +4,8 @@
 ///                                                                             
 ///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
 ///                                                                             
+///@version 2026-10-16  DHF     Added msbOffset (from lib_eu_work_value.cpp).   
+///                                                                             
 ///@version 2020-08-27  DHF     File creation                                   
 ///                                                                             
 //------------------------------------------------------------------------------
@@ -14,6 +16,8 @@ namespace lib {
 namespace eu {
 namespace work {
 
+static const uint32_t g_WordSequenceOrigin(1);
+static const uint32_t g_BitsPerWord(16);
 
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
@@ -43,6 +47,22 @@ MetaData::MetaData(
 {
 }
 
+//------------------------------------------------------------------------------
+///@brief   Return the bit offset of the value's most significant bit from the  
+///         start of the data (the bit_offset for lib::bits::work::getUnsigned).
+//------------------------------------------------------------------------------
+uint32_t MetaData::msbOffset() const
+{
+    uint32_t word_index(
+        m_WordSequence
+      - g_WordSequenceOrigin
+      + (m_BitCount - 1) / g_BitsPerWord
+    );
+
+    return (word_index * g_BitsPerWord) + m_LeastSignificantBit - m_BitCount;
+
+} // uint32_t MetaData::msbOffset() const //
+
 
 } // namespace work //
 } // namespace eu //
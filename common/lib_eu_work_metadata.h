@@ -29,6 +29,8 @@ namespace work {
 ///     @code                                                                   
 ///     @endcode                                                                
 ///                                                                             
+///@version 2026-10-16  DHF     Added msbOffset.                                
+///                                                                             
 ///@version 2020-08-27  DHF     File creation                                   
 ///                                                                             
 //------------------------------------------------------------------------------
@@ -79,6 +81,8 @@ class MetaData
 
         DataType dataType()       const { return m_DataType; }
 
+        uint32_t msbOffset() const;
+
 
     protected:
 
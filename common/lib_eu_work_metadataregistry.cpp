@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_metadataregistry.cpp                                       
+///                                                                             
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_eu_work_metadataregistry.h"
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+MetaDataRegistry::MetaDataRegistry()
+{
+} // MetaDataRegistry::MetaDataRegistry() //
+
+//------------------------------------------------------------------------------
+///@brief   Add the MetaData (if it has not been already).                      
+///@return  The MetaData's index.                                               
+//------------------------------------------------------------------------------
+ParameterIndex MetaDataRegistry::add(ConstMetaDataPtr md)
+{
+    ParameterIndex index;
+    if (find(md.get(), index)) return index;
+
+    index = ParameterIndex(m_MetaData.size());
+    m_MetaData.push_back(md);
+    m_Indexes[md.get()] = index;
+
+    return index;
+
+} // ParameterIndex MetaDataRegistry::add(ConstMetaDataPtr md) //
+
+//------------------------------------------------------------------------------
+///@brief   Look up the index of MetaData that has been added.                  
+///@return  false if it has not been added.                                     
+//------------------------------------------------------------------------------
+bool MetaDataRegistry::find(MetaData const* md, ParameterIndex& index) const
+{
+    auto found(m_Indexes.find(md));
+    if (found == m_Indexes.end()) return false;
+
+    index = found->second;
+    return true;
+
+} // bool MetaDataRegistry::find() const //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
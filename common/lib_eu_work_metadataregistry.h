@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_metadataregistry.h                                         
+///@brief Holds lib::eu::work::MetaDataRegistry, which numbers MetaData so that 
+///       samples can refer to it by index.                                     
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_WORK_METADATAREGISTRY_H_FILE_GUARD
+#define LIB_EU_WORK_METADATAREGISTRY_H_FILE_GUARD
+
+#include "lib_eu_work_metadata.h"
+
+#include <map>
+#include <stdint.h>
+#include <stddef.h>                     /// size_t
+#include <vector>
+
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///@brief   The index of a parameter's MetaData in a MetaDataRegistry.          
+//------------------------------------------------------------------------------
+using ParameterIndex = uint32_t;
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: MetaDataRegistry                                                 
+///                                                                             
+///@brief   Number the parameters' MetaData 0, 1, 2, ... in the order they are  
+///         added.                                                              
+///                                                                             
+///@par Purpose:                                                                
+///         A PackedValue holds a ParameterIndex rather than a                  
+///         ConstMetaDataPtr:  4 bytes instead of 16, and no reference count    
+///         to update (atomically) every time a sample is copied.  The          
+///         registry holds the one reference to each MetaData.                  
+///                                                                             
+///@par Thread Safety:  object                                                  
+///         Fill the registry before sharing it; any number of threads can      
+///         then look MetaData up at once.                                      
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::eu::work::MetaDataRegistry registry;                           
+///         ParameterIndex voltage(registry.add(voltage_md));                   
+///                                                                             
+///         PackedValue v(PackedValue::fromDouble(voltage, 28.1));              
+///         std::cout << registry[v.parameter()].units();                       
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class MetaDataRegistry
+{
+    public:
+        MetaDataRegistry();
+        MetaDataRegistry(const MetaDataRegistry& that) = default;
+        MetaDataRegistry& operator=(const MetaDataRegistry& that) = default;
+        virtual ~MetaDataRegistry() = default;
+
+        ParameterIndex add(ConstMetaDataPtr md);
+        bool find(MetaData const* md, ParameterIndex& index) const;
+
+        size_t size() const { return m_MetaData.size(); }
+
+        ConstMetaDataPtr const& metaData(ParameterIndex index) const
+            { return m_MetaData[index]; }
+
+        MetaData const& operator[](ParameterIndex index) const
+            { return *m_MetaData[index]; }
+
+    private:
+        std::vector<ConstMetaDataPtr>               m_MetaData;
+        std::map<MetaData const*, ParameterIndex>   m_Indexes;
+
+}; // class MetaDataRegistry //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_WORK_METADATAREGISTRY_H_FILE_GUARD
@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_packedvalue.cpp                                            
+///                                                                             
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_eu_work_packedvalue.h"
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///@brief   Return the value as a (full) Value.                                 
+///@param   registry    The registry the value's parameter index is from.       
+//------------------------------------------------------------------------------
+Value PackedValue::toValue(MetaDataRegistry const& registry) const
+{
+    Value result(registry.metaData(m_Parameter));
+
+    switch (m_Kind) {
+        case Kind::unsignedInteger: result.setUnsigned(m_Payload);          break;
+        case Kind::signedInteger:   result.setInteger(int64_t(m_Payload));  break;
+        case Kind::real:            result.setDouble(bitsToDouble());       break;
+        default:                                                            break;
+    }
+
+    return result;
+
+} // Value PackedValue::toValue(MetaDataRegistry const& registry) const //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_packedvalue.h                                              
+///@brief Holds lib::eu::work::PackedValue, a 16 byte sample that refers to     
+///       its MetaData by index.                                                
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_WORK_PACKEDVALUE_H_FILE_GUARD
+#define LIB_EU_WORK_PACKEDVALUE_H_FILE_GUARD
+
+#include "lib_eu_work_metadataregistry.h"
+#include "lib_eu_work_value.h"
+
+#include <stdint.h>
+#include <string.h>                     /// memcpy
+
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: PackedValue                                                      
+///                                                                             
+///@brief   One parameter's value:  an 8 byte payload, what kind of number it   
+///         holds and the parameter's index in a MetaDataRegistry.              
+///                                                                             
+///@par Purpose:                                                                
+///         A Value is a ConstMetaDataPtr plus the value three ways (double,    
+///         unsigned and signed):  over 40 bytes, and every copy updates the    
+///         MetaData's reference count atomically.  A PackedValue holds the     
+///         value once (the kind says how to read it) and is 16 bytes of        
+///         plain data that copies with memcpy.                                 
+///                                                                             
+///@par Conversions                                                             
+///         Each kind converts to the others the way a C++ cast would; a        
+///         signed value read as unsigned is its two's complement bits.  A      
+///         none (default constructed) value is 0 whichever way it is read.     
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         PackedValue v(PackedValue::fromInteger(index, -3));                 
+///         Value       full(v.toValue(registry));                              
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class PackedValue
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   What the payload holds.                                     
+        //----------------------------------------------------------------------
+        enum class Kind : uint8_t
+        {
+            none            ///< Nothing; reads as 0.
+          , unsignedInteger ///< A uint64_t.
+          , signedInteger   ///< An int64_t.
+          , real            ///< A double's bits.
+        };
+
+        PackedValue() : m_Payload(0), m_Parameter(0), m_Kind(Kind::none) { }
+
+        PackedValue(ParameterIndex parameter, Kind kind, uint64_t payload)
+            : m_Payload(payload)
+            , m_Parameter(parameter)
+            , m_Kind(kind)
+        { }
+
+        static PackedValue fromUnsigned(ParameterIndex parameter, uint64_t u)
+            { return PackedValue(parameter, Kind::unsignedInteger, u); }
+
+        static PackedValue fromInteger(ParameterIndex parameter, int64_t i)
+            { return PackedValue(parameter, Kind::signedInteger, uint64_t(i)); }
+
+        static PackedValue fromDouble(ParameterIndex parameter, double d)
+        {
+            uint64_t bits;
+            memcpy(&bits, &d, sizeof(bits));
+            return PackedValue(parameter, Kind::real, bits);
+        }
+
+        ParameterIndex parameter() const { return m_Parameter; }
+        Kind kind() const { return m_Kind; }
+        uint64_t payload() const { return m_Payload; }
+
+        double toDouble() const
+        {
+            switch (m_Kind) {
+                case Kind::unsignedInteger: return double(m_Payload);
+                case Kind::signedInteger:   return double(int64_t(m_Payload));
+                case Kind::real:            return bitsToDouble();
+                default:                    return 0;
+            }
+        }
+
+        int64_t toInteger() const
+        {
+            switch (m_Kind) {
+                case Kind::unsignedInteger:
+                case Kind::signedInteger:   return int64_t(m_Payload);
+                case Kind::real:            return int64_t(bitsToDouble());
+                default:                    return 0;
+            }
+        }
+
+        uint64_t toUnsigned() const
+        {
+            return m_Kind == Kind::real
+                ? uint64_t(int64_t(bitsToDouble()))
+                : m_Kind == Kind::none ? 0 : m_Payload;
+        }
+
+        Value toValue(MetaDataRegistry const& registry) const;
+
+    private:
+        double bitsToDouble() const
+        {
+            double d;
+            memcpy(&d, &m_Payload, sizeof(d));
+            return d;
+        }
+
+        uint64_t        m_Payload;
+        ParameterIndex  m_Parameter;
+        Kind            m_Kind;
+
+}; // class PackedValue //
+
+static_assert(sizeof(PackedValue) == 16, "PackedValue should be 16 bytes");
+
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_WORK_PACKEDVALUE_H_FILE_GUARD
@@ -3,6 +3,11 @@
 ///                                                                             
 ///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
 ///                                                                             
+///@version 2026-10-16  DHF     Moved msbOffset to MetaData.                    
+///                                                                             
+///@version 2026-10-16  DHF     Added decodeColumn; msbOffset shared with       
+///                             setInternal.                                    
+///                                                                             
 ///@version 2020-08-27  DHF     File creation                                   
 ///                                                                             
 //------------------------------------------------------------------------------
@@ -17,10 +22,7 @@ namespace lib {
 namespace eu {
 namespace work {
 
-static const uint32_t g_WordSequenceOrigin(1);
 static const uint32_t g_BitsPerByte(8);
-static const uint32_t g_BitsPerWord(16);
-static const uint32_t g_BytesPerWord(g_BitsPerWord / g_BitsPerByte);
 
 static const uint32_t g_IntegerSizeBits(sizeof(uint64_t) * g_BitsPerByte);
 
@@ -69,7 +71,6 @@ void Value::setInternal(void const* p, size_t size)
 
     m_Double = m_Unsigned = m_Integer = 0;
 
-    uint32_t word_index(0);
     uint32_t msb_offset(0);
 
     switch(md.dataType())
@@ -80,11 +81,7 @@ void Value::setInternal(void const* p, size_t size)
             break;
 
         case DataType::Integer:
-            word_index = md.wordSequence() 
-                       - g_WordSequenceOrigin
-                       + (md.bitCount() - 1) / g_BitsPerWord
-            ;
-            msb_offset = (word_index * g_BitsPerWord) + md.lsb() - md.bitCount();
+            msb_offset = md.msbOffset();
             if (md.isSigned())
             {
                 lib::bits::work::getSigned(
@@ -125,7 +122,119 @@ void Value::setInternal(void const* p, size_t size)
     }
 }
 
+//------------------------------------------------------------------------------
+///@brief   Decode the md value from each frame into column (frame_count long). 
+///@return  false if md is not an Integer or its field does not fit in a frame. 
+//------------------------------------------------------------------------------
+static bool decodeColumn(
+    uint64_t*               column
+  , MetaData const&         md
+  , void const*             frames
+  , size_t                  frame_count
+  , size_t                  frame_size
+)
+{
+    if (   md.dataType() != DataType::Integer
+        || md.bitCount() == 0
+        || md.bitCount() > g_IntegerSizeBits
+        || uint64_t(md.msbOffset()) + md.bitCount()
+               > uint64_t(frame_size) * g_BitsPerByte
+    ) {
+        return false;
+    }
+
+    if (md.isSigned())
+    {
+        lib::bits::work::getSignedColumn(
+            reinterpret_cast<int64_t*>(column)
+          , frames
+          , frame_count
+          , frame_size
+          , md.msbOffset()
+          , md.bitCount()
+        );
+    } else {
+        lib::bits::work::getUnsignedColumn(
+            column
+          , frames
+          , frame_count
+          , frame_size
+          , md.msbOffset()
+          , md.bitCount()
+        );
+    }
+
+    return true;
+
+} // static bool decodeColumn(uint64_t* column, ...) //
+
+//------------------------------------------------------------------------------
+///@brief   Decode the md value from each of a run of fixed size frames.        
+///                                                                             
+///@par Purpose:                                                                
+///         Building a Value per frame to pull one parameter out of millions of 
+///         frames repeats the MetaData arithmetic for each frame.  This works  
+///         it out once and decodes the whole column with                       
+///         lib::bits::work::getSignedColumn / getUnsignedColumn (which use     
+///         SIMD where the machine has it).                                     
+///                                                                             
+///@param   column      Set to the frame_count values (sign extended if md is   
+///                     signed).                                                
+///@param   frames      The first frame; each frame is laid out the way Value   
+///                     expects its data.                                       
+///@param   frame_size  The number of bytes from one frame to the next.         
+///@return  false (and an empty column) if md is not an Integer or its field    
+///         does not fit in a frame.                                            
+//------------------------------------------------------------------------------
+bool decodeColumn(
+    std::vector<int64_t>&   column
+  , MetaData const&         md
+  , void const*             frames
+  , size_t                  frame_count
+  , size_t                  frame_size
+)
+{
+    column.resize(frame_count);
+
+    bool result(
+        decodeColumn(
+            reinterpret_cast<uint64_t*>(column.data())
+          , md
+          , frames
+          , frame_count
+          , frame_size
+        )
+    );
+    if (!result) column.clear();
+
+    return result;
+
+} // bool decodeColumn(std::vector<int64_t>& column, ...) //
+
+//------------------------------------------------------------------------------
+///@brief   Decode the md value from each of a run of fixed size frames.        
+///@note    A signed value's two's complement bits are sign extended to 64      
+///         bits.                                                               
+///@see     decodeColumn(std::vector<int64_t>&, ...)                            
+//------------------------------------------------------------------------------
+bool decodeColumn(
+    std::vector<uint64_t>&  column
+  , MetaData const&         md
+  , void const*             frames
+  , size_t                  frame_count
+  , size_t                  frame_size
+)
+{
+    column.resize(frame_count);
+
+    bool result(
+        decodeColumn(column.data(), md, frames, frame_count, frame_size)
+    );
+    if (!result) column.clear();
+
+    return result;
 
+} // bool decodeColumn(std::vector<uint64_t>& column, ...) //
 
 } // namespace work //
 } // namespace eu //
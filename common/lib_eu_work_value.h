@@ -77,6 +77,8 @@ namespace work {
 ///     @code                                                                   
 ///     @endcode                                                                
 ///                                                                             
+///@version 2026-10-16  DHF     Added decodeColumn.                             
+///                                                                             
 ///@version 2020-08-27  DHF     File creation                                   
 ///                                                                             
 //------------------------------------------------------------------------------
@@ -178,6 +180,22 @@ class Value
 using  ValuePtr = lib::ds::shared_ptr<Value>;
 using  ConstValuePtr = lib::ds::shared_ptr<const Value>;
 
+bool decodeColumn(
+    std::vector<int64_t>&   column
+  , MetaData const&         md
+  , void const*             frames
+  , size_t                  frame_count
+  , size_t                  frame_size
+);
+
+bool decodeColumn(
+    std::vector<uint64_t>&  column
+  , MetaData const&         md
+  , void const*             frames
+  , size_t                  frame_count
+  , size_t                  frame_size
+);
+
 } // namespace work
 } // namespace eu
 } // namespace lib
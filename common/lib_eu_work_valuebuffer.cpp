@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_valuebuffer.cpp                                            
+///                                                                             
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_eu_work_valuebuffer.h"
+
+#include <algorithm>
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+ValueBuffer::ValueBuffer()
+{
+} // ValueBuffer::ValueBuffer() //
+
+//------------------------------------------------------------------------------
+///@brief   Make room for count samples in every column.                        
+//------------------------------------------------------------------------------
+void ValueBuffer::reserve(size_t count)
+{
+    m_Times.reserve(count);
+    m_Payloads.reserve(count);
+    m_Parameters.reserve(count);
+    m_Kinds.reserve(count);
+
+} // void ValueBuffer::reserve(size_t count) //
+
+//------------------------------------------------------------------------------
+///@brief   Remove the samples (keeping the memory).                            
+//------------------------------------------------------------------------------
+void ValueBuffer::clear()
+{
+    m_Times.clear();
+    m_Payloads.clear();
+    m_Parameters.clear();
+    m_Kinds.clear();
+
+} // void ValueBuffer::clear() //
+
+//------------------------------------------------------------------------------
+///@brief   Add a sample taken at the given time.                               
+//------------------------------------------------------------------------------
+void ValueBuffer::push_back(
+    lib::time::work::DateTime const&    time
+  , PackedValue const&                  value
+)
+{
+    int64_t nano_seconds;
+    time.getNanoSeconds(nano_seconds);
+    push_back(nano_seconds, value);
+
+} // void ValueBuffer::push_back(DateTime const&, PackedValue const&) //
+
+//------------------------------------------------------------------------------
+///@brief   Return the time of sample index as a DateTime.                      
+//------------------------------------------------------------------------------
+lib::time::work::DateTime ValueBuffer::dateTime(size_t index) const
+{
+    lib::time::work::DateTime result;
+    result.setNanoSeconds(m_Times[index]);
+    return result;
+
+} // lib::time::work::DateTime ValueBuffer::dateTime(size_t index) const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the index of the first sample at or after the time.          
+///@note    The samples have to be in time order.                               
+//------------------------------------------------------------------------------
+size_t ValueBuffer::lowerBound(int64_t nano_seconds) const
+{
+    return size_t(
+        std::lower_bound(m_Times.begin(), m_Times.end(), nano_seconds)
+      - m_Times.begin()
+    );
+
+} // size_t ValueBuffer::lowerBound(int64_t nano_seconds) const //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
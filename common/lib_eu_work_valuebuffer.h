@@ -0,0 +1,127 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_valuebuffer.h                                              
+///@brief Holds lib::eu::work::ValueBuffer, a time series of PackedValues       
+///       stored a column per field.                                            
+///@par  Classification:  UNCLASSIFIED, OPEN SOURCE                             
+//------------------------------------------------------------------------------
+
+#ifndef LIB_EU_WORK_VALUEBUFFER_H_FILE_GUARD
+#define LIB_EU_WORK_VALUEBUFFER_H_FILE_GUARD
+
+#include "lib_eu_work_packedvalue.h"
+#include "lib_time_work_datetime.h"
+
+#include <stdint.h>
+#include <stddef.h>                     /// size_t
+#include <vector>
+
+
+namespace lib {
+namespace eu {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: ValueBuffer                                                      
+///                                                                             
+///@brief   Time stamped samples (time, parameter, kind, payload) held as four  
+///         parallel columns.                                                   
+///                                                                             
+///@par Purpose:                                                                
+///         Buffering millions of samples as Values (or even as PackedValues    
+///         next to a DateTime) spends most of the memory on padding and        
+///         pointers.  Here each field is its own array:  a sample costs 21     
+///         bytes, and a pass over one field (e.g., finding a time range or     
+///         summing the payloads of one parameter) reads only that field.       
+///                                                                             
+///@par Time                                                                    
+///         Times are nanoseconds since the DateTime epoch.  push_back and      
+///         dateTime convert to and from DateTime.                              
+///                                                                             
+///@note    Once the buffer has been reserve()d (or has grown to its working    
+///         size), push_back and clear do not allocate.                         
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::eu::work::ValueBuffer buffer;                                  
+///         buffer.reserve(1 << 20);                                            
+///                                                                             
+///         buffer.push_back(time, PackedValue::fromUnsigned(index, raw));      
+///         ...                                                                 
+///         for (size_t i = 0; i < buffer.size(); ++i) {                        
+///             if (buffer.parameter(i) == index) sum += buffer.at(i).toDouble();
+///         }                                                                   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ValueBuffer
+{
+    public:
+        ValueBuffer();
+        ValueBuffer(const ValueBuffer& that) = default;
+        ValueBuffer(ValueBuffer&& that) = default;
+        ValueBuffer& operator=(const ValueBuffer& that) = default;
+        virtual ~ValueBuffer() = default;
+
+        void reserve(size_t count);
+        void clear();
+
+        size_t size() const { return m_Times.size(); }
+        bool empty() const { return m_Times.empty(); }
+
+        void push_back(int64_t nano_seconds, PackedValue const& value)
+        {
+            m_Times.push_back(nano_seconds);
+            m_Payloads.push_back(value.payload());
+            m_Parameters.push_back(value.parameter());
+            m_Kinds.push_back(value.kind());
+        }
+
+        void push_back(
+            lib::time::work::DateTime const&    time
+          , PackedValue const&                  value
+        );
+
+        PackedValue at(size_t index) const
+        {
+            return PackedValue(
+                m_Parameters[index]
+              , m_Kinds[index]
+              , m_Payloads[index]
+            );
+        }
+
+        int64_t time(size_t index) const { return m_Times[index]; }
+        lib::time::work::DateTime dateTime(size_t index) const;
+        ParameterIndex parameter(size_t index) const
+            { return m_Parameters[index]; }
+
+        //----------------------------------------------------------------------
+        //  The columns themselves, for passes over one field.                  
+        //----------------------------------------------------------------------
+        std::vector<int64_t> const& times() const { return m_Times; }
+        std::vector<uint64_t> const& payloads() const { return m_Payloads; }
+        std::vector<ParameterIndex> const& parameters() const
+            { return m_Parameters; }
+        std::vector<PackedValue::Kind> const& kinds() const { return m_Kinds; }
+
+        size_t lowerBound(int64_t nano_seconds) const;
+
+    private:
+        std::vector<int64_t>            m_Times;
+        std::vector<uint64_t>           m_Payloads;
+        std::vector<ParameterIndex>     m_Parameters;
+        std::vector<PackedValue::Kind>  m_Kinds;
+
+}; // class ValueBuffer //
+
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+#endif // #ifndef LIB_EU_WORK_VALUEBUFFER_H_FILE_GUARD
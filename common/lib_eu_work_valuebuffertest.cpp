@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_valuebuffertest.cpp                                        
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_eu_work_valuebuffertest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_eu_work_metadataregistry.h"
+#include "lib_eu_work_packedvalue.h"
+#include "lib_eu_work_value.h"
+#include "lib_eu_work_valuebuffer.h"
+#include "lib_string.h"
+
+#include <chrono>
+
+namespace lib {
+namespace eu {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::eu::work::test::ValueBufferTest);
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static ConstMetaDataPtr parameter(const char* name, bool is_signed)
+{
+    return ConstMetaDataPtr(
+        new MetaData(
+            name, "V", 1, 16, 16, 1, 0, 0, 0, is_signed, DataType::Integer
+        )
+    );
+}
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+ValueBufferTest::ValueBufferTest() : Test("lib::eu::work::ValueBuffer")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    ValueBufferTest object to copy.                             
+//------------------------------------------------------------------------------
+ValueBufferTest::ValueBufferTest(const ValueBufferTest& that) : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+ValueBufferTest::~ValueBufferTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+ValueBufferTest& ValueBufferTest::operator=(const ValueBufferTest& that)
+{
+    Test::operator=(that);
+    return *this;
+} // ValueBufferTest::operator=(const ValueBufferTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Check the registry, the packed values and the buffer.                
+//------------------------------------------------------------------------------
+void ValueBufferTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  MetaDataRegistry                                                        
+    //--------------------------------------------------------------------------
+    MetaDataRegistry registry;
+    ConstMetaDataPtr volts(parameter("volts", true));
+    ConstMetaDataPtr count(parameter("count", false));
+
+    TEST_IS_EQUAL(registry.add(volts), 0);
+    TEST_IS_EQUAL(registry.add(count), 1);
+    TEST_IS_EQUAL(registry.add(volts), 0);          // already there
+    TEST_IS_EQUAL(registry.size(), 2);
+    TEST(registry.metaData(1).get() == count.get());
+    TEST_IS_EQUAL(registry[0].name(), "volts");
+
+    ParameterIndex index(99);
+    TEST(registry.find(count.get(), index));
+    TEST_IS_EQUAL(index, 1);
+    TEST(!registry.find(nullptr, index));
+
+    //--------------------------------------------------------------------------
+    //  PackedValue                                                             
+    //--------------------------------------------------------------------------
+    TEST_IS_EQUAL(sizeof(PackedValue), 16);
+
+    PackedValue none;
+    TEST(none.kind() == PackedValue::Kind::none);
+    TEST_IS_EQUAL(none.toDouble(), 0);
+    TEST_IS_EQUAL(none.toUnsigned(), 0);
+
+    PackedValue s(PackedValue::fromInteger(0, -3));
+    TEST(s.kind() == PackedValue::Kind::signedInteger);
+    TEST_IS_EQUAL(s.parameter(), 0);
+    TEST_IS_EQUAL(s.toInteger(), -3);
+    TEST_IS_EQUAL(s.toDouble(), -3);
+    TEST_IS_EQUAL(s.toUnsigned(), uint64_t(-3));
+
+    PackedValue u(PackedValue::fromUnsigned(1, 0xFFFFFFFFFFFFFFFFull));
+    TEST_IS_EQUAL(u.toUnsigned(), 0xFFFFFFFFFFFFFFFFull);
+    TEST_IS_EQUAL(u.toInteger(), -1);
+    TEST_IS_EQUAL(u.toDouble(), 18446744073709551615.0);
+
+    PackedValue d(PackedValue::fromDouble(1, -2.75));
+    TEST(d.kind() == PackedValue::Kind::real);
+    TEST_IS_EQUAL(d.toDouble(), -2.75);
+    TEST_IS_EQUAL(d.toInteger(), -2);
+
+    Value v(s.toValue(registry));
+    TEST(v.metaData().get() == volts.get());
+    TEST_IS_EQUAL(int64_t(v.toInteger()), -3);
+    TEST_IS_EQUAL(d.toValue(registry).toDouble(), -2.75);
+
+    //--------------------------------------------------------------------------
+    //  ValueBuffer                                                             
+    //--------------------------------------------------------------------------
+    ValueBuffer buffer;
+    TEST(buffer.empty());
+    buffer.reserve(100);
+
+    for (int i = 0; i < 100; ++i) {
+        buffer.push_back(
+            int64_t(i) * 1000
+          , i % 2 ? PackedValue::fromUnsigned(1, i) : PackedValue::fromInteger(0, -i)
+        );
+    }
+    TEST_IS_EQUAL(buffer.size(), 100);
+    TEST_IS_EQUAL(buffer.times().size(), 100);
+    TEST_IS_EQUAL(buffer.time(7), 7000);
+    TEST_IS_EQUAL(buffer.parameter(7), 1);
+    TEST_IS_EQUAL(buffer.at(7).toUnsigned(), 7);
+    TEST_IS_EQUAL(buffer.at(8).toInteger(), -8);
+    TEST(buffer.at(8).kind() == PackedValue::Kind::signedInteger);
+    TEST_IS_EQUAL(buffer.lowerBound(6500), 7);
+    TEST_IS_EQUAL(buffer.lowerBound(7000), 7);
+    TEST_IS_EQUAL(buffer.lowerBound(1000000), 100);
+
+    lib::time::work::DateTime when;
+    when.setSeconds(1234.5);
+    buffer.push_back(when, PackedValue::fromDouble(1, 1.5));
+    TEST_IS_EQUAL(buffer.time(100), 1234500000000ll);
+    TEST(buffer.dateTime(100) == when);
+    TEST_IS_EQUAL(buffer.at(100).toDouble(), 1.5);
+
+    const int64_t* before(&buffer.times()[0]);
+    buffer.clear();
+    TEST(buffer.empty());
+    buffer.push_back(0, PackedValue());
+    TEST(&buffer.times()[0] == before);             // memory kept
+
+} // void ValueBufferTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure buffering Values against a ValueBuffer.                      
+//------------------------------------------------------------------------------
+void ValueBufferTest::runTest3()
+{
+    MetaDataRegistry registry;
+    std::vector<ConstMetaDataPtr> md;
+    for (int p = 0; p < 16; ++p) {
+        md.push_back(parameter(lib::format("p%d", p).c_str(), false));
+        registry.add(md.back());
+    }
+
+    const size_t count(1 << 20);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Value> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        values.push_back(Value(md[i % md.size()], uint64_t(i)));
+    }
+    uint64_t sum(0);
+    for (size_t i = 0; i < count; ++i) sum += values[i].toUnsigned();
+    std::chrono::duration<double, std::nano> full(
+        std::chrono::steady_clock::now() - start
+    );
+
+    start = std::chrono::steady_clock::now();
+    ValueBuffer buffer;
+    buffer.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        buffer.push_back(
+            int64_t(i)
+          , PackedValue::fromUnsigned(ParameterIndex(i % md.size()), i)
+        );
+    }
+    for (size_t i = 0; i < count; ++i) sum -= buffer.payloads()[i];
+    std::chrono::duration<double, std::nano> packed(
+        std::chrono::steady_clock::now() - start
+    );
+
+    TEST(sum == 0);
+
+    output(
+        vSummary
+      , lib::format(
+            "%d samples:  Value %6.2lf ns, %d bytes/sample; "
+            "ValueBuffer %6.2lf ns, %d bytes/sample"
+          , int(count)
+          , full.count() / count
+          , int(sizeof(Value))
+          , packed.count() / count
+          , int(
+                sizeof(int64_t) + sizeof(uint64_t)
+              + sizeof(ParameterIndex) + sizeof(PackedValue::Kind)
+            )
+        )
+    );
+
+} // void ValueBufferTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace eu
+} // namespace lib
@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+///@file lib_eu_work_valuebuffertest.h                                          
+//------------------------------------------------------------------------------
+#ifndef LIB_EU_WORK_VALUEBUFFERTEST_H
+#define LIB_EU_WORK_VALUEBUFFERTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace eu {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: ValueBufferTest                                                  
+///                                                                             
+///@par Purpose:                                                                
+///         The ValueBufferTest class provides the regression test for the      
+///         lib::eu::work::ValueBuffer, PackedValue and MetaDataRegistry        
+///         classes.                                                            
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ValueBufferTest : public dev::test::work::Test {
+    public:
+        ValueBufferTest();
+        ValueBufferTest(const ValueBufferTest& that);
+        virtual ~ValueBufferTest();
+        ValueBufferTest& operator=(const ValueBufferTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class ValueBufferTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace eu
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_EU_WORK_VALUEBUFFERTEST_H //
@@ -105,8 +105,72 @@ void ValueTest::runTest()
         TEST(v.toString(3,2) == "0.0 in");
         TEST(v.toString(Value::COMMA, 3, 2) == "0.0,in");
     }
+
+    columns();
 } 
 
+//------------------------------------------------------------------------------
+/// @brief Test decodeColumn against Value.                                     
+//------------------------------------------------------------------------------
+void ValueTest::columns()
+{
+    MetaData integer("int-02-12-16", "yd", 2, 12, 16, 0, 0, 0, 0, true,
+                     work::DataType::Integer);
+    MetaData unsign("uns-03-16-16", "mi", 3, 16, 16, 0, 0, 0, 0, false,
+                    work::DataType::Integer);
+    MetaData fixed("fixed-01-16-00", "in", 1, 16, 0, 0, 0, 0, 0, true,
+                   work::DataType::Fixed);
+
+    //--------------------------------------------------------------------------
+    //  100 frames of 4 words each.                                             
+    //--------------------------------------------------------------------------
+    const size_t frame_count(100);
+    const size_t frame_size(8);
+    std::vector<uint8_t> frames(frame_count * frame_size);
+    for (size_t b = 0; b < frames.size(); ++b) frames[b] = uint8_t(b * 29 + 3);
+
+    std::vector<int64_t>  signed_column;
+    std::vector<uint64_t> unsigned_column;
+
+    TEST(
+        decodeColumn(
+            signed_column, integer, frames.data(), frame_count, frame_size
+        )
+    );
+    TEST(
+        decodeColumn(
+            unsigned_column, unsign, frames.data(), frame_count, frame_size
+        )
+    );
+    TEST_IS_EQUAL(signed_column.size(), frame_count);
+    TEST_IS_EQUAL(unsigned_column.size(), frame_count);
+
+    int errors(0);
+    for (size_t f = 0; f < frame_count; ++f) {
+        std::vector<uint8_t> frame(
+            frames.begin() + f * frame_size
+          , frames.begin() + (f + 1) * frame_size
+        );
+
+        //----------------------------------------------------------------------
+        //  Word 2 holds a 12-bit signed value in its low bits; word 3 is the   
+        //  16-bit unsigned value.                                              
+        //----------------------------------------------------------------------
+        int64_t word2(int64_t(frame[2]) << 8 | frame[3]);
+        int64_t expected((word2 & 0x7FF) - (word2 & 0x800));
+        if (signed_column[f] != expected) ++errors;
+
+        Value u(ConstMetaDataPtr(new MetaData(unsign)), frame);
+        if (unsigned_column[f] != u.toUnsigned()) ++errors;
+    }
+    TEST_IS_EQUAL(errors, 0);
+
+    TEST(!decodeColumn(signed_column, fixed, frames.data(), 10, frame_size));
+    TEST(signed_column.empty());
+    TEST(!decodeColumn(signed_column, unsign, frames.data(), 10, 4));
+
+} // void ValueTest::columns() //
+
 
 
 } // namespace test 
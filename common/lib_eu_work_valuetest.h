@@ -21,6 +21,8 @@ namespace test {
 ///                                                                             
 ///@author  Make Test Utility       MTU     Utility by DHF                      
 ///                                                                             
+///@version 2026-10-16  DHF     Added columns.                                  
+///                                                                             
 ///@version 2020-09-01  flatman     File creation via Make Test Utility         
 ///                                                                             
 //------------------------------------------------------------------------------
@@ -34,6 +36,8 @@ class ValueTest : public dev::test::work::Test {
     protected:
         void runTest();
 
+        void columns();
+
     private:
 
 
@@ -22,6 +22,13 @@
 ///             components go together with:                                    
 ///                 (sign ? -1 : 1) * mantissa * pow(2, exponent);              
 ///                                                                             
+///@version 2026-10-16  DHF     The values are taken whole (a word at a time)   
+///                             and converted by the hardware instead of being  
+///                             rebuilt from an exponent and mantissa fetched   
+///                             separately; zero, subnormals, infinities and    
+///                             NaN now come out right.  Added the bulk         
+///                             getFloat16/32/64 (F16C when the CPU has it).    
+///                                                                             
 ///@version 2020-09-02  DHF     File creation                                   
 ///                                                                             
 //------------------------------------------------------------------------------
@@ -33,6 +40,15 @@
 #include <stdint.h>
 #include <string.h>                 // memcpy
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#define LIB_IEEE_TS754_WORK_F16C
+#include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <stdlib.h>                 // _byteswap_ushort ...
+#endif
+
 
 namespace lib {
 namespace ieee {
@@ -43,103 +59,192 @@ namespace ieee {
 namespace ts754 {
 namespace work {
 
-//==============================================================================
-//      If there is need for this elsewhere in the code, it can probably be put 
-//      into a header ... but for now, I don't think it is required elsewhere.  
-//                                                                              
-//      These are basic facts about the internal CPU double layout and also map 
-//      to IEEE 754 64-bit floating point number.                               
-//==============================================================================
-union DoubleBitLayout
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+static const ByteOrder g_HostOrder(ByteOrder::bigEndian);
+#else
+static const ByteOrder g_HostOrder(ByteOrder::littleEndian);
+#endif
+
+//------------------------------------------------------------------------------
+//  Byte swaps (a single instruction on the compilers we use).                  
+//------------------------------------------------------------------------------
+static inline uint16_t swapBytes(uint16_t v)
 {
-    double  m_Double;
+    #ifdef _MSC_VER
+    return _byteswap_ushort(v);
+    #else
+    return __builtin_bswap16(v);
+    #endif
+}
 
-    struct 
-    {
-        #ifdef HIGH_BIT_FIRST
-            uint64_t    m_IsNegative:1;
-            uint64_t    m_Exponent:11;
-            uint64_t    m_Mantissa:52;
-        #else
-            uint64_t    m_Mantissa:52;
-            uint64_t    m_Exponent:11;
-            uint64_t    m_IsNegative:1;
-        #endif
-    };
-};
-
-static const uint64_t g_MantissaSize(52);
-
-
-//------------------------------------------------------------------------------
-///@brief   Pull the bits from the memory and convert to a double based on the  
-///         parameters given.                                                   
-///@param   answer      The 64-bit double to receive the value.                 
-///@param   memory      Pointer to the memory holding the floating point value. 
-///@param   bit_offset  The number of bits to skip in memory to get to the      
-///                     first bit of the floating point number.                 
-///@param   exp_size    The number of bits in the exponent.                     
-///@param   man_size    The number of bits in the mantissa.                     
-//------------------------------------------------------------------------------
-static bool getFloatInternal(
-    double&         answer
-  , void const*     memory
-  , uint64_t        bit_offset
-  , uint64_t        exp_size
-  , uint64_t        man_size
-)
+static inline uint32_t swapBytes(uint32_t v)
 {
-    answer = 0;
+    #ifdef _MSC_VER
+    return _byteswap_ulong(v);
+    #else
+    return __builtin_bswap32(v);
+    #endif
+}
 
-    uint64_t    exponent(0);
-    uint64_t    mantissa(0);
+static inline uint64_t swapBytes(uint64_t v)
+{
+    #ifdef _MSC_VER
+    return _byteswap_uint64(v);
+    #else
+    return __builtin_bswap64(v);
+    #endif
+}
 
-    //--------------------------------------------------------------------------
-    //  The exponent bias is effectively binary all ones except the high bit.   
-    //  We have to convent the exponent from having the source bias to having   
-    //  the double's bias (ten bits set to 1).                                  
-    //--------------------------------------------------------------------------
-    static const uint64_t double_bias(0x3FF);       // 10 bits on   
+//------------------------------------------------------------------------------
+///@brief   Return the UNSIGNED (uint16_t, uint32_t or uint64_t) at memory      
+///         (any alignment) held in the given byte order.                       
+//------------------------------------------------------------------------------
+template <typename UNSIGNED>
+static inline UNSIGNED load(uint8_t const* memory, ByteOrder order)
+{
+    UNSIGNED u;
+    memcpy(&u, memory, sizeof(u));
+    return order == g_HostOrder ? u : swapBytes(u);
+}
 
-    uint64_t exponent_bias((~uint64_t(0)) >> (65-exp_size));
+//------------------------------------------------------------------------------
+///@brief   Return the big endian UNSIGNED that starts bit_offset bits into     
+///         memory.                                                             
+///@note    A value that starts on a byte boundary is a memcpy and a byte swap. 
+//------------------------------------------------------------------------------
+template <typename UNSIGNED>
+static inline UNSIGNED loadBits(void const* memory, uint64_t bit_offset)
+{
+    uint8_t const* bytes(static_cast<uint8_t const*>(memory));
 
-    bool result = lib::bits::work::getUnsigned(
-        exponent
-      , memory
-      , bit_offset+1                // + 1 to skip sign bit
-      , exp_size
-    );
+    if (bit_offset % 8 == 0)
+    {
+        return load<UNSIGNED>(bytes + bit_offset / 8, ByteOrder::bigEndian);
+    }
 
-    exponent += double_bias - exponent_bias;
+    uint64_t u;
+    lib::bits::work::getUnsigned<sizeof(UNSIGNED) * 8>(u, memory, bit_offset);
+    return UNSIGNED(u);
+}
 
+//------------------------------------------------------------------------------
+///@brief   Return the double for the bits of a float.                          
+//------------------------------------------------------------------------------
+static inline double singleToDouble(uint32_t bits)
+{
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
 
+//------------------------------------------------------------------------------
+///@brief   Return the double for the bits of a double.                         
+//------------------------------------------------------------------------------
+static inline double doubleToDouble(uint64_t bits)
+{
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
 
-    //--------------------------------------------------------------------------
-    //  The mantissa needs to be shoved as far as it can to the                 
-    //  left ...                                                                
-    //--------------------------------------------------------------------------
-    result = result && lib::bits::work::getUnsigned(
-        mantissa
-      , memory
-      , bit_offset+1+exp_size       //  skip sign and exponent
-      , man_size
-    );
+//------------------------------------------------------------------------------
+///@brief   Return the value of an IEEE 754 half precision (16-bit) float.      
+///                                                                             
+///@par Design                                                                  
+///         The half's exponent and mantissa are moved into a float's places    
+///         and the exponent rebiased (15 to 127).  Infinity and NaN need the   
+///         float's all ones exponent instead; a subnormal half (exponent 0) is 
+///         a normal float, so it is built as if it had the implied 1 and then  
+///         has that 1 subtracted back out.                                     
+//------------------------------------------------------------------------------
+double halfToDouble(uint16_t half)
+{
+    static const uint32_t rebias((127 - 15) << 23);
+    static const uint32_t infinity(0x1F << 23);             // after the shift
 
-    mantissa = mantissa << (g_MantissaSize - man_size);
+    uint32_t bits((uint32_t(half) & 0x7FFF) << 13);
+    const uint32_t exponent(bits & infinity);
 
-    DoubleBitLayout dbl;
-    dbl.m_IsNegative = lib::bits::work::isBitSet(memory, bit_offset);
-    dbl.m_Exponent = exponent;
-    dbl.m_Mantissa = mantissa;
+    bits += rebias;
 
-    if (result)
+    float f;
+    if (exponent == infinity)
     {
-        answer = dbl.m_Double;
+        bits += rebias;                 // all ones:  infinity or NaN
+        memcpy(&f, &bits, sizeof(f));
+    } else if (exponent == 0) {
+        bits += 1 << 23;                // the implied 1 ...
+        memcpy(&f, &bits, sizeof(f));
+
+        uint32_t one(rebias + (1 << 23));
+        float implied;
+        memcpy(&implied, &one, sizeof(implied));
+        f -= implied;                   // ... taken back out
+    } else {
+        memcpy(&f, &bits, sizeof(f));
     }
 
-    return result;
+    return (half & 0x8000) ? -double(f) : double(f);
+
+} // double halfToDouble(uint16_t half) //
+
+//------------------------------------------------------------------------------
+///@brief   Return true if the CPU has the F16C (half float conversion)         
+///         instructions.                                                       
+//------------------------------------------------------------------------------
+bool hasF16c()
+{
+    #ifdef LIB_IEEE_TS754_WORK_F16C
+    static const bool s_HasF16c(
+        (__builtin_cpu_init(), __builtin_cpu_supports("f16c") != 0)
+     && __builtin_cpu_supports("avx") != 0
+    );
+    return s_HasF16c;
+    #else
+    return false;
+    #endif
 }
 
+#ifdef LIB_IEEE_TS754_WORK_F16C
+//------------------------------------------------------------------------------
+///@brief   Convert halves eight at a time with F16C.                           
+///@return  The number converted (a multiple of 8).                             
+//------------------------------------------------------------------------------
+__attribute__((target("avx,f16c")))
+static size_t halvesF16c(
+    double*         results
+  , uint8_t const*  memory
+  , size_t          count
+  , bool            swap
+)
+{
+    const __m128i swap_mask(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+    );
+
+    size_t h(0);
+    for (; h + 8 <= count; h += 8)
+    {
+        __m128i halves(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(memory + 2 * h))
+        );
+        if (swap) halves = _mm_shuffle_epi8(halves, swap_mask);
+
+        __m256 floats(_mm256_cvtph_ps(halves));
+        _mm256_storeu_pd(
+            results + h
+          , _mm256_cvtps_pd(_mm256_castps256_ps128(floats))
+        );
+        _mm256_storeu_pd(
+            results + h + 4
+          , _mm256_cvtps_pd(_mm256_extractf128_ps(floats, 1))
+        );
+    }
+
+    return h;
+
+} // static size_t halvesF16c() //
+#endif
 
 //------------------------------------------------------------------------------
 ///@brief   Return the 16-bit floating point number held at the given bit       
@@ -152,14 +257,8 @@ static bool getFloatInternal(
 //------------------------------------------------------------------------------
 bool getFloat16(double& result, void const* memory, uint64_t bit_offset)
 {
-    bool answer = getFloatInternal(
-        result
-      , memory
-      , bit_offset
-      , 5
-      , 10
-    );
-    return answer;
+    result = halfToDouble(loadBits<uint16_t>(memory, bit_offset));
+    return true;
 }
 
 
@@ -174,13 +273,8 @@ bool getFloat16(double& result, void const* memory, uint64_t bit_offset)
 //------------------------------------------------------------------------------
 bool getFloat32(double& result, void const* memory, uint64_t bit_offset)
 {
-    return getFloatInternal(
-        result
-      , memory
-      , bit_offset
-      , 8
-      , 23
-    );
+    result = singleToDouble(loadBits<uint32_t>(memory, bit_offset));
+    return true;
 }
 
 //------------------------------------------------------------------------------
@@ -194,17 +288,104 @@ bool getFloat32(double& result, void const* memory, uint64_t bit_offset)
 //------------------------------------------------------------------------------
 bool getFloat64(double& answer, void const* memory, uint64_t bit_offset)
 {
-    uint64_t u64;
+    answer = doubleToDouble(loadBits<uint64_t>(memory, bit_offset));
+    return true;
+}
+
+//------------------------------------------------------------------------------
+///@brief   Convert an array of count 16-bit floats to doubles.                 
+///@param   results     Where to put the count doubles.                         
+///@param   memory      The floats, one after the other (any alignment).        
+///@param   order       The byte order of the floats.                           
+///@note    Uses F16C (8 at a time) when the CPU has it.                        
+//------------------------------------------------------------------------------
+void getFloat16(
+    double*     results
+  , void const* memory
+  , size_t      count
+  , ByteOrder   order
+)
+{
+    uint8_t const* bytes(static_cast<uint8_t const*>(memory));
+    size_t h(0);
 
-    bool result = lib::bits::work::getUnsigned(u64, memory, bit_offset, 64);
-    memcpy(&answer, &u64, sizeof(answer));
+    #ifdef LIB_IEEE_TS754_WORK_F16C
+    if (hasF16c())
+    {
+        h = halvesF16c(results, bytes, count, order != g_HostOrder);
+    }
+    #endif
 
-    return result;
-}
+    for (; h < count; ++h)
+    {
+        results[h] = halfToDouble(load<uint16_t>(bytes + 2 * h, order));
+    }
+
+} // void getFloat16(double* results, ...) //
+
+//------------------------------------------------------------------------------
+///@brief   Convert an array of count 32-bit floats to doubles.                 
+///@note    A plain loop of load, swap and convert, which the compiler          
+///         vectorizes.                                                         
+///@see     getFloat16(double*, void const*, size_t, ByteOrder)                 
+//------------------------------------------------------------------------------
+void getFloat32(
+    double*     results
+  , void const* memory
+  , size_t      count
+  , ByteOrder   order
+)
+{
+    uint8_t const* bytes(static_cast<uint8_t const*>(memory));
+
+    if (order == g_HostOrder)
+    {
+        for (size_t f = 0; f < count; ++f)
+        {
+            uint32_t u;
+            memcpy(&u, bytes + 4 * f, sizeof(u));
+            results[f] = singleToDouble(u);
+        }
+    } else {
+        for (size_t f = 0; f < count; ++f)
+        {
+            uint32_t u;
+            memcpy(&u, bytes + 4 * f, sizeof(u));
+            results[f] = singleToDouble(swapBytes(u));
+        }
+    }
+
+} // void getFloat32(double* results, ...) //
+
+//------------------------------------------------------------------------------
+///@brief   Convert an array of count 64-bit floats to doubles.                 
+///@see     getFloat32(double*, void const*, size_t, ByteOrder)                 
+//------------------------------------------------------------------------------
+void getFloat64(
+    double*     results
+  , void const* memory
+  , size_t      count
+  , ByteOrder   order
+)
+{
+    uint8_t const* bytes(static_cast<uint8_t const*>(memory));
+
+    if (order == g_HostOrder)
+    {
+        memcpy(results, bytes, count * sizeof(double));
+    } else {
+        for (size_t d = 0; d < count; ++d)
+        {
+            uint64_t u;
+            memcpy(&u, bytes + 8 * d, sizeof(u));
+            results[d] = doubleToDouble(swapBytes(u));
+        }
+    }
+
+} // void getFloat64(double* results, ...) //
 
 
 } // namespace work //
 } // namespace ts754 //
 } // namespace ieee //
 } // namespace lib //
-
@@ -49,6 +49,9 @@
 ///     @code                                                                   
 ///     @endcode                                                                
 ///                                                                             
+///@version 2026-10-16  DHF     Added ByteOrder, halfToDouble, hasF16c and the  
+///                             bulk getFloat16/32/64.                          
+///                                                                             
 ///@version 2020-09-02  DHF     File creation                                   
 ///                                                                             
 //------------------------------------------------------------------------------
@@ -56,6 +59,7 @@
 #ifndef LIB_IEEE_TS754_WORK_FLOAT_H_FILE_GUARD
 #define LIB_IEEE_TS754_WORK_FLOAT_H_FILE_GUARD
 
+#include <stddef.h>
 #include <stdint.h>
 #include <vector>
 
@@ -66,12 +70,44 @@ namespace ieee {
 namespace ts754 {
 namespace work {
 
+//------------------------------------------------------------------------------
+///@brief   The byte order of the values in an array given to the bulk          
+///         getFloat16/32/64.                                                   
+//------------------------------------------------------------------------------
+enum class ByteOrder
+{
+    bigEndian           ///< The most significant byte first (network order).
+  , littleEndian        ///< The least significant byte first (x86 order).
+};
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 bool getFloat16(double& result, void const* memory, uint64_t bit_offset);
 bool getFloat32(double& result, void const* memory, uint64_t bit_offset);
 bool getFloat64(double& result, void const* memory, uint64_t bit_offset);
 
+double halfToDouble(uint16_t half);
+bool hasF16c();
+
+void getFloat16(
+    double*     results
+  , void const* memory
+  , size_t      count
+  , ByteOrder   order = ByteOrder::bigEndian
+);
+void getFloat32(
+    double*     results
+  , void const* memory
+  , size_t      count
+  , ByteOrder   order = ByteOrder::bigEndian
+);
+void getFloat64(
+    double*     results
+  , void const* memory
+  , size_t      count
+  , ByteOrder   order = ByteOrder::bigEndian
+);
+
 //------------------------------------------------------------------------------
 ///@brief   Return the 16-bit floating point number held at the given bit       
 ///         offset.                                                             
@@ -10,6 +10,12 @@
 #include "dev_test_work.h"
 #include "lib_config_work_filepaths.h"
 #include "lib_ieee_ts754_work_float.h"
+#include "lib_string.h"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <string.h>
 
 
 namespace lib {
@@ -146,8 +152,194 @@ void Test::runTest()
     TEST(lib::ieee::ts754::work::getFloat16(d, data2, 100));
     TEST(d == 2.0625);
 
+    specials();
+    bulk();
 } 
 
+//------------------------------------------------------------------------------
+/// @brief Zero, subnormals, infinity and NaN.                                  
+//------------------------------------------------------------------------------
+void Test::specials()
+{
+    using work::halfToDouble;
+
+    const double inf(std::numeric_limits<double>::infinity());
+
+    TEST(halfToDouble(0x0000) == 0.0);
+    TEST(halfToDouble(0x8000) == 0.0);
+    TEST(std::signbit(halfToDouble(0x8000)));
+    TEST(halfToDouble(0x3C00) == 1.0);
+    TEST(halfToDouble(0xC000) == -2.0);
+    TEST(halfToDouble(0x7BFF) == 65504.0);                      // largest
+    TEST(halfToDouble(0x0400) == std::ldexp(1.0, -14));         // smallest normal
+    TEST(halfToDouble(0x0001) == std::ldexp(1.0, -24));         // subnormal
+    TEST(halfToDouble(0x83FF) == -std::ldexp(1023.0, -24));
+    TEST(halfToDouble(0x7C00) == inf);
+    TEST(halfToDouble(0xFC00) == -inf);
+    TEST(std::isnan(halfToDouble(0x7E00)));
+
+    std::vector<uint8_t> data { 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00 };
+    double d(1);
+    TEST((work::getFloat32(d, data, 0), d == 0.0));
+    TEST((work::getFloat32(d, data, 32), d == inf));
+    TEST((work::getFloat16(d, data, 0), d == 0.0));
+
+} // void Test::specials() //
+
+//------------------------------------------------------------------------------
+/// @brief The bulk conversions against the single value ones.                  
+//------------------------------------------------------------------------------
+void Test::bulk()
+{
+    //--------------------------------------------------------------------------
+    //  Every half, in both byte orders (this also checks F16C, when the CPU    
+    //  has it, against halfToDouble).                                          
+    //--------------------------------------------------------------------------
+    std::vector<uint8_t> big(65536 * 2);
+    std::vector<uint8_t> little(65536 * 2);
+    for (size_t h = 0; h < 65536; ++h) {
+        big[2 * h]        = uint8_t(h >> 8);
+        big[2 * h + 1]    = uint8_t(h);
+        little[2 * h]     = uint8_t(h);
+        little[2 * h + 1] = uint8_t(h >> 8);
+    }
+
+    std::vector<double> from_big(65536);
+    std::vector<double> from_little(65536);
+    work::getFloat16(&from_big[0], &big[0], 65536);
+    work::getFloat16(
+        &from_little[0]
+      , &little[0]
+      , 65536
+      , work::ByteOrder::littleEndian
+    );
+
+    int errors(0);
+    for (size_t h = 0; h < 65536; ++h) {
+        double expected(work::halfToDouble(uint16_t(h)));
+        double single;
+        work::getFloat16(single, &big[0], h * 16);
+
+        if (std::isnan(expected)) {
+            if (!std::isnan(from_big[h]) || !std::isnan(from_little[h])) {
+                ++errors;
+            }
+        } else if (   from_big[h] != expected
+                   || from_little[h] != expected
+                   || single != expected
+                   || std::signbit(from_big[h]) != std::signbit(expected)
+        ) {
+            ++errors;
+        }
+    }
+    TEST_IS_EQUAL(errors, 0);
+
+    //--------------------------------------------------------------------------
+    //  An odd count of floats and doubles (so there is a remainder), read at   
+    //  an odd address.                                                         
+    //--------------------------------------------------------------------------
+    const size_t count(19);
+    std::vector<uint8_t> singles(1 + count * 4);
+    std::vector<uint8_t> doubles(1 + count * 8);
+    for (size_t b = 0; b < singles.size(); ++b) singles[b] = uint8_t(b * 41 + 3);
+    for (size_t b = 0; b < doubles.size(); ++b) doubles[b] = uint8_t(b * 23 + 9);
+
+    std::vector<double> s32(count);
+    std::vector<double> s64(count);
+    std::vector<double> l64(count);
+    work::getFloat32(&s32[0], &singles[1], count);
+    work::getFloat64(&s64[0], &doubles[1], count);
+    work::getFloat64(
+        &l64[0]
+      , &doubles[1]
+      , count
+      , work::ByteOrder::littleEndian
+    );
+
+    errors = 0;
+    for (size_t i = 0; i < count; ++i) {
+        double d;
+        work::getFloat32(d, &singles[1], i * 32);
+        if (!(d == s32[i] || (std::isnan(d) && std::isnan(s32[i])))) ++errors;
+
+        work::getFloat64(d, &doubles[1], i * 64);
+        if (!(d == s64[i] || (std::isnan(d) && std::isnan(s64[i])))) ++errors;
+
+        uint8_t reversed[8];
+        for (size_t b = 0; b < 8; ++b) reversed[b] = doubles[1 + i * 8 + 7 - b];
+        work::getFloat64(d, reversed, 0);
+        if (!(d == l64[i] || (std::isnan(d) && std::isnan(l64[i])))) ++errors;
+    }
+    TEST_IS_EQUAL(errors, 0);
+
+} // void Test::bulk() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure the bulk conversions against a value at a time.              
+//------------------------------------------------------------------------------
+void Test::runTest3()
+{
+    const size_t count(1000000);
+    std::vector<uint8_t> data(count * 8);
+    for (size_t b = 0; b < data.size(); ++b) data[b] = uint8_t(b * 29 + 1);
+    for (size_t b = 0; b < data.size(); b += 2) data[b] &= 0x7B;   // no NaN
+
+    std::vector<double> results(count);
+
+    const size_t sizes[] = { 16, 32, 64 };
+    for (size_t s = 0; s < 3; ++s) {
+        const size_t bits(sizes[s]);
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            switch (bits) {
+                case 16:
+                    work::getFloat16(results[i], &data[0], i * 16);
+                    break;
+                case 32:
+                    work::getFloat32(results[i], &data[0], i * 32);
+                    break;
+                default:
+                    work::getFloat64(results[i], &data[0], i * 64);
+                    break;
+            }
+        }
+        std::chrono::duration<double, std::nano> single(
+            std::chrono::steady_clock::now() - start
+        );
+
+        start = std::chrono::steady_clock::now();
+        switch (bits) {
+            case 16:
+                work::getFloat16(&results[0], &data[0], count);
+                break;
+            case 32:
+                work::getFloat32(&results[0], &data[0], count);
+                break;
+            default:
+                work::getFloat64(&results[0], &data[0], count);
+                break;
+        }
+        std::chrono::duration<double, std::nano> bulk(
+            std::chrono::steady_clock::now() - start
+        );
+
+        output(
+            vSummary
+          , lib::format(
+                "getFloat%d:  one at a time %5.2lf ns; bulk %5.2lf ns%s"
+              , int(bits)
+              , single.count() / count
+              , bulk.count() / count
+              , (bits == 16 && work::hasF16c())
+                ? " (F16C)"
+                : ""
+            )
+        );
+    }
+
+} // void Test::runTest3() //
+
 
 } // namespace test                                                             
 } // namespace floattest                                                        
@@ -22,6 +22,8 @@ namespace test {
 ///                                                                             
 ///@author  Make Test Utility       MTU     Utility by DHF                      
 ///                                                                             
+///@version 2026-10-16  DHF     Added specials, bulk and runTest3.              
+///                                                                             
 //------------------------------------------------------------------------------
 class Test : public dev::test::work::Test {
     public:
@@ -32,6 +34,10 @@ class Test : public dev::test::work::Test {
 
     protected:
         void runTest();
+        void runTest3();
+
+        void specials();
+        void bulk();
 
 
     private:
@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_mappedfilereader.cpp                                        
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_io_msg_mappedfilereader.h"
+
+#include <stdexcept>
+#include <vector>
+
+namespace lib {
+namespace io {
+namespace msg {
+
+//------------------------------------------------------------------------------
+///@brief   A mapped chunk and the views of its records.                        
+//------------------------------------------------------------------------------
+struct Records
+{
+    lib::io::work::MappedChunkPtr   m_Chunk;
+    std::vector<RecordView>         m_Views;
+};
+
+//------------------------------------------------------------------------------
+///@param   path            The file to read.                                   
+///@param   record_size     The size of a record in bytes (0 is taken as 1).    
+///@param   chunk_size      About how much of the file to map at once; rounded  
+///                         down to a whole number of records.                  
+///@param   window          The most chunks mapped at once.                     
+//------------------------------------------------------------------------------
+MappedFileReader::MappedFileReader(
+    const std::string&  path
+  , size_t              record_size
+  , size_t              chunk_size
+  , size_t              window
+) : lib::mp::work::Threadable("mapped file reader")
+  , m_File(path, window)
+  , m_RecordSize(record_size < 1 ? 1 : record_size)
+  , m_ChunkSize(chunk_size - chunk_size % m_RecordSize)
+{
+    if (m_ChunkSize < m_RecordSize) m_ChunkSize = m_RecordSize;
+
+} // MappedFileReader::MappedFileReader() //
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+MappedFileReader::~MappedFileReader()
+{
+} // MappedFileReader::~MappedFileReader() //
+
+//------------------------------------------------------------------------------
+///@throw   std::runtime_error if the file could not be opened.                 
+//------------------------------------------------------------------------------
+void MappedFileReader::checkIfAllIsWell() const
+{
+    if (!m_File.isOpen()) throw std::runtime_error(m_File.error());
+
+} // void MappedFileReader::checkIfAllIsWell() const //
+
+//------------------------------------------------------------------------------
+///@brief   Map the file a chunk at a time and publish each chunk's records.    
+//------------------------------------------------------------------------------
+void MappedFileReader::operator()()
+{
+    try {
+        for (uint64_t offset = 0; offset < m_File.size(); offset += m_ChunkSize)
+        {
+            lib::ds::shared_ptr<Records> records(new Records);
+            records->m_Chunk = m_File.map(offset, m_ChunkSize);
+
+            lib::io::work::MappedChunk const& chunk(*records->m_Chunk);
+            const size_t count((chunk.size() + m_RecordSize - 1) / m_RecordSize);
+            records->m_Views.reserve(count);
+            for (size_t r = 0; r < count; ++r) {
+                const size_t begin(r * m_RecordSize);
+                const size_t size(
+                    chunk.size() - begin < m_RecordSize
+                  ? chunk.size() - begin
+                  : m_RecordSize
+                );
+                records->m_Views.push_back(
+                    RecordView(chunk.data() + begin, size, offset + begin)
+                );
+            }
+
+            //------------------------------------------------------------------
+            //  Each view owns the whole chunk (the aliasing constructor).      
+            //------------------------------------------------------------------
+            std::vector<ConstRecordViewPtr> batch;
+            batch.reserve(count);
+            for (size_t r = 0; r < count; ++r) {
+                batch.push_back(ConstRecordViewPtr(records, &records->m_Views[r]));
+            }
+            records.reset();
+
+            publishBatch(batch.begin(), batch.end());
+        }
+    } catch (const std::exception& e) {
+        m_Error = e.what();
+    }
+
+    endPublication();
+
+} // void MappedFileReader::operator()() //
+
+} // namespace msg
+} // namespace io
+} // namespace lib
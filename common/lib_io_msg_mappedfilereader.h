@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_mappedfilereader.h                                          
+///@brief Holds lib::io::msg::MappedFileReader, a publisher of the records of   
+///       a memory mapped file.                                                 
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_IO_MSG_MAPPEDFILEREADER_H_FILE_GUARD
+#define LIB_IO_MSG_MAPPEDFILEREADER_H_FILE_GUARD
+
+#include "lib_ds_shared_ptr.h"
+#include "lib_ds_viewwithoffset.h"
+#include "lib_io_work_mappedfile.h"
+#include "lib_mp_work_threadable.h"
+#include "lib_msg_publisher.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace io {
+namespace msg {
+
+using RecordView = lib::ds::ViewWithOffset<uint8_t>;
+using ConstRecordViewPtr = lib::ds::shared_ptr<const RecordView>;
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Publish a file's fixed size records as views into the mapped file.  
+///                                                                             
+///@par Purpose:                                                                
+///         The records are not copied:  each RecordView points into a          
+///         chunk of the mapped file and shares ownership of the chunk (via     
+///         the shared_ptr aliasing constructor), so the chunk stays mapped     
+///         until the last subscriber lets go of the last of its records.       
+///         A chunk's records are published as one batch.                       
+///                                                                             
+///@par Memory                                                                  
+///         At most window chunks are mapped at once (see                       
+///         lib::io::work::MappedFile); when subscribers hold on to that many,  
+///         the reader waits for them.  A subscriber that keeps every record    
+///         it is given will therefore stop the reader, so copy anything that   
+///         has to be kept.                                                     
+///                                                                             
+///@par Records                                                                 
+///         A chunk is a whole number of records (at least one), so no record   
+///         straddles two chunks.  The last record is short if the file is      
+///         not a whole number of records.                                      
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::ds::shared_ptr<lib::io::msg::MappedFileReader> reader;         
+///         lib::new_shared(reader, path, frame_size);                          
+///         reader->setPopulate(true);                                          
+///         threads.push_back(reader);                                          
+///         reader->connect(decoder);       // Subscriber<RecordView>           
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class MappedFileReader
+    : public lib::msg::Publisher<RecordView>
+    , public lib::mp::work::Threadable
+{
+    public:
+        MappedFileReader(
+            const std::string&  path
+          , size_t              record_size
+          , size_t              chunk_size = 64 << 20
+          , size_t              window = 4
+        );
+        virtual ~MappedFileReader();
+
+        void setPopulate(bool populate) { m_File.setPopulate(populate); }
+        void setHugePages(bool huge_pages) { m_File.setHugePages(huge_pages); }
+
+        size_t recordSize() const { return m_RecordSize; }
+        size_t chunkSize() const { return m_ChunkSize; }
+        uint64_t fileSize() const { return m_File.size(); }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return what went wrong (empty if nothing did).              
+        ///@note    Only meaningful once the thread has been joined.            
+        //----------------------------------------------------------------------
+        const std::string& error() const { return m_Error; }
+
+        void checkIfAllIsWell() const override;
+        void operator()() override;
+
+    private:
+        lib::io::work::MappedFile   m_File;
+        size_t                      m_RecordSize;
+        size_t                      m_ChunkSize;
+        std::string                 m_Error;
+
+}; // class MappedFileReader //
+
+} // namespace msg
+} // namespace io
+} // namespace lib
+
+#endif // #ifndef LIB_IO_MSG_MAPPEDFILEREADER_H_FILE_GUARD
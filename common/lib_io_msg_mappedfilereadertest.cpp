@@ -0,0 +1,304 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_mappedfilereadertest.cpp                                    
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_io_msg_mappedfilereadertest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_ds_bufferpool.h"
+#include "lib_io_msg_mappedfilereader.h"
+#include "lib_io_work_mappedfile.h"
+#include "lib_mp_work_threadablecollection.h"
+#include "lib_msg_subscriber.h"
+#include "lib_string.h"
+
+#include <atomic>
+#include <boost/thread.hpp>
+#include <chrono>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace lib {
+namespace io {
+namespace msg {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::io::msg::test::MappedFileReaderTest);
+
+//------------------------------------------------------------------------------
+//  The byte at each offset of the test files.                                  
+//------------------------------------------------------------------------------
+static uint8_t expected(uint64_t offset)
+{
+    return uint8_t(offset * 7 + offset / 251);
+}
+
+//------------------------------------------------------------------------------
+//  A test file (removed when the object goes away).                            
+//------------------------------------------------------------------------------
+class TestFile
+{
+    public:
+        explicit TestFile(uint64_t size)
+        {
+            const char* directory(getenv("TMPDIR"));
+            #ifdef _WIN32
+            int pid(0);
+            #else
+            int pid(getpid());
+            #endif
+            m_Path = lib::format(
+                "%s/lib_io_msg_mappedfilereadertest.%d"
+              , directory != nullptr ? directory : "/tmp"
+              , pid
+            );
+
+            std::vector<char> data(1 << 16);
+            std::ofstream file(m_Path.c_str(), std::ios::binary);
+            for (uint64_t offset = 0; offset < size; offset += data.size()) {
+                size_t n(size - offset < data.size() ? size - offset : data.size());
+                for (size_t b = 0; b < n; ++b) data[b] = char(expected(offset + b));
+                file.write(&data[0], n);
+            }
+        }
+
+        ~TestFile() { remove(m_Path.c_str()); }
+
+        const std::string& path() const { return m_Path; }
+
+    private:
+        std::string m_Path;
+};
+
+//------------------------------------------------------------------------------
+//  Check each record against the file's contents.                              
+//------------------------------------------------------------------------------
+class RecordChecker : public lib::msg::Subscriber<RecordView>
+{
+    public:
+        RecordChecker() : m_Records(0), m_Bytes(0), m_LastSize(0), m_Errors(0) { }
+
+        void process(ConstRecordViewPtr& record)
+        {
+            if (record->fileOffset() != m_Bytes) ++m_Errors;
+            for (size_t b = 0; b < record->size(); ++b) {
+                if ((*record)[b] != expected(record->fileOffset() + b)) {
+                    ++m_Errors;
+                    break;
+                }
+            }
+
+            ++m_Records;
+            m_Bytes += record->size();
+            m_LastSize = record->size();
+        }
+
+        size_t      m_Records;
+        uint64_t    m_Bytes;
+        size_t      m_LastSize;
+        int         m_Errors;
+};
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+MappedFileReaderTest::MappedFileReaderTest()
+    : Test("lib::io::msg::MappedFileReader")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    MappedFileReaderTest object to copy.                        
+//------------------------------------------------------------------------------
+MappedFileReaderTest::MappedFileReaderTest(const MappedFileReaderTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+MappedFileReaderTest::~MappedFileReaderTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+MappedFileReaderTest& MappedFileReaderTest::operator=(
+    const MappedFileReaderTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // MappedFileReaderTest::operator=(const MappedFileReaderTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Check MappedFile's window, then the reader in a pipeline.            
+//------------------------------------------------------------------------------
+void MappedFileReaderTest::runTest()
+{
+    const uint64_t size(100 * 10000 + 37);
+    TestFile test_file(size);
+
+    //--------------------------------------------------------------------------
+    //  MappedFile:  chunks at unaligned offsets, the end of the file and the   
+    //  window.                                                                 
+    //--------------------------------------------------------------------------
+    {
+        lib::io::work::MappedFile file(test_file.path(), 2);
+        TEST(file.isOpen());
+        TEST_IS_EQUAL(file.size(), size);
+        TEST_IS_EQUAL(file.window(), 2);
+
+        lib::io::work::MappedChunkPtr a(file.map(12345, 1000));
+        TEST_IS_EQUAL(a->size(), 1000);
+        TEST_IS_EQUAL(a->fileOffset(), 12345);
+        TEST_IS_EQUAL(a->data()[0], expected(12345));
+        TEST_IS_EQUAL(a->data()[999], expected(13344));
+
+        lib::io::work::MappedChunkPtr b(file.map(size - 10, 1000));
+        TEST_IS_EQUAL(b->size(), 10);
+        TEST_IS_EQUAL(b->data()[9], expected(size - 1));
+        TEST_IS_EQUAL(file.mapped(), 2);
+
+        //----------------------------------------------------------------------
+        //  A third has to wait for one of them to be released.                 
+        //----------------------------------------------------------------------
+        std::atomic<bool> mapped(false);
+        lib::io::work::MappedChunkPtr c;
+        boost::thread waiter([&]() { c = file.map(0, 100); mapped = true; });
+
+        boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+        TEST(!mapped);
+        a.reset();
+        waiter.join();
+        TEST(mapped);
+        TEST_IS_EQUAL(c->data()[50], expected(50));
+
+        b.reset();
+        TEST_IS_EQUAL(file.mapped(), 1);
+        c.reset();
+        TEST_IS_EQUAL(file.mapped(), 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  The reader:  4000 byte chunks of 100 byte records, two chunks at a      
+    //  time.                                                                   
+    //--------------------------------------------------------------------------
+    {
+        lib::mp::work::ThreadableCollection threads;
+
+        lib::ds::shared_ptr<MappedFileReader> reader;
+        lib::new_shared(reader, test_file.path(), 100, 4096, 2);
+        reader->setPopulate(true);
+        reader->setHugePages(true);
+        threads.push_back(reader);
+        TEST_IS_EQUAL(reader->chunkSize(), 4000);
+
+        lib::ds::shared_ptr<RecordChecker> checker;
+        lib::new_shared(checker);
+        threads.push_back(checker);
+
+        reader->connect(checker);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST(reader->error().empty());
+        TEST_IS_EQUAL(checker->m_Records, 10001);
+        TEST_IS_EQUAL(checker->m_Bytes, size);
+        TEST_IS_EQUAL(checker->m_LastSize, 37);
+        TEST_IS_EQUAL(checker->m_Errors, 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  A file that is not there.                                               
+    //--------------------------------------------------------------------------
+    {
+        MappedFileReader reader(test_file.path() + ".missing", 100);
+        bool thrown(false);
+        try {
+            reader.checkIfAllIsWell();
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        TEST(thrown);
+    }
+
+} // void MappedFileReaderTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure reading records into pooled buffers against mapping.         
+//------------------------------------------------------------------------------
+void MappedFileReaderTest::runTest3()
+{
+    const size_t record(4096);
+    const uint64_t size(uint64_t(256) << 20);
+    TestFile test_file(size);
+
+    using Pool = lib::ds::BufferPool<uint8_t>;
+    uint64_t sum(0);
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::ifstream file(test_file.path().c_str(), std::ios::binary);
+        for (uint64_t offset = 0; offset < size; offset += record) {
+            Pool::BufferPtr buffer(Pool::get(record, offset));
+            file.read(static_cast<char*>(buffer->memory()), record);
+            for (size_t b = 0; b < record; b += 64) sum += (*buffer)[b];
+        }
+    }
+    std::chrono::duration<double> copied(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    {
+        const size_t chunk_size(64 << 20);
+        lib::io::work::MappedFile file(test_file.path());
+        for (uint64_t offset = 0; offset < size; offset += chunk_size) {
+            lib::io::work::MappedChunkPtr chunk(file.map(offset, chunk_size));
+            for (size_t r = 0; r < chunk->size(); r += record) {
+                RecordView view(chunk->data() + r, record, offset + r);
+                for (size_t b = 0; b < record; b += 64) sum -= view[b];
+            }
+        }
+    }
+    std::chrono::duration<double> mapped(std::chrono::steady_clock::now() - start);
+
+    TEST(sum == 0);
+
+    const double mib(double(size) / (1 << 20));
+    output(
+        vSummary
+      , lib::format(
+            "%d MiB of %d byte records:  read %7.1lf MiB/s; mapped %7.1lf MiB/s"
+          , int(mib)
+          , int(record)
+          , mib / copied.count()
+          , mib / mapped.count()
+        )
+    );
+
+} // void MappedFileReaderTest::runTest3() //
+
+} // namespace test
+} // namespace msg
+} // namespace io
+} // namespace lib
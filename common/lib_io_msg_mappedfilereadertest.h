@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_mappedfilereadertest.h                                      
+//------------------------------------------------------------------------------
+#ifndef LIB_IO_MSG_MAPPEDFILEREADERTEST_H
+#define LIB_IO_MSG_MAPPEDFILEREADERTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace io {
+namespace msg {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: MappedFileReaderTest                                             
+///                                                                             
+///@par Purpose:                                                                
+///         The MappedFileReaderTest class provides the regression test for     
+///         the lib::io::msg::MappedFileReader and lib::io::work::MappedFile    
+///         classes.                                                            
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class MappedFileReaderTest : public dev::test::work::Test {
+    public:
+        MappedFileReaderTest();
+        MappedFileReaderTest(const MappedFileReaderTest& that);
+        virtual ~MappedFileReaderTest();
+        MappedFileReaderTest& operator=(const MappedFileReaderTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class MappedFileReaderTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace msg
+} // namespace io
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_IO_MSG_MAPPEDFILEREADERTEST_H //
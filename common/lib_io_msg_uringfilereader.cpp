@@ -0,0 +1,275 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_uringfilereader.cpp                                         
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_io_msg_uringfilereader.h"
+#include "lib_io_work_uring.h"
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <errno.h>
+#include <fcntl.h>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <system_error>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace lib {
+namespace io {
+namespace msg {
+
+//------------------------------------------------------------------------------
+///@brief   The reader's buffers and which of them are free, shared with the    
+///         chunks that are out with subscribers.                               
+//------------------------------------------------------------------------------
+struct UringBuffers
+{
+    UringBuffers(unsigned count, size_t size)
+        : m_Memory(new uint8_t[count * size])
+        , m_Size(size)
+    {
+        for (unsigned b = count; b > 0; --b) m_Free.push_back(b - 1);
+    }
+
+    uint8_t* at(unsigned buffer) { return m_Memory.get() + buffer * m_Size; }
+
+    bool take(unsigned& buffer)
+    {
+        boost::mutex::scoped_lock lock(m_Mutex);
+        if (m_Free.empty()) return false;
+        buffer = m_Free.back();
+        m_Free.pop_back();
+        return true;
+    }
+
+    void give(unsigned buffer)
+    {
+        boost::mutex::scoped_lock lock(m_Mutex);
+        m_Free.push_back(buffer);
+        m_Released.notify_all();
+    }
+
+    void waitForOne()
+    {
+        boost::mutex::scoped_lock lock(m_Mutex);
+        while (m_Free.empty()) m_Released.wait(lock);
+    }
+
+    std::unique_ptr<uint8_t[]>  m_Memory;
+    const size_t                m_Size;
+    boost::mutex                m_Mutex;
+    boost::condition_variable   m_Released;
+    std::vector<unsigned>       m_Free;
+};
+
+//------------------------------------------------------------------------------
+///@brief   A published chunk:  gives its buffer back when the last view of it  
+///         goes away.                                                          
+//------------------------------------------------------------------------------
+struct UringChunk
+{
+    UringChunk(
+        const std::shared_ptr<UringBuffers>&    buffers
+      , unsigned                                buffer
+      , size_t                                  size
+      , uint64_t                                offset
+    ) : m_Buffers(buffers)
+      , m_Buffer(buffer)
+      , m_View(buffers->at(buffer), size, offset)
+    {
+    }
+
+    ~UringChunk() { m_Buffers->give(m_Buffer); }
+
+    std::shared_ptr<UringBuffers>   m_Buffers;
+    unsigned                        m_Buffer;
+    RecordView                      m_View;
+};
+
+//------------------------------------------------------------------------------
+///@param   path        The file to read.                                       
+///@param   chunk_size  The size of each read (and each published view); 0 is   
+///                     taken as 1.                                             
+///@param   depth       The most reads in flight at once.                       
+///@note    Check checkIfAllIsWell (or error) before starting the thread.       
+//------------------------------------------------------------------------------
+UringFileReader::UringFileReader(
+    const std::string&  path
+  , size_t              chunk_size
+  , unsigned            depth
+) : lib::mp::work::Threadable("uring file reader")
+  , m_Path(path)
+  , m_ChunkSize(chunk_size < 1 ? 1 : chunk_size)
+  , m_Depth(depth < 1 ? 1 : depth)
+  , m_File(-1)
+  , m_Size(0)
+{
+    #ifdef _WIN32
+    m_File = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+    #else
+    m_File = open(path.c_str(), O_RDONLY);
+    #endif
+
+    if (m_File < 0) {
+        m_Error = path + ": " + std::generic_category().message(errno);
+        return;
+    }
+
+    #ifdef _WIN32
+    struct _stat64 status;
+    if (_fstat64(m_File, &status) == 0) m_Size = uint64_t(status.st_size);
+    #else
+    struct stat status;
+    if (fstat(m_File, &status) == 0) m_Size = uint64_t(status.st_size);
+    #endif
+
+} // UringFileReader::UringFileReader() //
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+UringFileReader::~UringFileReader()
+{
+    #ifdef _WIN32
+    if (m_File >= 0) _close(m_File);
+    #else
+    if (m_File >= 0) close(m_File);
+    #endif
+
+} // UringFileReader::~UringFileReader() //
+
+//------------------------------------------------------------------------------
+///@throw   std::runtime_error if the file could not be opened.                 
+//------------------------------------------------------------------------------
+void UringFileReader::checkIfAllIsWell() const
+{
+    if (m_File < 0) throw std::runtime_error(m_Error);
+
+} // void UringFileReader::checkIfAllIsWell() const //
+
+//------------------------------------------------------------------------------
+///@brief   Read the file and publish its chunks in order.                      
+//------------------------------------------------------------------------------
+void UringFileReader::operator()()
+{
+    try {
+        if (m_File < 0) throw std::runtime_error(m_Error);
+        read();
+    } catch (const std::exception& e) {
+        m_Error = e.what();
+    }
+
+    endPublication();
+
+} // void UringFileReader::operator()() //
+
+//------------------------------------------------------------------------------
+///@brief   Keep the ring full of reads; publish each chunk once every chunk    
+///         before it has been published.                                       
+///@throw   std::runtime_error if a read fails.                                 
+//------------------------------------------------------------------------------
+void UringFileReader::read()
+{
+    const unsigned count(2 * m_Depth);
+    std::shared_ptr<UringBuffers> buffers(
+        new UringBuffers(count, m_ChunkSize)
+    );
+
+    //--------------------------------------------------------------------------
+    //  The ring goes first (its destructor waits for reads in flight, which    
+    //  may be writing into the buffers).  If the buffers cannot be             
+    //  registered, the reads are ordinary ones.                                
+    //--------------------------------------------------------------------------
+    lib::io::work::Uring ring(m_Depth);
+    ring.registerBuffers(buffers->at(0), m_ChunkSize, count);
+
+    std::vector<uint64_t> offsets(count);
+    std::vector<size_t> filled(count);
+    std::vector<size_t> wanted(count);
+    std::map<uint64_t, unsigned> arrived;
+
+    uint64_t next_read(0);
+    uint64_t next_publish(0);
+    while (next_publish < m_Size) {
+        unsigned buffer(0);
+        while (
+            next_read < m_Size
+         && ring.inFlight() < m_Depth
+         && buffers->take(buffer)
+        ) {
+            offsets[buffer] = next_read;
+            filled[buffer] = 0;
+            wanted[buffer] = m_Size - next_read < m_ChunkSize
+              ? size_t(m_Size - next_read)
+              : m_ChunkSize;
+            ring.read(
+                m_File, int(buffer), buffers->at(buffer), wanted[buffer]
+              , next_read, buffer
+            );
+            next_read += wanted[buffer];
+        }
+
+        //----------------------------------------------------------------------
+        //  Nothing in flight:  the subscribers have every buffer.              
+        //----------------------------------------------------------------------
+        if (ring.inFlight() == 0) {
+            buffers->waitForOne();
+            continue;
+        }
+
+        lib::io::work::Uring::Completion done;
+        if (!ring.wait(done)) throw std::runtime_error(m_Path + ": " + ring.error());
+
+        buffer = unsigned(done.m_UserData);
+        if (done.m_Result < 0) {
+            throw std::runtime_error(
+                m_Path + ": "
+              + std::generic_category().message(int(-done.m_Result))
+            );
+        }
+
+        //----------------------------------------------------------------------
+        //  A short read (rare for a file) is continued; none at all means the  
+        //  file has shrunk since it was opened.                                
+        //----------------------------------------------------------------------
+        filled[buffer] += size_t(done.m_Result);
+        if (done.m_Result > 0 && filled[buffer] < wanted[buffer]) {
+            ring.read(
+                m_File, int(buffer), buffers->at(buffer) + filled[buffer]
+              , wanted[buffer] - filled[buffer]
+              , offsets[buffer] + filled[buffer], buffer
+            );
+            continue;
+        }
+        arrived[offsets[buffer]] = buffer;
+
+        std::map<uint64_t, unsigned>::iterator next;
+        while ((next = arrived.find(next_publish)) != arrived.end()) {
+            const unsigned ready(next->second);
+            arrived.erase(next);
+
+            lib::ds::shared_ptr<UringChunk> chunk(
+                new UringChunk(buffers, ready, filled[ready], next_publish)
+            );
+            next_publish += wanted[ready];
+            publish(ConstRecordViewPtr(chunk, &chunk->m_View));
+        }
+    }
+
+} // void UringFileReader::read() //
+
+} // namespace msg
+} // namespace io
+} // namespace lib
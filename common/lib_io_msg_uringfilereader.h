@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_uringfilereader.h                                           
+///@brief Holds lib::io::msg::UringFileReader, a publisher of a file's chunks   
+///       read with many reads in flight.                                       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_IO_MSG_URINGFILEREADER_H_FILE_GUARD
+#define LIB_IO_MSG_URINGFILEREADER_H_FILE_GUARD
+
+#include "lib_ds_shared_ptr.h"
+#include "lib_io_msg_mappedfilereader.h"
+#include "lib_mp_work_threadable.h"
+#include "lib_msg_publisher.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace io {
+namespace msg {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Publish a file, in order, as chunk size RecordViews, keeping depth  
+///         reads in flight (lib::io::work::Uring).                             
+///                                                                             
+///@par Purpose:                                                                
+///         One read() at a time leaves a fast drive mostly idle.  The reader   
+///         keeps the ring full of reads into registered buffers and            
+///         publishes each chunk as soon as it and every chunk before it have   
+///         arrived.                                                            
+///                                                                             
+///@par Memory                                                                  
+///         There are twice depth buffers of chunk size bytes.  A published     
+///         view owns its buffer (via the shared_ptr aliasing constructor);     
+///         the buffer is reused once the last subscriber lets go of it.  When  
+///         subscribers hold on to them all, the reader waits, so copy          
+///         anything that has to be kept.  The buffers outlive the reader if    
+///         need be.                                                            
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::ds::shared_ptr<lib::io::msg::UringFileReader> reader;          
+///         lib::new_shared(reader, path, 1 << 20, 32);                         
+///         threads.push_back(reader);                                          
+///         reader->connect(decoder);       // Subscriber<RecordView>           
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class UringFileReader
+    : public lib::msg::Publisher<RecordView>
+    , public lib::mp::work::Threadable
+{
+    public:
+        UringFileReader(
+            const std::string&  path
+          , size_t              chunk_size = 1 << 20
+          , unsigned            depth = 32
+        );
+        virtual ~UringFileReader();
+
+        const std::string& path() const { return m_Path; }
+        size_t chunkSize() const { return m_ChunkSize; }
+        unsigned depth() const { return m_Depth; }
+        uint64_t fileSize() const { return m_Size; }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return what went wrong (empty if nothing did).              
+        ///@note    Only meaningful once the thread has been joined.            
+        //----------------------------------------------------------------------
+        const std::string& error() const { return m_Error; }
+
+        void checkIfAllIsWell() const override;
+        void operator()() override;
+
+    private:
+        void read();
+
+        std::string                 m_Path;
+        size_t                      m_ChunkSize;
+        unsigned                    m_Depth;
+        int                         m_File;
+        uint64_t                    m_Size;
+        std::string                 m_Error;
+
+}; // class UringFileReader //
+
+} // namespace msg
+} // namespace io
+} // namespace lib
+
+#endif // #ifndef LIB_IO_MSG_URINGFILEREADER_H_FILE_GUARD
@@ -0,0 +1,451 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_uringfilereadertest.cpp                                     
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_io_msg_uringfilereadertest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_io_msg_uringfilereader.h"
+#include "lib_io_msg_uringfilewriter.h"
+#include "lib_io_work_uring.h"
+#include "lib_mp_work_threadablecollection.h"
+#include "lib_msg_subscriber.h"
+#include "lib_string.h"
+
+#include <chrono>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace lib {
+namespace io {
+namespace msg {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::io::msg::test::UringFileReaderTest);
+
+//------------------------------------------------------------------------------
+//  The byte at each offset of the test files.                                  
+//------------------------------------------------------------------------------
+static uint8_t expected(uint64_t offset)
+{
+    return uint8_t(offset * 13 + offset / 509);
+}
+
+//------------------------------------------------------------------------------
+//  A test file (removed when the object goes away).                            
+//------------------------------------------------------------------------------
+class UringTestFile
+{
+    public:
+        UringTestFile(uint64_t size, const char* suffix = "in")
+        {
+            const char* directory(getenv("TMPDIR"));
+            #ifdef _WIN32
+            int pid(0);
+            #else
+            int pid(getpid());
+            #endif
+            m_Path = lib::format(
+                "%s/lib_io_msg_uringfilereadertest.%d.%s"
+              , directory != nullptr ? directory : "/tmp"
+              , pid
+              , suffix
+            );
+
+            std::vector<char> data(1 << 16);
+            std::ofstream file(m_Path.c_str(), std::ios::binary);
+            for (uint64_t offset = 0; offset < size; offset += data.size()) {
+                size_t n(size - offset < data.size() ? size - offset : data.size());
+                for (size_t b = 0; b < n; ++b) data[b] = char(expected(offset + b));
+                file.write(&data[0], n);
+            }
+        }
+
+        ~UringTestFile() { remove(m_Path.c_str()); }
+
+        const std::string& path() const { return m_Path; }
+
+    private:
+        std::string m_Path;
+};
+
+//------------------------------------------------------------------------------
+//  Check each chunk against the file's contents (and that they are in order).  
+//------------------------------------------------------------------------------
+class ChunkChecker : public lib::msg::Subscriber<RecordView>
+{
+    public:
+        ChunkChecker() : m_Chunks(0), m_Bytes(0), m_LastSize(0), m_Errors(0) { }
+
+        void process(ConstRecordViewPtr& chunk)
+        {
+            if (chunk->fileOffset() != m_Bytes) ++m_Errors;
+            for (size_t b = 0; b < chunk->size(); ++b) {
+                if ((*chunk)[b] != expected(chunk->fileOffset() + b)) {
+                    ++m_Errors;
+                    break;
+                }
+            }
+
+            ++m_Chunks;
+            m_Bytes += chunk->size();
+            m_LastSize = chunk->size();
+        }
+
+        size_t      m_Chunks;
+        uint64_t    m_Bytes;
+        size_t      m_LastSize;
+        int         m_Errors;
+};
+
+//------------------------------------------------------------------------------
+//  Touch one byte in 64 of each chunk (so the benchmark has a consumer).       
+//------------------------------------------------------------------------------
+class ChunkSummer : public lib::msg::Subscriber<RecordView>
+{
+    public:
+        ChunkSummer() : m_Sum(0) { }
+
+        void process(ConstRecordViewPtr& chunk)
+        {
+            for (size_t b = 0; b < chunk->size(); b += 64) m_Sum += (*chunk)[b];
+        }
+
+        uint64_t    m_Sum;
+};
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+UringFileReaderTest::UringFileReaderTest()
+    : Test("lib::io::msg::UringFileReader")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    UringFileReaderTest object to copy.                         
+//------------------------------------------------------------------------------
+UringFileReaderTest::UringFileReaderTest(const UringFileReaderTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+UringFileReaderTest::~UringFileReaderTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+UringFileReaderTest& UringFileReaderTest::operator=(
+    const UringFileReaderTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // UringFileReaderTest::operator=(const UringFileReaderTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Check the ring, the reader in a pipeline and a copy through the      
+///        writer.                                                              
+//------------------------------------------------------------------------------
+void UringFileReaderTest::runTest()
+{
+    const uint64_t size(1000 * 1000 + 37);
+    UringTestFile test_file(size);
+
+    //--------------------------------------------------------------------------
+    //  The ring:  two reads into registered buffers, completing in any order.  
+    //--------------------------------------------------------------------------
+    {
+        #ifdef _WIN32
+        int file(_open(test_file.path().c_str(), _O_RDONLY | _O_BINARY));
+        #else
+        int file(open(test_file.path().c_str(), O_RDONLY));
+        #endif
+        TEST(file >= 0);
+
+        std::vector<uint8_t> memory(2 * 1000);
+        lib::io::work::Uring ring(4);
+        TEST_IS_EQUAL(ring.depth(), 4);
+        ring.registerBuffers(&memory[0], 1000, 2);
+
+        TEST(ring.read(file, 0, &memory[0], 1000, 12345, 7));
+        TEST(ring.read(file, 1, &memory[1000], 1000, size - 10, 8));
+        TEST_IS_EQUAL(ring.inFlight(), 2);
+        TEST(ring.submit());
+
+        int64_t results[2] = { -1, -1 };
+        lib::io::work::Uring::Completion done;
+        while (ring.wait(done)) {
+            TEST(done.m_UserData == 7 || done.m_UserData == 8);
+            results[done.m_UserData - 7] = done.m_Result;
+        }
+        TEST_IS_EQUAL(ring.inFlight(), 0);
+        TEST_IS_EQUAL(results[0], 1000);
+        TEST_IS_EQUAL(results[1], 10);
+        TEST_IS_EQUAL(memory[0], expected(12345));
+        TEST_IS_EQUAL(memory[999], expected(13344));
+        TEST_IS_EQUAL(memory[1009], expected(size - 1));
+
+        #ifdef _WIN32
+        _close(file);
+        #else
+        close(file);
+        #endif
+    }
+
+    //--------------------------------------------------------------------------
+    //  The reader:  4096 byte chunks, four reads in flight.                    
+    //--------------------------------------------------------------------------
+    {
+        lib::mp::work::ThreadableCollection threads;
+
+        lib::ds::shared_ptr<UringFileReader> reader;
+        lib::new_shared(reader, test_file.path(), 4096, 4);
+        threads.push_back(reader);
+        TEST_IS_EQUAL(reader->fileSize(), size);
+
+        lib::ds::shared_ptr<ChunkChecker> checker;
+        lib::new_shared(checker);
+        threads.push_back(checker);
+
+        reader->connect(checker);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST(reader->error().empty());
+        TEST_IS_EQUAL(checker->m_Chunks, (size + 4095) / 4096);
+        TEST_IS_EQUAL(checker->m_Bytes, size);
+        TEST_IS_EQUAL(checker->m_LastSize, size % 4096);
+        TEST_IS_EQUAL(checker->m_Errors, 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Copy the file through the writer (chunks that do not line up with the   
+    //  reader's).                                                              
+    //--------------------------------------------------------------------------
+    {
+        UringTestFile copy(0, "out");
+
+        lib::mp::work::ThreadableCollection threads;
+
+        lib::ds::shared_ptr<UringFileReader> reader;
+        lib::new_shared(reader, test_file.path(), 7000, 3);
+        threads.push_back(reader);
+
+        lib::ds::shared_ptr<UringFileWriter> writer;
+        lib::new_shared(writer, copy.path(), 10000, 3);
+        threads.push_back(writer);
+
+        reader->connect(writer);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST(reader->error().empty());
+        TEST(writer->error().empty());
+        TEST_IS_EQUAL(writer->bytesWritten(), size);
+
+        std::ifstream file(copy.path().c_str(), std::ios::binary);
+        std::vector<char> data(
+            (std::istreambuf_iterator<char>(file))
+          , std::istreambuf_iterator<char>()
+        );
+        TEST_IS_EQUAL(data.size(), size);
+        size_t wrong(0);
+        for (size_t b = 0; b < data.size(); ++b) {
+            if (uint8_t(data[b]) != expected(b)) ++wrong;
+        }
+        TEST_IS_EQUAL(wrong, 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  A file that is not there.                                               
+    //--------------------------------------------------------------------------
+    {
+        UringFileReader reader(test_file.path() + ".missing");
+        bool thrown(false);
+        try {
+            reader.checkIfAllIsWell();
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        TEST(thrown);
+    }
+
+} // void UringFileReaderTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure read() against the ring at 4 KiB to 8 MiB chunks, then the   
+///        reader and writer threads.                                           
+///@note    The file was just written, so this is mostly the page cache.        
+//------------------------------------------------------------------------------
+void UringFileReaderTest::runTest3()
+{
+    const uint64_t size(uint64_t(256) << 20);
+    const double mib(double(size) / (1 << 20));
+    const unsigned depth(32);
+    UringTestFile test_file(size);
+
+    #ifdef _WIN32
+    int file(_open(test_file.path().c_str(), _O_RDONLY | _O_BINARY));
+    #else
+    int file(open(test_file.path().c_str(), O_RDONLY));
+    #endif
+    TEST(file >= 0);
+
+    const size_t chunks[] = { 4 << 10, 64 << 10, 1 << 20, 8 << 20 };
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); ++c) {
+        const size_t chunk(chunks[c]);
+        std::vector<uint8_t> memory(depth * chunk);
+        uint64_t sum(0);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t offset = 0; offset < size; offset += chunk) {
+            #ifdef _WIN32
+            _lseeki64(file, int64_t(offset), SEEK_SET);
+            int64_t n(_read(file, &memory[0], unsigned(chunk)));
+            #else
+            int64_t n(pread(file, &memory[0], chunk, off_t(offset)));
+            #endif
+            for (int64_t b = 0; b < n; b += 64) sum += memory[b];
+        }
+        std::chrono::duration<double> plain(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        {
+            lib::io::work::Uring ring(depth);
+            ring.registerBuffers(&memory[0], chunk, depth);
+
+            uint64_t offset(0);
+            for (unsigned b = 0; b < depth && offset < size; ++b, offset += chunk) {
+                ring.read(file, int(b), &memory[b * chunk], chunk, offset, b);
+            }
+
+            lib::io::work::Uring::Completion done;
+            while (ring.wait(done)) {
+                const unsigned b(unsigned(done.m_UserData));
+                uint8_t const* data(&memory[b * chunk]);
+                for (int64_t i = 0; i < done.m_Result; i += 64) sum -= data[i];
+
+                if (offset < size) {
+                    ring.read(file, int(b), &memory[b * chunk], chunk, offset, b);
+                    offset += chunk;
+                }
+            }
+
+            if (c == 0) {
+                output(
+                    vSummary
+                  , lib::format(
+                        "io_uring %s, registered buffers %s"
+                      , ring.isAsync() ? "in use" : "not available"
+                      , ring.hasRegisteredBuffers() ? "in use" : "not available"
+                    )
+                );
+            }
+        }
+        std::chrono::duration<double> ring(std::chrono::steady_clock::now() - start);
+
+        TEST(sum == 0);
+
+        output(
+            vSummary
+          , lib::format(
+                "%d MiB in %7zu byte chunks:  read() %7.1lf MiB/s; "
+                "io_uring (depth %u) %7.1lf MiB/s"
+              , int(mib)
+              , chunk
+              , mib / plain.count()
+              , depth
+              , mib / ring.count()
+            )
+        );
+    }
+
+    #ifdef _WIN32
+    _close(file);
+    #else
+    close(file);
+    #endif
+
+    //--------------------------------------------------------------------------
+    //  The threads:  reader to a summer, and a copy through the writer.        
+    //--------------------------------------------------------------------------
+    auto start = std::chrono::steady_clock::now();
+    {
+        lib::mp::work::ThreadableCollection threads;
+        lib::ds::shared_ptr<UringFileReader> reader;
+        lib::new_shared(reader, test_file.path(), 1 << 20, depth);
+        threads.push_back(reader);
+        lib::ds::shared_ptr<ChunkSummer> summer;
+        lib::new_shared(summer);
+        threads.push_back(summer);
+        reader->connect(summer);
+        threads.startAll();
+        threads.joinAll();
+        TEST(reader->error().empty());
+    }
+    std::chrono::duration<double> read(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    {
+        UringTestFile copy(0, "out");
+        lib::mp::work::ThreadableCollection threads;
+        lib::ds::shared_ptr<UringFileReader> reader;
+        lib::new_shared(reader, test_file.path(), 1 << 20, depth);
+        threads.push_back(reader);
+        lib::ds::shared_ptr<UringFileWriter> writer;
+        lib::new_shared(writer, copy.path(), 1 << 20, depth);
+        threads.push_back(writer);
+        reader->connect(writer);
+        threads.startAll();
+        threads.joinAll();
+        TEST(writer->error().empty());
+        TEST_IS_EQUAL(writer->bytesWritten(), size);
+    }
+    std::chrono::duration<double> copied(std::chrono::steady_clock::now() - start);
+
+    output(
+        vSummary
+      , lib::format(
+            "%d MiB in 1 MiB chunks:  reader thread %7.1lf MiB/s; "
+            "reader to writer copy %7.1lf MiB/s"
+          , int(mib)
+          , mib / read.count()
+          , mib / copied.count()
+        )
+    );
+
+} // void UringFileReaderTest::runTest3() //
+
+} // namespace test
+} // namespace msg
+} // namespace io
+} // namespace lib
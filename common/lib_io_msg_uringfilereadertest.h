@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_uringfilereadertest.h                                       
+//------------------------------------------------------------------------------
+#ifndef LIB_IO_MSG_URINGFILEREADERTEST_H
+#define LIB_IO_MSG_URINGFILEREADERTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace io {
+namespace msg {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: UringFileReaderTest                                              
+///                                                                             
+///@par Purpose:                                                                
+///         The UringFileReaderTest class provides the regression test for      
+///         the lib::io::msg::UringFileReader, lib::io::msg::UringFileWriter    
+///         and lib::io::work::Uring classes.                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class UringFileReaderTest : public dev::test::work::Test {
+    public:
+        UringFileReaderTest();
+        UringFileReaderTest(const UringFileReaderTest& that);
+        virtual ~UringFileReaderTest();
+        UringFileReaderTest& operator=(const UringFileReaderTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class UringFileReaderTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace msg
+} // namespace io
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_IO_MSG_URINGFILEREADERTEST_H //
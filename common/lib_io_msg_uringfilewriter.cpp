@@ -0,0 +1,228 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_uringfilewriter.cpp                                         
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_io_msg_uringfilewriter.h"
+#include "lib_string.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <system_error>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace lib {
+namespace io {
+namespace msg {
+
+//------------------------------------------------------------------------------
+///@param   path        The file to write (created, or truncated).              
+///@param   chunk_size  The size of each write; 0 is taken as 1.                
+///@param   depth       The most writes in flight at once.                      
+///@note    The file is opened when the thread starts.                          
+//------------------------------------------------------------------------------
+UringFileWriter::UringFileWriter(
+    const std::string&  path
+  , size_t              chunk_size
+  , unsigned            depth
+) : m_Path(path)
+  , m_ChunkSize(chunk_size < 1 ? 1 : chunk_size)
+  , m_Depth(depth < 1 ? 1 : depth)
+  , m_File(-1)
+  , m_Current(0)
+  , m_Filled(0)
+  , m_Offset(0)
+  , m_Written(0)
+{
+    setName("uring file writer");
+
+} // UringFileWriter::UringFileWriter() //
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+UringFileWriter::~UringFileWriter()
+{
+    m_Ring.reset();
+
+    #ifdef _WIN32
+    if (m_File >= 0) _close(m_File);
+    #else
+    if (m_File >= 0) close(m_File);
+    #endif
+
+} // UringFileWriter::~UringFileWriter() //
+
+//------------------------------------------------------------------------------
+///@brief   Open the file and set up the ring and its buffers.                  
+///@note    On failure the error is kept and the writer stops (so its           
+///         publishers are not held up).                                        
+//------------------------------------------------------------------------------
+bool UringFileWriter::initialize()
+{
+    #ifdef _WIN32
+    m_File = _open(
+        m_Path.c_str()
+      , _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY
+      , _S_IREAD | _S_IWRITE
+    );
+    #else
+    m_File = open(m_Path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    #endif
+
+    if (m_File < 0) {
+        fail(m_Path + ": " + std::generic_category().message(errno));
+        return true;
+    }
+
+    m_Memory.reset(new uint8_t[m_Depth * m_ChunkSize]);
+    m_Ring.reset(new lib::io::work::Uring(m_Depth));
+    m_Ring->registerBuffers(m_Memory.get(), m_ChunkSize, m_Depth);
+
+    m_Sizes.assign(m_Depth, 0);
+    m_Free.clear();
+    for (unsigned b = m_Depth; b > 1; --b) m_Free.push_back(b - 1);
+    m_Current = 0;
+    m_Filled = 0;
+    m_Offset = 0;
+    m_Written = 0;
+    return true;
+
+} // bool UringFileWriter::initialize() //
+
+//------------------------------------------------------------------------------
+///@brief   Gather the record into the current buffer, queueing each buffer as  
+///         it fills.                                                           
+//------------------------------------------------------------------------------
+void UringFileWriter::process(ConstRecordViewPtr& record)
+{
+    if (!m_Error.empty()) return;
+
+    uint8_t const* data(record->data());
+    size_t left(record->size());
+    while (left > 0) {
+        const size_t room(m_ChunkSize - m_Filled);
+        const size_t n(left < room ? left : room);
+        memcpy(m_Memory.get() + m_Current * m_ChunkSize + m_Filled, data, n);
+        m_Filled += n;
+        data += n;
+        left -= n;
+
+        if (m_Filled == m_ChunkSize) {
+            queueCurrent();
+            if (!m_Error.empty()) return;
+        }
+    }
+
+} // void UringFileWriter::process(ConstRecordViewPtr& record) //
+
+//------------------------------------------------------------------------------
+///@brief   Write what is left, and wait for every write.                       
+//------------------------------------------------------------------------------
+void UringFileWriter::beforeEndThread()
+{
+    if (m_Ring) {
+        if (m_Error.empty()) queueCurrent();
+        while (m_Error.empty() && m_Ring->inFlight() > 0) reap(true);
+        m_Ring.reset();
+    }
+
+    #ifdef _WIN32
+    if (m_File >= 0) _close(m_File);
+    #else
+    if (m_File >= 0) close(m_File);
+    #endif
+    m_File = -1;
+
+} // void UringFileWriter::beforeEndThread() //
+
+//------------------------------------------------------------------------------
+///@brief   Queue a write of the current buffer and move on to a free one       
+///         (waiting for a write to finish if there is none).                   
+//------------------------------------------------------------------------------
+void UringFileWriter::queueCurrent()
+{
+    if (m_Filled == 0) return;
+
+    m_Ring->write(
+        m_File, int(m_Current), m_Memory.get() + m_Current * m_ChunkSize
+      , m_Filled, m_Offset, m_Current
+    );
+    m_Sizes[m_Current] = m_Filled;
+    m_Offset += m_Filled;
+    m_Filled = 0;
+    if (!m_Ring->submit()) {
+        fail(m_Path + ": " + m_Ring->error());
+        return;
+    }
+
+    while (reap(false)) { }
+    while (m_Free.empty()) {
+        if (!reap(true)) return;
+    }
+    m_Current = m_Free.back();
+    m_Free.pop_back();
+
+} // void UringFileWriter::queueCurrent() //
+
+//------------------------------------------------------------------------------
+///@brief   Take a finished write (waiting for one if wait) and free its        
+///         buffer.                                                             
+///@return  false if there was none, or it failed.                              
+//------------------------------------------------------------------------------
+bool UringFileWriter::reap(bool wait)
+{
+    lib::io::work::Uring::Completion done;
+    if (!(wait ? m_Ring->wait(done) : m_Ring->peek(done))) {
+        if (wait) fail(m_Path + ": " + m_Ring->error());
+        return false;
+    }
+
+    const unsigned buffer(unsigned(done.m_UserData));
+    if (done.m_Result < 0) {
+        fail(
+            m_Path + ": "
+          + std::generic_category().message(int(-done.m_Result))
+        );
+        return false;
+    }
+    if (size_t(done.m_Result) != m_Sizes[buffer]) {
+        fail(
+            lib::format(
+                "%s: short write (%lld of %zu bytes)"
+              , m_Path.c_str()
+              , (long long) done.m_Result
+              , m_Sizes[buffer]
+            )
+        );
+        return false;
+    }
+
+    m_Written += uint64_t(done.m_Result);
+    m_Free.push_back(buffer);
+    return true;
+
+} // bool UringFileWriter::reap(bool wait) //
+
+//------------------------------------------------------------------------------
+///@brief   Keep the (first) error and stop taking records.                     
+//------------------------------------------------------------------------------
+void UringFileWriter::fail(const std::string& error)
+{
+    if (m_Error.empty()) m_Error = error;
+    stop();
+
+} // void UringFileWriter::fail(const std::string& error) //
+
+} // namespace msg
+} // namespace io
+} // namespace lib
@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+///@file lib_io_msg_uringfilewriter.h                                           
+///@brief Holds lib::io::msg::UringFileWriter, a subscriber that writes what    
+///       it is given to a file with many writes in flight.                     
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_IO_MSG_URINGFILEWRITER_H_FILE_GUARD
+#define LIB_IO_MSG_URINGFILEWRITER_H_FILE_GUARD
+
+#include "lib_io_msg_mappedfilereader.h"
+#include "lib_io_work_uring.h"
+#include "lib_msg_subscriber.h"
+
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace lib {
+namespace io {
+namespace msg {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Append each RecordView it is given to a file, a chunk at a time,    
+///         keeping up to depth writes in flight (lib::io::work::Uring).        
+///                                                                             
+///@par Purpose:                                                                
+///         The data is gathered into registered chunk size buffers; a full     
+///         buffer is queued to the kernel and the writer goes on gathering     
+///         into the next, so the thread only waits when every buffer is        
+///         being written.  What is left is written (and every write waited     
+///         for) when the publishers end.                                       
+///                                                                             
+///@note    Views are written one after another; their file offsets are not     
+///         used.                                                               
+///                                                                             
+///@note    The writer blocks on the ring, so it never runs as a pool task.     
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::ds::shared_ptr<lib::io::msg::UringFileWriter> writer;          
+///         lib::new_shared(writer, path, 1 << 20, 32);                         
+///         threads.push_back(writer);                                          
+///         reader->connect(writer);                                            
+///         ...                                                                 
+///         threads.joinAll();                                                  
+///         if (!writer->error().empty()) ...                                   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class UringFileWriter : public lib::msg::Subscriber<RecordView>
+{
+    public:
+        UringFileWriter(
+            const std::string&  path
+          , size_t              chunk_size = 1 << 20
+          , unsigned            depth = 32
+        );
+        virtual ~UringFileWriter();
+
+        const std::string& path() const { return m_Path; }
+        size_t chunkSize() const { return m_ChunkSize; }
+        unsigned depth() const { return m_Depth; }
+        uint64_t bytesWritten() const { return m_Written; }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return what went wrong (empty if nothing did).              
+        ///@note    Only meaningful once the thread has been joined.            
+        //----------------------------------------------------------------------
+        const std::string& error() const { return m_Error; }
+
+        bool canRunAsTask() const override { return false; }
+
+        void process(ConstRecordViewPtr& record) override;
+
+    protected:
+        bool initialize() override;
+        void beforeEndThread() override;
+
+    private:
+        void queueCurrent();
+        bool reap(bool wait);
+        void fail(const std::string& error);
+
+        std::string                         m_Path;
+        size_t                              m_ChunkSize;
+        unsigned                            m_Depth;
+        int                                 m_File;
+        std::unique_ptr<uint8_t[]>          m_Memory;
+        std::unique_ptr<lib::io::work::Uring>   m_Ring;
+        std::vector<unsigned>               m_Free;
+        std::vector<size_t>                 m_Sizes;
+        unsigned                            m_Current;
+        size_t                              m_Filled;
+        uint64_t                            m_Offset;
+        uint64_t                            m_Written;
+        std::string                         m_Error;
+
+}; // class UringFileWriter //
+
+} // namespace msg
+} // namespace io
+} // namespace lib
+
+#endif // #ifndef LIB_IO_MSG_URINGFILEWRITER_H_FILE_GUARD
@@ -0,0 +1,236 @@
+//------------------------------------------------------------------------------
+///@file lib_io_work_mappedfile.cpp                                             
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_io_work_mappedfile.h"
+#include "lib_string.h"
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <system_error>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace lib {
+namespace io {
+namespace work {
+
+//------------------------------------------------------------------------------
+///@brief   The count of chunks in use, shared by the file and its chunks.      
+//------------------------------------------------------------------------------
+struct MappedChunk::Window
+{
+    Window(size_t maximum) : m_Maximum(maximum < 1 ? 1 : maximum), m_InUse(0) { }
+
+    boost::mutex                m_Mutex;
+    boost::condition_variable   m_Released;
+    const size_t                m_Maximum;
+    size_t                      m_InUse;
+};
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static std::string errorText(int error)
+{
+    return std::generic_category().message(error);
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+MappedChunk::MappedChunk()
+    : m_Data(nullptr)
+    , m_Size(0)
+    , m_FileOffset(0)
+    , m_Mapping(nullptr)
+    , m_MappingSize(0)
+{
+} // MappedChunk::MappedChunk() //
+
+//------------------------------------------------------------------------------
+///@brief   Unmap the memory and give the chunk's place in the window back.     
+//------------------------------------------------------------------------------
+MappedChunk::~MappedChunk()
+{
+    #ifndef _WIN32
+    if (m_Mapping != nullptr) munmap(m_Mapping, m_MappingSize);
+    #endif
+
+    if (m_Window) {
+        boost::mutex::scoped_lock lock(m_Window->m_Mutex);
+        --m_Window->m_InUse;
+        m_Window->m_Released.notify_all();
+    }
+
+} // MappedChunk::~MappedChunk() //
+
+//------------------------------------------------------------------------------
+///@param   path        The file to read.                                       
+///@param   window      The most chunks that may be in use at once.             
+///@note    Check isOpen (and error) before using the file.                     
+//------------------------------------------------------------------------------
+MappedFile::MappedFile(const std::string& path, size_t window)
+    : m_Path(path)
+    , m_File(-1)
+    , m_Size(0)
+    , m_Populate(false)
+    , m_HugePages(false)
+    , m_Window(new MappedChunk::Window(window))
+{
+    #ifdef _WIN32
+    m_File = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+    #else
+    m_File = open(path.c_str(), O_RDONLY);
+    #endif
+
+    if (m_File < 0) {
+        m_Error = path + ": " + errorText(errno);
+        return;
+    }
+
+    #ifdef _WIN32
+    struct _stat64 status;
+    if (_fstat64(m_File, &status) == 0) m_Size = uint64_t(status.st_size);
+    #else
+    struct stat status;
+    if (fstat(m_File, &status) == 0) m_Size = uint64_t(status.st_size);
+    #endif
+
+} // MappedFile::MappedFile() //
+
+//------------------------------------------------------------------------------
+///@note    Chunks still in use stay mapped until they are released.            
+//------------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+    #ifdef _WIN32
+    if (m_File >= 0) _close(m_File);
+    #else
+    if (m_File >= 0) close(m_File);
+    #endif
+
+} // MappedFile::~MappedFile() //
+
+//------------------------------------------------------------------------------
+///@brief   Return the most chunks that may be in use at once.                  
+//------------------------------------------------------------------------------
+size_t MappedFile::window() const
+{
+    return m_Window->m_Maximum;
+
+} // size_t MappedFile::window() const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the number of chunks in use.                                 
+//------------------------------------------------------------------------------
+size_t MappedFile::mapped() const
+{
+    boost::mutex::scoped_lock lock(m_Window->m_Mutex);
+    return m_Window->m_InUse;
+
+} // size_t MappedFile::mapped() const //
+
+//------------------------------------------------------------------------------
+///@brief   Map size bytes of the file from offset (fewer at the end of the     
+///         file), waiting for a place in the window first.                     
+///@throw   std::runtime_error if the file is not open or cannot be mapped.     
+//------------------------------------------------------------------------------
+MappedChunkPtr MappedFile::map(uint64_t offset, size_t size)
+{
+    if (!isOpen()) throw std::runtime_error(m_Error);
+
+    if (offset >= m_Size) {
+        size = 0;
+    } else if (size > m_Size - offset) {
+        size = size_t(m_Size - offset);
+    }
+
+    {
+        boost::mutex::scoped_lock lock(m_Window->m_Mutex);
+        while (m_Window->m_InUse >= m_Window->m_Maximum) {
+            m_Window->m_Released.wait(lock);
+        }
+        ++m_Window->m_InUse;
+    }
+
+    //--------------------------------------------------------------------------
+    //  From here on the chunk's destructor gives the place back.               
+    //--------------------------------------------------------------------------
+    lib::ds::shared_ptr<MappedChunk> chunk(new MappedChunk);
+    chunk->m_Window = m_Window;
+    chunk->m_FileOffset = offset;
+    chunk->m_Size = size;
+
+    if (size == 0) return chunk;
+
+    #ifdef _WIN32
+    chunk->m_Copy.reset(new uint8_t[size]);
+    if (   _lseeki64(m_File, int64_t(offset), SEEK_SET) < 0
+        || _read(m_File, chunk->m_Copy.get(), unsigned(size)) != int(size)
+    ) {
+        throw std::runtime_error(m_Path + ": " + errorText(errno));
+    }
+    chunk->m_Data = chunk->m_Copy.get();
+    #else
+    //--------------------------------------------------------------------------
+    //  mmap wants a page aligned offset; the chunk starts part way in.         
+    //--------------------------------------------------------------------------
+    static const uint64_t s_PageSize(uint64_t(sysconf(_SC_PAGESIZE)));
+    const uint64_t start(offset - offset % s_PageSize);
+    const size_t lead(size_t(offset - start));
+
+    int flags(MAP_PRIVATE);
+    #ifdef MAP_POPULATE
+    if (m_Populate) flags |= MAP_POPULATE;
+    #endif
+
+    void* mapping(
+        mmap(nullptr, size + lead, PROT_READ, flags, m_File, off_t(start))
+    );
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error(
+            lib::format(
+                "%s: mmap of %zu bytes at %llu: %s"
+              , m_Path.c_str()
+              , size + lead
+              , (unsigned long long) start
+              , errorText(errno).c_str()
+            )
+        );
+    }
+
+    chunk->m_Mapping = mapping;
+    chunk->m_MappingSize = size + lead;
+    chunk->m_Data = static_cast<uint8_t const*>(mapping) + lead;
+
+    //--------------------------------------------------------------------------
+    //  Hints only:  failures are ignored.                                      
+    //--------------------------------------------------------------------------
+    #ifdef MADV_SEQUENTIAL
+    madvise(mapping, size + lead, MADV_SEQUENTIAL);
+    #endif
+    #ifdef MADV_HUGEPAGE
+    if (m_HugePages) madvise(mapping, size + lead, MADV_HUGEPAGE);
+    #endif
+    #endif
+
+    return chunk;
+
+} // MappedChunkPtr MappedFile::map(uint64_t offset, size_t size) //
+
+} // namespace work
+} // namespace io
+} // namespace lib
@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+///@file lib_io_work_mappedfile.h                                               
+///@brief Holds lib::io::work::MappedFile, a file read by mapping a window of   
+///       chunks of it into memory.                                             
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_IO_WORK_MAPPEDFILE_H_FILE_GUARD
+#define LIB_IO_WORK_MAPPEDFILE_H_FILE_GUARD
+
+#include "lib_ds_shared_ptr.h"
+
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace io {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   A piece of a MappedFile that is in memory.                          
+///                                                                             
+///@note    The memory is unmapped (and its place in the file's window given    
+///         back) when the last shared_ptr to the chunk goes away, which may    
+///         well be after the MappedFile itself is gone.                        
+///                                                                             
+///@par Thread Safety:  class                                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class MappedChunk
+{
+    public:
+        virtual ~MappedChunk();
+
+        uint8_t const* data() const { return m_Data; }
+        size_t size() const { return m_Size; }
+        uint64_t fileOffset() const { return m_FileOffset; }
+
+    private:
+        friend class MappedFile;
+        struct Window;
+
+        MappedChunk();
+        MappedChunk(const MappedChunk& that);
+        MappedChunk& operator=(const MappedChunk& that);
+
+        uint8_t const*          m_Data;
+        size_t                  m_Size;
+        uint64_t                m_FileOffset;
+
+        void*                   m_Mapping;  ///< nullptr if m_Copy was read.
+        size_t                  m_MappingSize;
+        std::unique_ptr<uint8_t[]>  m_Copy;
+        std::shared_ptr<Window> m_Window;
+
+}; // class MappedChunk //
+
+using MappedChunkPtr = lib::ds::shared_ptr<const MappedChunk>;
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Read a (large) file by mapping it into memory a chunk at a time,    
+///         with no more than a window's worth of chunks mapped at once.        
+///                                                                             
+///@par Purpose:                                                                
+///         Reading a recording with read() copies every byte from the page     
+///         cache into a buffer.  Mapping it lets the data be used where it     
+///         lies, and mapping it in chunks keeps the address space (and the     
+///         pages the reader holds on to) bounded however large the file is.    
+///                                                                             
+///@par Window                                                                  
+///         map() waits while window() chunks are still in use, so a reader     
+///         that gets ahead of its consumers stops rather than mapping more.    
+///                                                                             
+///@par Mapping Hints                                                           
+///         Each chunk is advised MADV_SEQUENTIAL.  setPopulate(true) maps      
+///         with MAP_POPULATE (the pages are read in before map returns);       
+///         setHugePages(true) asks for transparent huge pages                  
+///         (MADV_HUGEPAGE), which the kernel only honours for files on         
+///         file systems that support them.  Both are hints:  where they are    
+///         not available they are ignored.                                     
+///                                                                             
+///@note    Where mmap is not available (Windows), a chunk is read into         
+///         memory instead; the interface is the same.                          
+///                                                                             
+///@par Thread Safety:  class                                                   
+///         map may be called from any thread.                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         const size_t chunk(64 << 20);                                       
+///         lib::io::work::MappedFile file(path, 4);                            
+///         if (!file.isOpen()) throw std::runtime_error(file.error());         
+///                                                                             
+///         for (uint64_t offset = 0; offset < file.size(); offset += chunk) {  
+///             lib::io::work::MappedChunkPtr data(file.map(offset, chunk));    
+///             process(data->data(), data->size());                            
+///         }                                                                   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class MappedFile
+{
+    public:
+        MappedFile(const std::string& path, size_t window = 4);
+        virtual ~MappedFile();
+
+        bool isOpen() const { return m_File >= 0; }
+        const std::string& error() const { return m_Error; }
+        const std::string& path() const { return m_Path; }
+        uint64_t size() const { return m_Size; }
+
+        size_t window() const;
+        size_t mapped() const;
+
+        void setPopulate(bool populate) { m_Populate = populate; }
+        void setHugePages(bool huge_pages) { m_HugePages = huge_pages; }
+
+        MappedChunkPtr map(uint64_t offset, size_t size);
+
+    private:
+        MappedFile(const MappedFile& that);
+        MappedFile& operator=(const MappedFile& that);
+
+        std::string                             m_Path;
+        std::string                             m_Error;
+        int                                     m_File;
+        uint64_t                                m_Size;
+        bool                                    m_Populate;
+        bool                                    m_HugePages;
+        std::shared_ptr<MappedChunk::Window>    m_Window;
+
+}; // class MappedFile //
+
+} // namespace work
+} // namespace io
+} // namespace lib
+
+#endif // #ifndef LIB_IO_WORK_MAPPEDFILE_H_FILE_GUARD
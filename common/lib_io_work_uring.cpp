@@ -0,0 +1,441 @@
+//------------------------------------------------------------------------------
+///@file lib_io_work_uring.cpp                                                  
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_io_work_uring.h"
+
+#include <errno.h>
+#include <string.h>
+#include <system_error>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define URING_AVAILABLE
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <vector>
+#endif
+
+namespace lib {
+namespace io {
+namespace work {
+
+#ifdef URING_AVAILABLE
+//------------------------------------------------------------------------------
+//  The ring's indexes are shared with the kernel:  the producer publishes its  
+//  index with release, the consumer reads the other's with acquire.            
+//------------------------------------------------------------------------------
+static unsigned loadAcquire(unsigned const* index)
+{
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+static void storeRelease(unsigned* index, unsigned value)
+{
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+#endif
+
+//------------------------------------------------------------------------------
+///@param   depth   The most reads and writes in flight at once (at least 1).   
+///@note    If the ring cannot be set up, error() says why and the reads and    
+///         writes are done synchronously.                                      
+//------------------------------------------------------------------------------
+Uring::Uring(unsigned depth)
+    : m_Depth(depth < 1 ? 1 : depth)
+    , m_InFlight(0)
+    , m_Unsubmitted(0)
+    , m_Buffers(nullptr)
+    , m_BufferSize(0)
+    , m_BufferCount(0)
+    , m_Ring(-1)
+    , m_SqMapping(nullptr)
+    , m_SqMappingSize(0)
+    , m_CqMapping(nullptr)
+    , m_CqMappingSize(0)
+    , m_Sqes(nullptr)
+    , m_SqesSize(0)
+    , m_SqHead(nullptr)
+    , m_SqTail(nullptr)
+    , m_SqMask(nullptr)
+    , m_SqArray(nullptr)
+    , m_SqEntries(0)
+    , m_CqHead(nullptr)
+    , m_CqTail(nullptr)
+    , m_CqMask(nullptr)
+    , m_Cqes(nullptr)
+{
+    #ifdef URING_AVAILABLE
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    const int ring(int(syscall(__NR_io_uring_setup, m_Depth, &params)));
+    if (ring < 0) {
+        m_Error = "io_uring_setup: " + std::generic_category().message(errno);
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //  Map the submission and completion rings (one mapping on kernels that    
+    //  allow it) and the submission queue entries.                             
+    //--------------------------------------------------------------------------
+    m_SqMappingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_CqMappingSize =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single((params.features & IORING_FEAT_SINGLE_MMAP) != 0);
+    if (single) {
+        if (m_CqMappingSize > m_SqMappingSize) m_SqMappingSize = m_CqMappingSize;
+        m_CqMappingSize = 0;
+    }
+
+    void* sq(
+        mmap(
+            nullptr, m_SqMappingSize, PROT_READ | PROT_WRITE
+          , MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING
+        )
+    );
+    void* cq(sq);
+    if (sq != MAP_FAILED && !single) {
+        cq = mmap(
+            nullptr, m_CqMappingSize, PROT_READ | PROT_WRITE
+          , MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING
+        );
+    }
+    m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes(MAP_FAILED);
+    if (sq != MAP_FAILED && cq != MAP_FAILED) {
+        sqes = mmap(
+            nullptr, m_SqesSize, PROT_READ | PROT_WRITE
+          , MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES
+        );
+    }
+
+    if (sqes == MAP_FAILED) {
+        m_Error = "io_uring mmap: " + std::generic_category().message(errno);
+        if (cq != MAP_FAILED && cq != sq) munmap(cq, m_CqMappingSize);
+        if (sq != MAP_FAILED) munmap(sq, m_SqMappingSize);
+        close(ring);
+        return;
+    }
+
+    uint8_t* s(static_cast<uint8_t*>(sq));
+    uint8_t* c(static_cast<uint8_t*>(cq));
+    m_SqMapping = sq;
+    m_CqMapping = single ? nullptr : cq;
+    m_Sqes = sqes;
+    m_SqHead = reinterpret_cast<unsigned*>(s + params.sq_off.head);
+    m_SqTail = reinterpret_cast<unsigned*>(s + params.sq_off.tail);
+    m_SqMask = reinterpret_cast<unsigned*>(s + params.sq_off.ring_mask);
+    m_SqArray = reinterpret_cast<unsigned*>(s + params.sq_off.array);
+    m_SqEntries = params.sq_entries;
+    m_CqHead = reinterpret_cast<unsigned*>(c + params.cq_off.head);
+    m_CqTail = reinterpret_cast<unsigned*>(c + params.cq_off.tail);
+    m_CqMask = reinterpret_cast<unsigned*>(c + params.cq_off.ring_mask);
+    m_Cqes = c + params.cq_off.cqes;
+    m_Ring = ring;
+    #else
+    m_Error = "io_uring is not available";
+    #endif
+
+} // Uring::Uring() //
+
+//------------------------------------------------------------------------------
+///@note    Reads and writes still in flight are waited for first:  the kernel  
+///         may be writing into their memory.                                   
+//------------------------------------------------------------------------------
+Uring::~Uring()
+{
+    #ifdef URING_AVAILABLE
+    if (m_Ring < 0) return;
+
+    submit();
+    Completion done;
+    while (m_InFlight > 0 && wait(done)) { }
+
+    munmap(m_Sqes, m_SqesSize);
+    if (m_CqMapping != nullptr) munmap(m_CqMapping, m_CqMappingSize);
+    munmap(m_SqMapping, m_SqMappingSize);
+    close(m_Ring);
+    #endif
+
+} // Uring::~Uring() //
+
+//------------------------------------------------------------------------------
+///@brief   Register count buffers of size bytes each, laid end to end from     
+///         memory, for read and write by index.                                
+///@return  false if the kernel refused them (RLIMIT_MEMLOCK is the usual       
+///         reason; see error()); the buffers may still be used by index, but   
+///         the operations are the ordinary (not _FIXED) ones.                  
+///@note    The memory must outlive the ring.                                   
+//------------------------------------------------------------------------------
+bool Uring::registerBuffers(uint8_t* memory, size_t size, unsigned count)
+{
+    m_Buffers = memory;
+    m_BufferSize = size;
+    m_BufferCount = count;
+
+    #ifdef URING_AVAILABLE
+    if (m_Ring < 0) return false;
+
+    std::vector<iovec> buffers(count);
+    for (unsigned b = 0; b < count; ++b) {
+        buffers[b].iov_base = memory + b * size;
+        buffers[b].iov_len = size;
+    }
+
+    const int result(
+        int(
+            syscall(
+                __NR_io_uring_register, m_Ring, IORING_REGISTER_BUFFERS
+              , &buffers[0], count
+            )
+        )
+    );
+    if (result < 0) {
+        m_Error = "io_uring_register: " + std::generic_category().message(errno);
+        m_Buffers = nullptr;
+        return false;
+    }
+    return true;
+    #else
+    m_Buffers = nullptr;
+    return false;
+    #endif
+
+} // bool Uring::registerBuffers(uint8_t* memory, size_t size, unsigned count) //
+
+//------------------------------------------------------------------------------
+///@brief   Queue a read of size bytes from file at offset into data.           
+///@param   buffer      The registered buffer data is in (-1 if none).          
+///@param   user_data   Handed back with the completion.                        
+///@return  false if depth() operations are already in flight.                  
+///@note    Nothing is sent to the kernel until submit (or wait).               
+//------------------------------------------------------------------------------
+bool Uring::read(
+    int         file
+  , int         buffer
+  , void*       data
+  , size_t      size
+  , uint64_t    offset
+  , uint64_t    user_data
+)
+{
+    #ifdef URING_AVAILABLE
+    const int op(
+        buffer >= 0 && m_Buffers != nullptr ? IORING_OP_READ_FIXED : IORING_OP_READ
+    );
+    #else
+    const int op(0);
+    #endif
+    return queue(op, file, buffer, data, size, offset, user_data);
+
+} // bool Uring::read() //
+
+//------------------------------------------------------------------------------
+///@brief   Queue a write of size bytes from data to file at offset.            
+///@copydetails read                                                            
+//------------------------------------------------------------------------------
+bool Uring::write(
+    int         file
+  , int         buffer
+  , void const* data
+  , size_t      size
+  , uint64_t    offset
+  , uint64_t    user_data
+)
+{
+    #ifdef URING_AVAILABLE
+    const int op(
+        buffer >= 0 && m_Buffers != nullptr
+      ? IORING_OP_WRITE_FIXED
+      : IORING_OP_WRITE
+    );
+    #else
+    const int op(1);
+    #endif
+    return queue(
+        op, file, buffer, const_cast<void*>(data), size, offset, user_data
+    );
+
+} // bool Uring::write() //
+
+//------------------------------------------------------------------------------
+///@brief   Put an operation in the submission ring (or, without one, do it).   
+//------------------------------------------------------------------------------
+bool Uring::queue(
+    int         op
+  , int         file
+  , int         buffer
+  , void*       data
+  , size_t      size
+  , uint64_t    offset
+  , uint64_t    user_data
+)
+{
+    if (m_InFlight >= m_Depth) return false;
+
+    #ifdef URING_AVAILABLE
+    if (m_Ring >= 0) {
+        const unsigned tail(*m_SqTail);
+        if (tail - loadAcquire(m_SqHead) >= m_SqEntries) return false;
+
+        const unsigned index(tail & *m_SqMask);
+        io_uring_sqe& sqe(static_cast<io_uring_sqe*>(m_Sqes)[index]);
+        memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = uint8_t(op);
+        sqe.fd = file;
+        sqe.off = offset;
+        sqe.addr = uint64_t(uintptr_t(data));
+        sqe.len = unsigned(size);
+        sqe.user_data = user_data;
+        if (op == IORING_OP_READ_FIXED || op == IORING_OP_WRITE_FIXED) {
+            sqe.buf_index = uint16_t(buffer);
+        }
+
+        m_SqArray[index] = index;
+        storeRelease(m_SqTail, tail + 1);
+        ++m_Unsubmitted;
+        ++m_InFlight;
+        return true;
+    }
+    const bool reading(
+        op == IORING_OP_READ || op == IORING_OP_READ_FIXED
+    );
+    #else
+    const bool reading(op == 0);
+    #endif
+
+    //--------------------------------------------------------------------------
+    //  Synchronously.                                                          
+    //--------------------------------------------------------------------------
+    (void) buffer;
+    Completion done;
+    done.m_UserData = user_data;
+
+    #ifdef _WIN32
+    int64_t result(-1);
+    if (_lseeki64(file, int64_t(offset), SEEK_SET) >= 0) {
+        result = reading
+          ? _read(file, data, unsigned(size))
+          : _write(file, data, unsigned(size));
+    }
+    #else
+    const int64_t result(
+        reading
+      ? pread(file, data, size, off_t(offset))
+      : pwrite(file, data, size, off_t(offset))
+    );
+    #endif
+    done.m_Result = result < 0 ? -int64_t(errno) : result;
+
+    m_Done.push_back(done);
+    ++m_InFlight;
+    return true;
+
+} // bool Uring::queue() //
+
+//------------------------------------------------------------------------------
+///@brief   Send the queued operations to the kernel.                           
+///@return  false (see error()) if the kernel would not take them.              
+//------------------------------------------------------------------------------
+bool Uring::submit()
+{
+    return enter(0);
+
+} // bool Uring::submit() //
+
+//------------------------------------------------------------------------------
+///@brief   Submit anything queued, and (with wait_count) wait for completions. 
+//------------------------------------------------------------------------------
+bool Uring::enter(unsigned wait_count)
+{
+    #ifdef URING_AVAILABLE
+    if (m_Ring < 0 || (m_Unsubmitted == 0 && wait_count == 0)) return true;
+
+    for (;;) {
+        const int result(
+            int(
+                syscall(
+                    __NR_io_uring_enter, m_Ring, m_Unsubmitted, wait_count
+                  , wait_count > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0
+                )
+            )
+        );
+        if (result >= 0) {
+            m_Unsubmitted -= unsigned(result) < m_Unsubmitted
+              ? unsigned(result)
+              : m_Unsubmitted;
+            if (m_Unsubmitted == 0 || wait_count > 0) return true;
+        } else if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            m_Error = "io_uring_enter: " + std::generic_category().message(errno);
+            return false;
+        }
+    }
+    #else
+    (void) wait_count;
+    return true;
+    #endif
+
+} // bool Uring::enter(unsigned wait_count) //
+
+//------------------------------------------------------------------------------
+///@brief   Take a completion if there is one, without waiting.                 
+//------------------------------------------------------------------------------
+bool Uring::peek(Completion& completion)
+{
+    if (!m_Done.empty()) {
+        completion = m_Done.front();
+        m_Done.pop_front();
+        --m_InFlight;
+        return true;
+    }
+
+    #ifdef URING_AVAILABLE
+    if (m_Ring >= 0) {
+        const unsigned head(*m_CqHead);
+        if (head == loadAcquire(m_CqTail)) return false;
+
+        io_uring_cqe const& cqe(
+            static_cast<io_uring_cqe const*>(m_Cqes)[head & *m_CqMask]
+        );
+        completion.m_UserData = cqe.user_data;
+        completion.m_Result = cqe.res;
+        storeRelease(m_CqHead, head + 1);
+        --m_InFlight;
+        return true;
+    }
+    #endif
+
+    return false;
+
+} // bool Uring::peek(Completion& completion) //
+
+//------------------------------------------------------------------------------
+///@brief   Submit anything queued and wait for (and take) a completion.        
+///@return  false if nothing is in flight, or the kernel failed (see error()).  
+//------------------------------------------------------------------------------
+bool Uring::wait(Completion& completion)
+{
+    if (m_InFlight == 0) return false;
+
+    while (!peek(completion)) {
+        if (!enter(1)) return false;
+    }
+    return true;
+
+} // bool Uring::wait(Completion& completion) //
+
+} // namespace work
+} // namespace io
+} // namespace lib
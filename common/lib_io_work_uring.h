@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+///@file lib_io_work_uring.h                                                    
+///@brief Holds lib::io::work::Uring, a queue of asynchronous file reads and    
+///       writes (Linux io_uring).                                              
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_IO_WORK_URING_H_FILE_GUARD
+#define LIB_IO_WORK_URING_H_FILE_GUARD
+
+#include <deque>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace io {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Reads and writes that are queued to the kernel and complete later   
+///         (in any order).                                                     
+///                                                                             
+///@par Purpose:                                                                
+///         A blocking read() leaves the device idle while the thread handles   
+///         the data, and keeps at most one request outstanding.  NVMe drives   
+///         only reach their throughput with many requests outstanding:  the    
+///         ring lets one thread keep depth() of them in flight.                
+///                                                                             
+///@par Registered Buffers                                                      
+///         registerBuffers hands the kernel a block of memory once (pinned     
+///         and mapped up front), and reads and writes into its buffers use     
+///         the _FIXED operations, which skip mapping the memory on every       
+///         request.  Without registered buffers any memory may be used.        
+///                                                                             
+///@par Fallback                                                                
+///         Where io_uring is not available (not Linux, an old kernel, or       
+///         forbidden by a seccomp filter), isAsync() is false and each read    
+///         and write is done (with pread/pwrite) when it is queued; its        
+///         completion is there for the next wait.  Callers need not care.      
+///                                                                             
+///@note    This is the minimum of io_uring that the file readers and writers   
+///         need, done with the system calls directly (no liburing).            
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::io::work::Uring ring(32);                                      
+///         ring.registerBuffers(memory, chunk, 32);                            
+///                                                                             
+///         ring.read(fd, 0, memory, chunk, 0, 0);   // buffer 0, user data 0   
+///         ring.submit();                                                      
+///                                                                             
+///         lib::io::work::Uring::Completion done;                              
+///         ring.wait(done);                        // done.m_Result is bytes   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class Uring
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   A finished read or write.                                   
+        //----------------------------------------------------------------------
+        struct Completion
+        {
+            uint64_t    m_UserData;     ///< As given to read or write.
+            int64_t     m_Result;       ///< Bytes transferred; -errno if not.
+        };
+
+        explicit Uring(unsigned depth);
+        virtual ~Uring();
+
+        bool isAsync() const { return m_Ring >= 0; }
+        const std::string& error() const { return m_Error; }
+
+        unsigned depth() const { return m_Depth; }
+        unsigned inFlight() const { return m_InFlight; }
+
+        bool registerBuffers(uint8_t* memory, size_t size, unsigned count);
+        bool hasRegisteredBuffers() const { return m_Buffers != nullptr; }
+
+        bool read(
+            int         file
+          , int         buffer
+          , void*       data
+          , size_t      size
+          , uint64_t    offset
+          , uint64_t    user_data
+        );
+        bool write(
+            int         file
+          , int         buffer
+          , void const* data
+          , size_t      size
+          , uint64_t    offset
+          , uint64_t    user_data
+        );
+
+        bool submit();
+        bool wait(Completion& completion);
+        bool peek(Completion& completion);
+
+    private:
+        Uring(const Uring& that);
+        Uring& operator=(const Uring& that);
+
+        bool queue(
+            int         op
+          , int         file
+          , int         buffer
+          , void*       data
+          , size_t      size
+          , uint64_t    offset
+          , uint64_t    user_data
+        );
+        bool enter(unsigned wait_count);
+
+        unsigned            m_Depth;
+        unsigned            m_InFlight;
+        unsigned            m_Unsubmitted;
+        std::string         m_Error;
+        uint8_t*            m_Buffers;
+        size_t              m_BufferSize;
+        unsigned            m_BufferCount;
+
+        //----------------------------------------------------------------------
+        //  The kernel's rings (m_Ring < 0 when not async).                     
+        //----------------------------------------------------------------------
+        int                 m_Ring;
+        void*               m_SqMapping;
+        size_t              m_SqMappingSize;
+        void*               m_CqMapping;
+        size_t              m_CqMappingSize;
+        void*               m_Sqes;
+        size_t              m_SqesSize;
+        unsigned*           m_SqHead;
+        unsigned*           m_SqTail;
+        unsigned*           m_SqMask;
+        unsigned*           m_SqArray;
+        unsigned            m_SqEntries;
+        unsigned*           m_CqHead;
+        unsigned*           m_CqTail;
+        unsigned*           m_CqMask;
+        void*               m_Cqes;
+
+        std::deque<Completion>  m_Done;     ///< Completed synchronously.
+
+}; // class Uring //
+
+} // namespace work
+} // namespace io
+} // namespace lib
+
+#endif // #ifndef LIB_IO_WORK_URING_H_FILE_GUARD
@@ -10,6 +10,8 @@
 ///                                                                             
 ///@todo    Make use of lib_ds_enum.h                                           
 ///                                                                             
+///@version 2026-10-16  DHF     Added LIB_LOG_ASYNC_SINK                        
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2019-10-02  KJS/DHF Added MSG_INSUFFICIENT_DATA                     
@@ -81,6 +83,7 @@ using class_t = uint16_t;
 static const class_t MAIN                                              = 0x0001;
 static const class_t LIB_MP_THREADABLE_COLLECTION                      = 0x0002;
 static const class_t LIB_MP_THREADINFO                                 = 0x0003;
+static const class_t LIB_LOG_ASYNC_SINK                                = 0x0004;
 static const class_t CLASS_UNKNOWN                                     = 0xFFFF;
 
 
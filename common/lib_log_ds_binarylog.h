@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+///@file lib_log_ds_binarylog.h                                                 
+///@brief Holds lib::log::ds::BinaryLog, the layout of a binary log file, and   
+///       lib::log::ds::BinaryLogBlock, its index entries.                      
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_LOG_DS_BINARYLOG_H_FILE_GUARD
+#define LIB_LOG_DS_BINARYLOG_H_FILE_GUARD
+
+#include "lib_log_ds.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace log {
+namespace ds {
+
+//------------------------------------------------------------------------------
+///@brief   Where a block of a binary log is and what is in it.                 
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+struct BinaryLogBlock
+{
+    uint64_t    offset;     ///< of the block's header in the file
+    uint32_t    size;       ///< bytes after the header
+    uint32_t    records;    ///< messages in the block
+    int64_t     first;      ///< earliest time stamp, ns since 1970
+    int64_t     last;       ///< latest time stamp, ns since 1970
+    level_t     worst;      ///< the most severe (lowest) level in the block
+
+}; // struct BinaryLogBlock //
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   The layout of a binary log file (lib::log::work::BinaryLogWriter    
+///         and BinaryLogReader) and the encoding helpers both use.             
+///                                                                             
+///@par File                                                                    
+///         -   fileMagic() (8 bytes).                                          
+///         -   Blocks, one after the other.                                    
+///         -   The index (written by close()):  indexMagic(), a uint32 count   
+///             and an INDEX_ENTRY_SIZE entry per block (offset, size,          
+///             records, first, last, worst as in the block header).            
+///         -   The tail:  the index's offset (uint64) and endMagic().          
+///         A file without its tail (the writer never closed it) is still       
+///         read:  the reader walks the block headers instead.                  
+///                                                                             
+///@par Block                                                                   
+///         A BLOCK_HEADER_SIZE header (BLOCK_MAGIC, size, records, first,      
+///         last, worst) and then the payload:  a string table (a varint        
+///         count, then each string as a varint length and its bytes) and       
+///         the records.  Each block stands alone, so a reader can start at     
+///         any one of them.                                                    
+///                                                                             
+///@par Record                                                                  
+///         Varints (unsigned LEB128; zig-zag where signed):                    
+///             -   time stamp in microseconds (Message keeps no finer)         
+///                 less the previous record's (the first less 0)               
+///             -   class id                                                    
+///             -   message id                                                  
+///             -   severity (one byte)                                         
+///             -   pid less the previous record's                              
+///             -   the mnemonic's index in the string table                    
+///             -   the text's index in the string table                        
+///                                                                             
+///@par Byte Order                                                              
+///         The fixed width fields are little endian.                           
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+struct BinaryLog
+{
+    static const size_t BLOCK_HEADER_SIZE = 32;
+    static const size_t INDEX_ENTRY_SIZE = 33;
+    static const size_t TAIL_SIZE = 16;
+
+    static const uint32_t BLOCK_MAGIC = 0x4B4C4244;     ///< "DBLK"
+
+    static const char* fileMagic() { return "DATRLOG1"; }
+    static const char* indexMagic() { return "DATRLIDX"; }
+    static const char* endMagic() { return "DATRLEND"; }
+
+    //--------------------------------------------------------------------------
+    //  Fixed width, little endian.                                             
+    //--------------------------------------------------------------------------
+    static void put32(std::string& out, uint32_t value)
+    {
+        for (int b = 0; b < 4; ++b) out += char(value >> (8 * b));
+    }
+    static void put64(std::string& out, uint64_t value)
+    {
+        for (int b = 0; b < 8; ++b) out += char(value >> (8 * b));
+    }
+    static uint32_t get32(const uint8_t* in)
+    {
+        return uint32_t(in[0])       | uint32_t(in[1]) << 8
+             | uint32_t(in[2]) << 16 | uint32_t(in[3]) << 24;
+    }
+    static uint64_t get64(const uint8_t* in)
+    {
+        return uint64_t(get32(in)) | uint64_t(get32(in + 4)) << 32;
+    }
+
+    //--------------------------------------------------------------------------
+    //  Variable width.                                                         
+    //--------------------------------------------------------------------------
+    static void putVarint(std::string& out, uint64_t value)
+    {
+        while (value >= 0x80) {
+            out += char(value | 0x80);
+            value >>= 7;
+        }
+        out += char(value);
+    }
+
+    //--------------------------------------------------------------------------
+    ///@return  false (and in unmoved) if the varint runs past end.             
+    //--------------------------------------------------------------------------
+    static bool getVarint(
+        const uint8_t*& in
+      , const uint8_t* end
+      , uint64_t& value
+    )
+    {
+        value = 0;
+        const uint8_t* p(in);
+        for (int shift = 0; p < end && shift < 64; shift += 7) {
+            value |= uint64_t(*p & 0x7F) << shift;
+            if ((*p++ & 0x80) == 0) {
+                in = p;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static uint64_t zigzag(int64_t value)
+    {
+        return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+    }
+    static int64_t unzigzag(uint64_t value)
+    {
+        return int64_t(value >> 1) ^ -int64_t(value & 1);
+    }
+
+    //--------------------------------------------------------------------------
+    //  The header of a block and an index entry (the header less its magic     
+    //  number, plus the offset).                                               
+    //--------------------------------------------------------------------------
+    static void putBlockHeader(std::string& out, const BinaryLogBlock& block)
+    {
+        put32(out, BLOCK_MAGIC);
+        put32(out, block.size);
+        put32(out, block.records);
+        put64(out, uint64_t(block.first));
+        put64(out, uint64_t(block.last));
+        out += char(block.worst);
+        out.append(3, '\0');
+    }
+    static bool getBlockHeader(const uint8_t* in, BinaryLogBlock& block)
+    {
+        if (get32(in) != BLOCK_MAGIC) return false;
+        block.size      = get32(in + 4);
+        block.records   = get32(in + 8);
+        block.first     = int64_t(get64(in + 12));
+        block.last      = int64_t(get64(in + 20));
+        block.worst     = level_t(in[28]);
+        return true;
+    }
+    static void putIndexEntry(std::string& out, const BinaryLogBlock& block)
+    {
+        put64(out, block.offset);
+        put32(out, block.size);
+        put32(out, block.records);
+        put64(out, uint64_t(block.first));
+        put64(out, uint64_t(block.last));
+        out += char(block.worst);
+    }
+    static void getIndexEntry(const uint8_t* in, BinaryLogBlock& block)
+    {
+        block.offset    = get64(in);
+        block.size      = get32(in + 8);
+        block.records   = get32(in + 12);
+        block.first     = int64_t(get64(in + 16));
+        block.last      = int64_t(get64(in + 24));
+        block.worst     = level_t(in[32]);
+    }
+
+}; // struct BinaryLog //
+
+} // namespace ds
+} // namespace log
+} // namespace lib
+
+#endif // #ifndef LIB_LOG_DS_BINARYLOG_H_FILE_GUARD
@@ -0,0 +1,489 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_asyncsink.cpp                                             
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_log_work_asyncsink.h"
+#include "lib_log_work.h"
+#include "lib_string.h"
+#include "lib_time_work_clock.h"
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>                   // nanosleep
+#include <unistd.h>                 // getpid
+
+#ifdef IS_VISUAL_STUDIO
+    #define LIB_LOG_WORK_THREAD_LOCAL __declspec(thread)
+#else
+    #define LIB_LOG_WORK_THREAD_LOCAL __thread
+#endif
+
+namespace lib {
+namespace log {
+namespace work {
+
+//------------------------------------------------------------------------------
+//  A slot of a ring, and the record header at the start of a record's first    
+//  slot.  The text follows the header and runs on into the next slots.         
+//------------------------------------------------------------------------------
+static const size_t s_SlotSize(128);
+static const size_t s_MinimumCapacity(64);
+
+struct Slot
+{
+    char    m_Bytes[s_SlotSize];
+};
+
+struct Header
+{
+    int64_t         m_TimeStamp;        ///< ns since 1970
+    ds::messageid_t m_MessageID;
+    ds::class_t     m_ClassID;
+    uint16_t        m_Size;             ///< bytes of text
+    uint8_t         m_Severity;
+    uint8_t         m_Mnemonic;         ///< 0, or m_Mnemonics' index + 1
+    uint8_t         m_Slots;            ///< slots the record takes
+};
+
+static const size_t s_FirstText(s_SlotSize - sizeof(Header));
+
+//------------------------------------------------------------------------------
+//  The slots a record with size bytes of text takes.                           
+//------------------------------------------------------------------------------
+static size_t slotsFor(size_t size)
+{
+    return size <= s_FirstText
+         ? 1
+         : 1 + (size - s_FirstText + s_SlotSize - 1) / s_SlotSize;
+}
+
+//------------------------------------------------------------------------------
+///@brief   One thread's records:  a single producer, single consumer ring.     
+///@note    The head (written by the logging thread) and the tail (written by   
+///         the writer) are kept on cache lines of their own.                   
+//------------------------------------------------------------------------------
+class AsyncSink::Ring
+{
+    public:
+        explicit Ring(size_t capacity)
+            : m_Slots(capacity)
+            , m_Mask(capacity - 1)
+            , m_Head(0)
+            , m_CachedTail(0)
+            , m_Dropped(0)
+            , m_Tail(0)
+        {
+        }
+
+        std::vector<Slot>       m_Slots;
+        const uint64_t          m_Mask;
+
+        alignas(64)
+        std::atomic<uint64_t>   m_Head;
+        uint64_t                m_CachedTail;
+        std::atomic<uint64_t>   m_Dropped;
+
+        alignas(64)
+        std::atomic<uint64_t>   m_Tail;
+
+}; // class AsyncSink::Ring //
+
+//------------------------------------------------------------------------------
+//  Each sink's serial number, so that a thread's cached ring is never taken    
+//  for the ring of a sink that happens to reuse a destroyed one's address.     
+//------------------------------------------------------------------------------
+static std::atomic<uint64_t> s_NextSerial(1);
+
+static LIB_LOG_WORK_THREAD_LOCAL uint64_t s_Serial(0);
+static LIB_LOG_WORK_THREAD_LOCAL AsyncSink::Ring* s_Ring(nullptr);
+
+//------------------------------------------------------------------------------
+///@brief   Construct a sink writing to out with capacity slots per thread      
+///         (rounded up to a power of two).                                     
+///@note    Nothing is written until start (or flush).                          
+//------------------------------------------------------------------------------
+AsyncSink::AsyncSink(
+    std::ostream&       out
+  , size_t              capacity
+  , const std::string&  mnemonic
+)
+    : m_Out(out)
+    , m_Capacity([capacity]() {
+        size_t result(s_MinimumCapacity);
+        while (result < capacity) result <<= 1;
+        return result;
+      }())
+    , m_Serial(s_NextSerial.fetch_add(1))
+    , m_PID(int32_t(getpid()))
+    , m_Mnemonic(mnemonic)
+    , m_Formatter("%F %H:%M:%S.%%6f")
+    , m_Reported(0)
+    , m_Running(false)
+    , m_Written(0)
+{
+    m_Text.reserve(MAXIMUM_TEXT);
+    m_Line.reserve(MAXIMUM_TEXT + 128);
+
+} // AsyncSink::AsyncSink //
+
+//------------------------------------------------------------------------------
+///@brief   Stop the writer (writing everything still queued).                  
+//------------------------------------------------------------------------------
+AsyncSink::~AsyncSink()
+{
+    stop();
+
+} // AsyncSink::~AsyncSink //
+
+//------------------------------------------------------------------------------
+///@brief   Start the writer:  it drains the rings, sleeping idle_nano_seconds  
+///         whenever they are empty.                                            
+//------------------------------------------------------------------------------
+void AsyncSink::start(int64_t idle_nano_seconds)
+{
+    if (m_Running.exchange(true)) return;
+
+    m_Thread = boost::thread([this, idle_nano_seconds]() {
+        run(idle_nano_seconds);
+    });
+
+} // void AsyncSink::start(int64_t idle_nano_seconds) //
+
+//------------------------------------------------------------------------------
+///@brief   Stop the writer and write whatever is left.                         
+//------------------------------------------------------------------------------
+void AsyncSink::stop()
+{
+    if (m_Running.exchange(false)) {
+        m_Thread.join();
+    }
+    flush();
+
+} // void AsyncSink::stop() //
+
+//------------------------------------------------------------------------------
+///@brief   Write what is queued now, on the calling thread.                    
+///@return  The number of records written.                                      
+//------------------------------------------------------------------------------
+size_t AsyncSink::flush()
+{
+    return drain();
+
+} // size_t AsyncSink::flush() //
+
+//------------------------------------------------------------------------------
+///@brief   The writer's loop.                                                  
+//------------------------------------------------------------------------------
+void AsyncSink::run(int64_t idle_nano_seconds)
+{
+    timespec idle;
+    lib::time::ds::NanoSeconds(idle_nano_seconds).toTimespec(idle);
+
+    while (m_Running.load(std::memory_order_relaxed)) {
+        if (drain() == 0) nanosleep(&idle, nullptr);
+    }
+
+} // void AsyncSink::run(int64_t idle_nano_seconds) //
+
+//------------------------------------------------------------------------------
+///@brief   Queue a record time stamped now.                                    
+///@return  false if the calling thread's ring was full (the record is          
+///         dropped and counted).                                               
+//------------------------------------------------------------------------------
+bool AsyncSink::log(
+    ds::class_t         classid
+  , ds::level_t         severity
+  , ds::messageid_t     message_id
+  , const char*         text
+  , size_t              size
+)
+{
+    return push(
+        classid
+      , severity
+      , message_id
+      , 0
+      , lib::time::work::Clock::now().count()
+      , text
+      , size
+    );
+
+} // bool AsyncSink::log(...) //
+
+//------------------------------------------------------------------------------
+///@brief   Queue a copy of message (its time stamp and mnemonic included).     
+///@return  false if the calling thread's ring was full.                        
+//------------------------------------------------------------------------------
+bool AsyncSink::log(const Message& message)
+{
+    const std::string text(message.message());
+    return push(
+        message.classID()
+      , message.severityLevel()
+      , message.messageID()
+      , mnemonic(message.applicationMnemonic())
+      , message.timeStamp().nanoSeconds().count()
+      , text.data()
+      , text.size()
+    );
+
+} // bool AsyncSink::log(const Message& message) //
+
+//------------------------------------------------------------------------------
+///@brief   Return the total number of records dropped because a ring was full. 
+//------------------------------------------------------------------------------
+uint64_t AsyncSink::dropped() const
+{
+    boost::mutex::scoped_lock lock(m_Mutex);
+
+    uint64_t result(0);
+    for (const auto& ring : m_Rings) {
+        result += ring->m_Dropped.load(std::memory_order_relaxed);
+    }
+    return result;
+
+} // uint64_t AsyncSink::dropped() const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the calling thread's ring, making it on the thread's first   
+///         record.                                                             
+//------------------------------------------------------------------------------
+AsyncSink::Ring* AsyncSink::ring()
+{
+    if (s_Serial == m_Serial) return s_Ring;
+
+    boost::mutex::scoped_lock lock(m_Mutex);
+
+    Ring*& ring(m_RingOf[boost::this_thread::get_id()]);
+    if (ring == nullptr) {
+        m_Rings.emplace_back(new Ring(m_Capacity));
+        ring = m_Rings.back().get();
+    }
+
+    s_Serial = m_Serial;
+    s_Ring = ring;
+    return ring;
+
+} // AsyncSink::Ring* AsyncSink::ring() //
+
+//------------------------------------------------------------------------------
+///@brief   Return the index of the mnemonic:  0 for the sink's own (and if     
+///         there are already 255 others).                                      
+//------------------------------------------------------------------------------
+uint8_t AsyncSink::mnemonic(const std::string& mnemonic)
+{
+    if (mnemonic.empty() || mnemonic == m_Mnemonic) return 0;
+
+    boost::mutex::scoped_lock lock(m_Mutex);
+
+    auto found(std::find(m_Mnemonics.begin(), m_Mnemonics.end(), mnemonic));
+    if (found != m_Mnemonics.end()) {
+        return uint8_t(found - m_Mnemonics.begin() + 1);
+    }
+    if (m_Mnemonics.size() >= UINT8_MAX) return 0;
+
+    m_Mnemonics.push_back(mnemonic);
+    return uint8_t(m_Mnemonics.size());
+
+} // uint8_t AsyncSink::mnemonic(const std::string& mnemonic) //
+
+//------------------------------------------------------------------------------
+///@brief   Copy the record into the calling thread's ring.                     
+//------------------------------------------------------------------------------
+bool AsyncSink::push(
+    ds::class_t         classid
+  , ds::level_t         severity
+  , ds::messageid_t     message_id
+  , uint8_t             mnemonic
+  , int64_t             time_stamp
+  , const char*         text
+  , size_t              size
+)
+{
+    Ring& ring(*AsyncSink::ring());
+
+    size = std::min(size, MAXIMUM_TEXT);
+    const size_t slots(slotsFor(size));
+
+    const uint64_t head(ring.m_Head.load(std::memory_order_relaxed));
+    if (head + slots - ring.m_CachedTail > m_Capacity) {
+        ring.m_CachedTail = ring.m_Tail.load(std::memory_order_acquire);
+        if (head + slots - ring.m_CachedTail > m_Capacity) {
+            ring.m_Dropped.store(
+                ring.m_Dropped.load(std::memory_order_relaxed) + 1
+              , std::memory_order_relaxed
+            );
+            return false;
+        }
+    }
+
+    Header header;
+    header.m_TimeStamp = time_stamp;
+    header.m_MessageID = message_id;
+    header.m_ClassID = classid;
+    header.m_Size = uint16_t(size);
+    header.m_Severity = uint8_t(severity);
+    header.m_Mnemonic = mnemonic;
+    header.m_Slots = uint8_t(slots);
+
+    char* first(ring.m_Slots[head & ring.m_Mask].m_Bytes);
+    memcpy(first, &header, sizeof(header));
+
+    size_t part(std::min(size, s_FirstText));
+    memcpy(first + sizeof(header), text, part);
+    for (size_t i = 1; i < slots; ++i) {
+        text += part;
+        size -= part;
+        part = std::min(size, s_SlotSize);
+        memcpy(ring.m_Slots[(head + i) & ring.m_Mask].m_Bytes, text, part);
+    }
+
+    ring.m_Head.store(head + slots, std::memory_order_release);
+    return true;
+
+} // bool AsyncSink::push(...) //
+
+//------------------------------------------------------------------------------
+///@brief   Format and write every record queued, then (if more were dropped    
+///         since last time) a note of how many.                                
+///@return  The number of records written.                                      
+//------------------------------------------------------------------------------
+size_t AsyncSink::drain()
+{
+    boost::mutex::scoped_lock drain_lock(m_DrainMutex);
+
+    std::vector<Ring*> rings;
+    {
+        boost::mutex::scoped_lock lock(m_Mutex);
+        rings.reserve(m_Rings.size());
+        for (const auto& ring : m_Rings) rings.push_back(ring.get());
+    }
+
+    size_t result(0);
+    uint64_t dropped(0);
+    for (Ring* ring : rings) {
+        uint64_t tail(ring->m_Tail.load(std::memory_order_relaxed));
+        const uint64_t head(ring->m_Head.load(std::memory_order_acquire));
+
+        while (tail != head) {
+            const char* first(ring->m_Slots[tail & ring->m_Mask].m_Bytes);
+            Header header;
+            memcpy(&header, first, sizeof(header));
+
+            size_t size(header.m_Size);
+            size_t part(std::min(size, s_FirstText));
+            m_Text.assign(first + sizeof(header), part);
+            for (size_t i = 1; i < header.m_Slots; ++i) {
+                size -= part;
+                part = std::min(size, s_SlotSize);
+                m_Text.append(
+                    ring->m_Slots[(tail + i) & ring->m_Mask].m_Bytes, part
+                );
+            }
+
+            write(
+                header.m_ClassID
+              , ds::level_t(header.m_Severity)
+              , header.m_MessageID
+              , header.m_Mnemonic
+              , header.m_TimeStamp
+              , m_Text.data()
+              , m_Text.size()
+            );
+
+            tail += header.m_Slots;
+            ++result;
+        }
+
+        ring->m_Tail.store(tail, std::memory_order_release);
+        dropped += ring->m_Dropped.load(std::memory_order_relaxed);
+    }
+
+    if (dropped != m_Reported) {
+        const std::string text(
+            lib::format("%" PRIu64 " log records lost", dropped - m_Reported)
+        );
+        write(
+            ds::LIB_LOG_ASYNC_SINK
+          , ds::WARNING
+          , MSG_RECORDS_LOST
+          , 0
+          , lib::time::work::Clock::now().count()
+          , text.data()
+          , text.size()
+        );
+        m_Reported = dropped;
+    }
+
+    if (result > 0) {
+        m_Written.fetch_add(result);
+        m_Out.flush();
+    }
+
+    return result;
+
+} // size_t AsyncSink::drain() //
+
+//------------------------------------------------------------------------------
+///@brief   Write one record as a line, laid out as Message::toString(ALL).     
+//------------------------------------------------------------------------------
+void AsyncSink::write(
+    ds::class_t         classid
+  , ds::level_t         severity
+  , ds::messageid_t     message_id
+  , uint8_t             mnemonic
+  , int64_t             time_stamp
+  , const char*         text
+  , size_t              size
+)
+{
+    static const size_t s_MnemonicWidth(20);
+
+    const lib::time::ds::NanoSeconds when(time_stamp);
+    char buffer[128];
+    size_t length(
+        m_Formatter.format(
+            when.seconds(), int32_t(when.subSeconds()), buffer, sizeof(buffer)
+        )
+    );
+    m_Line.assign(buffer, length);
+
+    snprintf(buffer, sizeof(buffer), " %04" PRIx32 " ", m_PID);
+    m_Line += buffer;
+
+    std::string name(m_Mnemonic);
+    if (mnemonic != 0) {
+        boost::mutex::scoped_lock lock(m_Mutex);
+        name = m_Mnemonics[mnemonic - 1];
+    }
+    name.resize(s_MnemonicWidth, ' ');
+    m_Line += name;
+
+    snprintf(
+        buffer
+      , sizeof(buffer)
+      , " %02x-%02x-%02x-%c"
+      , (classid >> 8) & 0xFF
+      , (classid >> 0) & 0xFF
+      , message_id & 0xFF
+      , lib::log::work::toString(severity)[0]
+    );
+    m_Line += buffer;
+
+    m_Line += ' ';                  // even for no text, as Message does
+    m_Line.append(text, size);
+    m_Line += '\n';
+
+    m_Out.write(m_Line.data(), m_Line.size());
+
+} // void AsyncSink::write(...) //
+
+} // namespace work
+} // namespace log
+} // namespace lib
@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_asyncsink.h                                               
+///@brief Holds lib::log::work::AsyncSink, log records queued per thread and    
+///       written by a thread of their own.                                     
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_LOG_WORK_ASYNCSINK_H_FILE_GUARD
+#define LIB_LOG_WORK_ASYNCSINK_H_FILE_GUARD
+
+#include "lib_log_ds.h"
+#include "lib_log_work_message.h"
+#include "lib_time_work_datetimeformatter.h"
+
+#include <atomic>
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace lib {
+namespace log {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   A log that never makes the thread logging wait:  each thread puts   
+///         compact binary records in a ring of its own and a background        
+///         thread formats and writes them.                                     
+///                                                                             
+///@par Purpose:                                                                
+///         A Message is several std::strings, a DateTime::now() and a          
+///         getpid() wrapped in a shared_ptr, and publishing it goes through    
+///         a Subscriber's queue, which blocks when full.  A thread in the      
+///         middle of a pipeline should not stall (or allocate) to say          
+///         something.  log() takes the class id, message id, severity, the     
+///         text and a time stamp (lib::time::work::Clock) and copies them      
+///         into the calling thread's ring:  no lock, no allocation.            
+///                                                                             
+///@par Records                                                                 
+///         A record is one 128 byte slot:  time stamp (ns), class id,          
+///         message id, severity, mnemonic and text length, and the first       
+///         bytes of the text.  Longer texts run on into following slots (up    
+///         to MAXIMUM_TEXT bytes; the rest is cut).                            
+///                                                                             
+///@par Overload                                                                
+///         If a thread's ring is full the record is dropped and counted        
+///         (log() returns false); the writer notes how many were lost in       
+///         the output as a WARNING from LIB_LOG_ASYNC_SINK.                    
+///                                                                             
+///@par Output                                                                  
+///         Each record is written as Message::toString() would write the       
+///         same message (time stamp to the microsecond, process id,            
+///         mnemonic, message id, text), one per line.                          
+///                                                                             
+///@par Thread Safety:  class                                                   
+///         log() from any thread; start, stop and flush from one.              
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         std::ofstream file("run.log");                                      
+///         lib::log::work::AsyncSink sink(file);                               
+///         sink.start();                                                       
+///         ...                                                                 
+///         sink.log(                                                           
+///             lib::log::ds::MAIN, lib::log::ds::VERBOSE, MSG_FRAME, "frame"   
+///         );                                                                  
+///         ...                                                                 
+///         sink.stop();                                                        
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class AsyncSink
+{
+    public:
+        static const size_t DEFAULT_CAPACITY = 4096;    ///< slots per thread
+        static const size_t MAXIMUM_TEXT = 4096;        ///< bytes per record
+
+        static const ds::messageid_t MSG_RECORDS_LOST = 0x00;
+
+        explicit AsyncSink(
+            std::ostream&       out
+          , size_t              capacity = DEFAULT_CAPACITY
+          , const std::string&  mnemonic = Message::defaultApplicationMnemonic()
+        );
+        virtual ~AsyncSink();
+
+        void start(int64_t idle_nano_seconds = 1000000);
+        void stop();
+        size_t flush();
+
+        bool log(
+            ds::class_t         classid
+          , ds::level_t         severity
+          , ds::messageid_t     message_id
+          , const char*         text
+          , size_t              size
+        );
+        bool log(
+            ds::class_t         classid
+          , ds::level_t         severity
+          , ds::messageid_t     message_id
+          , const std::string&  text
+        )
+        {
+            return log(classid, severity, message_id, text.data(), text.size());
+        }
+        bool log(const Message& message);
+
+        void operator()(ConstMessagePtr message) { log(*message); }
+
+        uint64_t written() const { return m_Written.load(); }
+        uint64_t dropped() const;
+
+        class Ring;
+
+    private:
+        AsyncSink(const AsyncSink& that);
+        AsyncSink& operator=(const AsyncSink& that);
+
+        Ring* ring();
+        uint8_t mnemonic(const std::string& mnemonic);
+        bool push(
+            ds::class_t         classid
+          , ds::level_t         severity
+          , ds::messageid_t     message_id
+          , uint8_t             mnemonic
+          , int64_t             time_stamp
+          , const char*         text
+          , size_t              size
+        );
+        void run(int64_t idle_nano_seconds);
+        size_t drain();
+        void write(
+            ds::class_t         classid
+          , ds::level_t         severity
+          , ds::messageid_t     message_id
+          , uint8_t             mnemonic
+          , int64_t             time_stamp
+          , const char*         text
+          , size_t              size
+        );
+
+        std::ostream&                       m_Out;
+        const size_t                        m_Capacity;
+        const uint64_t                      m_Serial;
+        const int32_t                       m_PID;
+        const std::string                   m_Mnemonic;
+
+        mutable boost::mutex                m_Mutex;
+        std::vector<std::unique_ptr<Ring> > m_Rings;
+        std::map<boost::thread::id, Ring*>  m_RingOf;
+        std::vector<std::string>            m_Mnemonics;        ///< from 1
+
+        boost::mutex                        m_DrainMutex;
+        lib::time::work::DateTimeFormatter  m_Formatter;
+        std::string                         m_Text;
+        std::string                         m_Line;
+        uint64_t                            m_Reported;
+
+        std::atomic<bool>                   m_Running;
+        std::atomic<uint64_t>               m_Written;
+        boost::thread                       m_Thread;
+
+}; // class AsyncSink //
+
+} // namespace work
+} // namespace log
+} // namespace lib
+
+#endif // #ifndef LIB_LOG_WORK_ASYNCSINK_H_FILE_GUARD
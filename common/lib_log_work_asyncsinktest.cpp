@@ -0,0 +1,220 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_asyncsinktest.cpp                                         
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_log_work_asyncsinktest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_log_work_asyncsink.h"
+#include "lib_log_work_message.h"
+
+#include <boost/thread.hpp>
+#include <sstream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::log::work::test::AsyncSinkTest);
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+AsyncSinkTest::AsyncSinkTest()
+    : Test("lib::log::work::AsyncSink")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    AsyncSinkTest object to copy.                               
+//------------------------------------------------------------------------------
+AsyncSinkTest::AsyncSinkTest(const AsyncSinkTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+AsyncSinkTest::~AsyncSinkTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+AsyncSinkTest& AsyncSinkTest::operator=(
+    const AsyncSinkTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // AsyncSinkTest::operator=(const AsyncSinkTest& that) //
+
+
+//------------------------------------------------------------------------------
+//  The lines written.                                                          
+//------------------------------------------------------------------------------
+static std::vector<std::string> lines(const std::ostringstream& out)
+{
+    std::vector<std::string> result;
+    std::istringstream in(out.str());
+    std::string line;
+    while (std::getline(in, line)) result.push_back(line);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// @brief Test the records written (against Message::toString), long texts,    
+///        several threads at once and a full ring.                             
+//------------------------------------------------------------------------------
+void AsyncSinkTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  The same line as Message::toString, for the sink's mnemonic or not.     
+    //--------------------------------------------------------------------------
+    {
+        std::ostringstream out;
+        AsyncSink sink(out, 64, "sink-mnemonic");
+
+        const lib::time::work::DateTime now(lib::time::work::DateTime::now());
+        Message plain(ds::MAIN, ds::WARNING, 5, "hello", now, "sink-mnemonic");
+        Message other(ds::LIB_MP_THREADINFO, ds::VERBOSE, 23, "", now, "other");
+        TEST(sink.log(plain));
+        TEST(sink.log(other));
+        TEST(sink.log(ds::MAIN, ds::INFORMATIONAL, 6, "now"));
+        const size_t flushed(sink.flush());
+        TEST_IS_EQUAL(flushed, 3);
+
+        std::vector<std::string> written(lines(out));
+        TEST_IS_EQUAL(written.size(), 3);
+        if (written.size() == 3) {
+            TEST_IS_EQUAL(written[0], plain.toString());
+            TEST_IS_EQUAL(written[1], other.toString());
+            TEST(
+                written[2].find("sink-mnemonic        00-01-06-I now")
+             != std::string::npos
+            );
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //  Texts across several slots, and cut at MAXIMUM_TEXT.                    
+    //--------------------------------------------------------------------------
+    {
+        std::ostringstream out;
+        AsyncSink sink(out, 64);
+
+        std::string text;
+        for (int i = 0; text.size() < 5000; ++i) text += char('a' + i % 26);
+
+        TEST(sink.log(ds::MAIN, ds::DEBUG_LEVEL_1, 1, text.substr(0, 1000)));
+        TEST(sink.log(ds::MAIN, ds::DEBUG_LEVEL_1, 2, text));
+        sink.flush();
+
+        std::vector<std::string> written(lines(out));
+        TEST_IS_EQUAL(written.size(), 2);
+        if (written.size() == 2) {
+            const size_t most(AsyncSink::MAXIMUM_TEXT);
+            TEST_IS_EQUAL(
+                written[0].substr(written[0].size() - 1001)
+              , " " + text.substr(0, 1000)
+            );
+            TEST_IS_EQUAL(
+                written[1].substr(written[1].size() - most - 1)
+              , " " + text.substr(0, most)
+            );
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //  Several threads while the writer runs:  nothing lost or garbled.        
+    //--------------------------------------------------------------------------
+    {
+        std::ostringstream out;
+        AsyncSink sink(out, 1 << 16);
+        sink.start();
+
+        const int threads(4);
+        const int count(20000);
+        std::vector<boost::thread> producers;
+        for (int t = 0; t < threads; ++t) {
+            producers.emplace_back([&sink, t, count]() {
+                const std::string text("thread " + std::to_string(t));
+                for (int i = 0; i < count; ++i) {
+                    sink.log(ds::MAIN, ds::VERBOSE, ds::messageid_t(t), text);
+                }
+            });
+        }
+        for (auto& producer : producers) producer.join();
+        sink.stop();
+
+        TEST_IS_EQUAL(sink.dropped(), 0);
+        TEST_IS_EQUAL(sink.written(), uint64_t(threads * count));
+
+        std::vector<int> per_thread(threads, 0);
+        int garbled(0);
+        for (const auto& line : lines(out)) {
+            const size_t at(line.rfind("thread "));
+            const int t(
+                at == std::string::npos ? -1 : atoi(line.c_str() + at + 7)
+            );
+            if (t < 0 || t >= threads) {
+                ++garbled;
+            } else {
+                ++per_thread[t];
+            }
+        }
+        TEST_IS_EQUAL(garbled, 0);
+        for (int t = 0; t < threads; ++t) TEST_IS_EQUAL(per_thread[t], count);
+    }
+
+    //--------------------------------------------------------------------------
+    //  A full ring drops (and counts) rather than waits.                       
+    //--------------------------------------------------------------------------
+    {
+        std::ostringstream out;
+        AsyncSink sink(out, 64);
+
+        int accepted(0);
+        for (int i = 0; i < 100; ++i) {
+            if (sink.log(ds::MAIN, ds::VERBOSE, 1, "x")) ++accepted;
+        }
+        TEST_IS_EQUAL(accepted, 64);
+        TEST_IS_EQUAL(sink.dropped(), 36);
+
+        const size_t flushed(sink.flush());
+        TEST_IS_EQUAL(flushed, 64);
+        std::vector<std::string> written(lines(out));
+        TEST_IS_EQUAL(written.size(), 65);
+        if (written.size() == 65) {
+            TEST(
+                written[64].find("00-04-00-W 36 log records lost")
+             != std::string::npos
+            );
+        }
+
+        TEST(sink.log(ds::MAIN, ds::VERBOSE, 1, "y"));
+    }
+
+} // void AsyncSinkTest::runTest() //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
+
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_asyncsinktest.h                                           
+//------------------------------------------------------------------------------
+#ifndef LIB_LOG_WORK_ASYNCSINKTEST_H
+#define LIB_LOG_WORK_ASYNCSINKTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: AsyncSinkTest                                                    
+///                                                                             
+///@par Purpose:                                                                
+///         The AsyncSinkTest class provides the regression test for            
+///         the lib::log::work::AsyncSink class.                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class AsyncSinkTest : public dev::test::work::Test {
+    public:
+        AsyncSinkTest();
+        AsyncSinkTest(const AsyncSinkTest& that);
+        virtual ~AsyncSinkTest();
+        AsyncSinkTest& operator=(const AsyncSinkTest& that);
+
+    protected:
+        void runTest();
+
+    private:
+
+}; //  class AsyncSinkTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_LOG_WORK_ASYNCSINKTEST_H //
@@ -0,0 +1,372 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_binarylogreader.cpp                                       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   Log messages read back from a binary log file by time window and    
+///         severity.                                                           
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_log_work_binarylogreader.h"
+#include "lib_string.h"
+#include "lib_time_ds_nanoseconds.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string.h>
+
+namespace lib {
+namespace log {
+namespace work {
+
+using lib::log::ds::BinaryLog;
+using lib::log::ds::BinaryLogBlock;
+
+//------------------------------------------------------------------------------
+///@brief   Open the file and read its block index.                             
+//------------------------------------------------------------------------------
+BinaryLogReader::BinaryLogReader(const std::string& path)
+    : m_File(path)
+    , m_Open(false)
+    , m_WasClosed(false)
+{
+    if (!m_File.isOpen()) {
+        m_Error = m_File.error();
+        return;
+    }
+
+    try {
+        m_Open = readIndex();
+    } catch (const std::exception& e) {
+        m_Error = e.what();
+    }
+
+} // BinaryLogReader::BinaryLogReader() //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+BinaryLogReader::~BinaryLogReader()
+{
+
+} // BinaryLogReader::~BinaryLogReader() //
+
+//------------------------------------------------------------------------------
+///@brief   The number of messages in the file.                                 
+//------------------------------------------------------------------------------
+uint64_t BinaryLogReader::records() const
+{
+    uint64_t result(0);
+    for (size_t b = 0; b < m_Blocks.size(); ++b) result += m_Blocks[b].records;
+    return result;
+
+} // uint64_t BinaryLogReader::records() const //
+
+//------------------------------------------------------------------------------
+///@brief   Append every message in the file to messages.                       
+///@return  The number of messages appended.                                    
+//------------------------------------------------------------------------------
+size_t BinaryLogReader::read(Messages& messages)
+{
+    return read(messages, ds::LEVEL_MAX);
+
+} // size_t BinaryLogReader::read(Messages& messages) //
+
+//------------------------------------------------------------------------------
+///@brief   Append the messages as bad as or worse than level.                  
+///@return  The number of messages appended.                                    
+//------------------------------------------------------------------------------
+size_t BinaryLogReader::read(Messages& messages, ds::level_t level)
+{
+    return read(
+        messages
+      , std::numeric_limits<int64_t>::min()
+      , std::numeric_limits<int64_t>::max()
+      , level
+    );
+
+} // size_t BinaryLogReader::read(Messages& messages, ds::level_t level) //
+
+//------------------------------------------------------------------------------
+///@brief   Append the messages time stamped from through to (inclusive) and    
+///         as bad as or worse than level.                                      
+///@return  The number of messages appended.                                    
+//------------------------------------------------------------------------------
+size_t BinaryLogReader::read(
+    Messages&                           messages
+  , const lib::time::work::DateTime&    from
+  , const lib::time::work::DateTime&    to
+  , ds::level_t                         level
+)
+{
+    return read(
+        messages
+      , from.nanoSeconds().count()
+      , to.nanoSeconds().count()
+      , level
+    );
+
+} // size_t BinaryLogReader::read(...) //
+
+//------------------------------------------------------------------------------
+///@brief   Append all the messages of one block (see blocks()).                
+///@return  The number of messages appended.                                    
+//------------------------------------------------------------------------------
+size_t BinaryLogReader::readBlock(size_t block, Messages& messages)
+{
+    size_t kept(0);
+
+    if (block < m_Blocks.size()) {
+        try {
+            decode(
+                m_Blocks[block]
+              , messages
+              , std::numeric_limits<int64_t>::min()
+              , std::numeric_limits<int64_t>::max()
+              , ds::LEVEL_MAX
+              , kept
+            );
+        } catch (const std::exception& e) {
+            m_Error = e.what();
+        }
+    }
+
+    return kept;
+
+} // size_t BinaryLogReader::readBlock(size_t block, Messages& messages) //
+
+//------------------------------------------------------------------------------
+///@brief   Decode the blocks that can hold messages wanted.                    
+//------------------------------------------------------------------------------
+size_t BinaryLogReader::read(
+    Messages&                           messages
+  , int64_t                             from
+  , int64_t                             to
+  , ds::level_t                         level
+)
+{
+    size_t kept(0);
+
+    try {
+        for (size_t b = 0; b < m_Blocks.size(); ++b) {
+            const BinaryLogBlock& block(m_Blocks[b]);
+
+            if (block.last < from || block.first > to) continue;
+            if (block.worst > level) continue;
+
+            if (!decode(block, messages, from, to, level, kept)) break;
+        }
+    } catch (const std::exception& e) {
+        m_Error = e.what();
+    }
+
+    return kept;
+
+} // size_t BinaryLogReader::read(...) //
+
+//------------------------------------------------------------------------------
+///@brief   Append the block's messages within the window and level.            
+///@return  false (and error() set) if the block does not decode.               
+//------------------------------------------------------------------------------
+bool BinaryLogReader::decode(
+    const BinaryLogBlock&               block
+  , Messages&                           messages
+  , int64_t                             from
+  , int64_t                             to
+  , ds::level_t                         level
+  , size_t&                             kept
+)
+{
+    const std::string corrupt(
+        m_File.path() + ": block at offset "
+      + lib::toString(block.offset) + " is corrupt"
+    );
+
+    lib::io::work::MappedChunkPtr chunk(
+        m_File.map(block.offset, BinaryLog::BLOCK_HEADER_SIZE + block.size)
+    );
+    if (chunk->size() != BinaryLog::BLOCK_HEADER_SIZE + block.size) {
+        m_Error = corrupt;
+        return false;
+    }
+
+    const uint8_t* p(chunk->data() + BinaryLog::BLOCK_HEADER_SIZE);
+    const uint8_t* const end(p + block.size);
+
+    //--------------------------------------------------------------------------
+    //  The string table.                                                       
+    //--------------------------------------------------------------------------
+    uint64_t count;
+    if (!BinaryLog::getVarint(p, end, count) || count > block.size) {
+        m_Error = corrupt;
+        return false;
+    }
+
+    m_Strings.clear();
+    m_Strings.reserve(size_t(count));
+    for (uint64_t s = 0; s < count; ++s) {
+        uint64_t length;
+        if (!BinaryLog::getVarint(p, end, length) || length > uint64_t(end-p)) {
+            m_Error = corrupt;
+            return false;
+        }
+        m_Strings.push_back(
+            std::make_pair(reinterpret_cast<const char*>(p), size_t(length))
+        );
+        p += length;
+    }
+
+    //--------------------------------------------------------------------------
+    //  The records.  Each Message is copied from the prototype (rather than    
+    //  constructed) to skip the constructor's getpid().                        
+    //--------------------------------------------------------------------------
+    const Message prototype;
+    int64_t time(0);
+    int64_t pid(0);
+
+    for (uint32_t r = 0; r < block.records; ++r) {
+        uint64_t delta, classid, message_id, pid_delta, mnemonic, text;
+
+        bool ok(
+            BinaryLog::getVarint(p, end, delta)
+         && BinaryLog::getVarint(p, end, classid)
+         && BinaryLog::getVarint(p, end, message_id)
+         && p < end
+        );
+        const ds::level_t severity(ok ? ds::level_t(*p++) : ds::UNDEFINED);
+        ok = ok
+         && BinaryLog::getVarint(p, end, pid_delta)
+         && BinaryLog::getVarint(p, end, mnemonic)
+         && BinaryLog::getVarint(p, end, text)
+         && mnemonic < m_Strings.size()
+         && text < m_Strings.size();
+
+        if (!ok) {
+            m_Error = corrupt;
+            return false;
+        }
+
+        time += BinaryLog::unzigzag(delta);
+        pid += BinaryLog::unzigzag(pid_delta);
+
+        const int64_t nano_seconds(time * 1000);
+        if (nano_seconds < from || nano_seconds > to || severity > level) {
+            continue;
+        }
+
+        MessagePtr message(new Message(prototype));
+        message->setTimeStamp(
+            lib::time::work::DateTime(
+                lib::time::ds::NanoSeconds(nano_seconds)
+            )
+        );
+        message->setClassID(ds::class_t(classid));
+        message->setSeverityLevel(severity);
+        message->setMessageID(ds::messageid_t(message_id));
+        message->setPID(int(pid));
+        message->setApplicationMnemonic(
+            std::string(m_Strings[mnemonic].first, m_Strings[mnemonic].second)
+        );
+        message->setMessage(
+            std::string(m_Strings[text].first, m_Strings[text].second)
+        );
+
+        messages.push_back(message);
+        ++kept;
+    }
+
+    return true;
+
+} // bool BinaryLogReader::decode(...) //
+
+//------------------------------------------------------------------------------
+///@brief   Check the magic number and read the index from the tail (or walk    
+///         the blocks if there is none).                                       
+///@return  false (and error() set) if this is not a binary log.                
+//------------------------------------------------------------------------------
+bool BinaryLogReader::readIndex()
+{
+    const uint64_t size(m_File.size());
+    const size_t magic(strlen(BinaryLog::fileMagic()));
+
+    lib::io::work::MappedChunkPtr head(m_File.map(0, magic));
+    if (head->size() != magic
+     || memcmp(head->data(), BinaryLog::fileMagic(), magic) != 0
+    ) {
+        m_Error = m_File.path() + ": not a binary log";
+        return false;
+    }
+
+    //--------------------------------------------------------------------------
+    //  The tail:  the index's offset and the end magic number.                 
+    //--------------------------------------------------------------------------
+    if (size >= magic + BinaryLog::TAIL_SIZE) {
+        const uint64_t at(size - BinaryLog::TAIL_SIZE);
+        lib::io::work::MappedChunkPtr tail(
+            m_File.map(at, BinaryLog::TAIL_SIZE)
+        );
+        const uint64_t index(BinaryLog::get64(tail->data()));
+
+        if (memcmp(tail->data() + 8, BinaryLog::endMagic(), 8) == 0
+         && index >= magic
+         && index + 12 <= at
+        ) {
+            lib::io::work::MappedChunkPtr entries(
+                m_File.map(index, size_t(at - index))
+            );
+            const uint8_t* p(entries->data());
+            const uint32_t count(BinaryLog::get32(p + 8));
+
+            if (memcmp(p, BinaryLog::indexMagic(), 8) == 0
+             && 12 + uint64_t(count) * BinaryLog::INDEX_ENTRY_SIZE
+                    == entries->size()
+            ) {
+                m_Blocks.resize(count);
+                for (uint32_t b = 0; b < count; ++b) {
+                    BinaryLog::getIndexEntry(
+                        p + 12 + b * BinaryLog::INDEX_ENTRY_SIZE, m_Blocks[b]
+                    );
+                }
+                m_WasClosed = true;
+                return true;
+            }
+        }
+    }
+
+    walkBlocks();
+    return true;
+
+} // bool BinaryLogReader::readIndex() //
+
+//------------------------------------------------------------------------------
+///@brief   Build the index from the block headers (for a file whose writer     
+///         never closed it); a block cut short by the end of the file is       
+///         left out.                                                           
+//------------------------------------------------------------------------------
+void BinaryLogReader::walkBlocks()
+{
+    const uint64_t size(m_File.size());
+    uint64_t offset(strlen(BinaryLog::fileMagic()));
+
+    while (offset + BinaryLog::BLOCK_HEADER_SIZE <= size) {
+        lib::io::work::MappedChunkPtr header(
+            m_File.map(offset, BinaryLog::BLOCK_HEADER_SIZE)
+        );
+
+        BinaryLogBlock block;
+        if (!BinaryLog::getBlockHeader(header->data(), block)) break;
+        if (block.size > size - offset - BinaryLog::BLOCK_HEADER_SIZE) break;
+
+        block.offset = offset;
+        m_Blocks.push_back(block);
+
+        offset += BinaryLog::BLOCK_HEADER_SIZE + block.size;
+    }
+
+} // void BinaryLogReader::walkBlocks() //
+
+} // namespace work
+} // namespace log
+} // namespace lib
@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_binarylogreader.h                                         
+///@brief Holds lib::log::work::BinaryLogReader, log messages read back from    
+///       a BinaryLogWriter file by time window and severity.                   
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_LOG_WORK_BINARYLOGREADER_H_FILE_GUARD
+#define LIB_LOG_WORK_BINARYLOGREADER_H_FILE_GUARD
+
+#include "lib_io_work_mappedfile.h"
+#include "lib_log_ds_binarylog.h"
+#include "lib_log_work_message.h"
+#include "lib_time_work_datetime.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace lib {
+namespace log {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Read Messages back from a binary log file (BinaryLogWriter).        
+///                                                                             
+///@par Index                                                                   
+///         Opening the file reads its block index (from the file's tail, or    
+///         for a file that was never closed by walking the block headers).     
+///         read() then decodes only the blocks whose time span overlaps the    
+///         window asked for and whose worst severity is bad enough; the        
+///         rest of the file is never touched.                                  
+///                                                                             
+///@par Mapping                                                                 
+///         Blocks are read where they lie (lib::io::work::MappedFile); only    
+///         the messages kept are copied out.                                   
+///                                                                             
+///@par Errors                                                                  
+///         isOpen() is false (and error() says why) if the file cannot be      
+///         opened or is not a binary log.  A block that does not decode        
+///         stops read() there and error() names it.                            
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::log::work::BinaryLogReader log("run.dlog");                    
+///         if (!log.isOpen()) throw std::runtime_error(log.error());           
+///                                                                             
+///         lib::log::work::Messages problems;                                  
+///         log.read(problems, from, to, lib::log::ds::WARNING);                
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class BinaryLogReader
+{
+    public:
+        explicit BinaryLogReader(const std::string& path);
+        virtual ~BinaryLogReader();
+
+        bool isOpen() const { return m_Open; }
+        const std::string& error() const { return m_Error; }
+        const std::string& path() const { return m_File.path(); }
+
+        bool wasClosed() const { return m_WasClosed; }
+        const std::vector<ds::BinaryLogBlock>& blocks() const
+            { return m_Blocks; }
+        uint64_t records() const;
+
+        size_t read(Messages& messages);
+        size_t read(Messages& messages, ds::level_t level);
+        size_t read(
+            Messages&                           messages
+          , const lib::time::work::DateTime&    from
+          , const lib::time::work::DateTime&    to
+          , ds::level_t                         level = ds::LEVEL_MAX
+        );
+        size_t readBlock(
+            size_t                              block
+          , Messages&                           messages
+        );
+
+    private:
+        BinaryLogReader(const BinaryLogReader& that);
+        BinaryLogReader& operator=(const BinaryLogReader& that);
+
+        bool readIndex();
+        void walkBlocks();
+        size_t read(
+            Messages&                           messages
+          , int64_t                             from
+          , int64_t                             to
+          , ds::level_t                         level
+        );
+        bool decode(
+            const ds::BinaryLogBlock&           block
+          , Messages&                           messages
+          , int64_t                             from
+          , int64_t                             to
+          , ds::level_t                         level
+          , size_t&                             kept
+        );
+
+        lib::io::work::MappedFile               m_File;
+        std::string                             m_Error;
+        bool                                    m_Open;
+        bool                                    m_WasClosed;
+        std::vector<ds::BinaryLogBlock>         m_Blocks;
+
+        //----------------------------------------------------------------------
+        //  Where each string of the block being decoded lies.                  
+        //----------------------------------------------------------------------
+        std::vector<std::pair<const char*, size_t> > m_Strings;
+
+}; // class BinaryLogReader //
+
+} // namespace work
+} // namespace log
+} // namespace lib
+
+#endif // #ifndef LIB_LOG_WORK_BINARYLOGREADER_H_FILE_GUARD
@@ -0,0 +1,389 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_binarylogreadertest.cpp                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_log_work_binarylogreadertest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_log_work_binarylogreader.h"
+#include "lib_log_work_binarylogwriter.h"
+#include "lib_log_work_message.h"
+#include "lib_string.h"
+#include "lib_time_ds_nanoseconds.h"
+
+#include <chrono>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::log::work::test::BinaryLogReaderTest);
+
+//------------------------------------------------------------------------------
+//  A test file name (the file is removed when the object goes away).           
+//------------------------------------------------------------------------------
+class TestFile
+{
+    public:
+        explicit TestFile(const std::string& name)
+        {
+            const char* directory(getenv("TMPDIR"));
+            #ifdef _WIN32
+            int pid(0);
+            #else
+            int pid(getpid());
+            #endif
+            m_Path = lib::format(
+                "%s/lib_log_work_binarylogreadertest.%s.%d"
+              , directory != nullptr ? directory : "/tmp"
+              , name.c_str()
+              , pid
+            );
+        }
+
+        ~TestFile() { remove(m_Path.c_str()); }
+
+        const std::string& path() const { return m_Path; }
+
+    private:
+        std::string m_Path;
+};
+
+//------------------------------------------------------------------------------
+//  The test messages:  a millisecond apart, mostly VERBOSE, every tenth a      
+//  WARNING and one FATAL.                                                      
+//------------------------------------------------------------------------------
+static const int64_t s_Start(1791000000LL * 1000000000LL);
+
+static ds::level_t severity(int i)
+{
+    return i == 500 ? ds::FATAL : i % 10 == 0 ? ds::WARNING : ds::VERBOSE;
+}
+
+static Message message(int i)
+{
+    Message result(
+        i % 3 == 0 ? ds::MAIN : ds::LIB_MP_THREADINFO
+      , severity(i)
+      , ds::messageid_t(i % 7)
+      , i % 5 == 0 ? lib::format("record %d", i) : std::string("repeated")
+      , lib::time::work::DateTime(
+            lib::time::ds::NanoSeconds(s_Start + i * 1000000LL)
+        )
+      , i % 2 == 0 ? "even" : "odd"
+    );
+    result.setPID(1000 + i % 4);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+BinaryLogReaderTest::BinaryLogReaderTest()
+    : Test("lib::log::work::BinaryLogReader")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    BinaryLogReaderTest object to copy.                         
+//------------------------------------------------------------------------------
+BinaryLogReaderTest::BinaryLogReaderTest(const BinaryLogReaderTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+BinaryLogReaderTest::~BinaryLogReaderTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+/// @param  that    The BinaryLogReaderTest object to copy.                     
+//------------------------------------------------------------------------------
+BinaryLogReaderTest& BinaryLogReaderTest::operator=(
+    const BinaryLogReaderTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // BinaryLogReaderTest::operator=(const BinaryLogReaderTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Write messages with BinaryLogWriter and read them back:  all of      
+///        them, by time window, by severity, and from a file never closed.     
+//------------------------------------------------------------------------------
+void BinaryLogReaderTest::runTest()
+{
+    const int count(1000);
+    TestFile file("closed");
+
+    {
+        BinaryLogWriter writer(file.path(), 1024);
+        TEST(writer.isOpen());
+        int written(0);
+        for (int i = 0; i < count; ++i) if (writer.write(message(i))) ++written;
+        TEST_IS_EQUAL(written, count);
+        TEST(writer.close());
+        TEST_IS_EQUAL(writer.records(), uint64_t(count));
+        TEST(writer.blocks() > 10);
+    }
+
+    BinaryLogReader reader(file.path());
+    TEST(reader.isOpen());
+    TEST(reader.wasClosed());
+    TEST_IS_EQUAL(reader.records(), uint64_t(count));
+
+    //--------------------------------------------------------------------------
+    //  Everything, exactly as written.                                         
+    //--------------------------------------------------------------------------
+    {
+        Messages all;
+        const size_t read(reader.read(all));
+        TEST_IS_EQUAL(read, size_t(count));
+        TEST_IS_EQUAL(all.size(), size_t(count));
+        TEST_IS_EQUAL(all.severityLevel(), ds::FATAL);
+
+        int different(0);
+        for (size_t i = 0; i < all.size(); ++i) {
+            const Message expected(message(int(i)));
+            if (all[i]->toString() != expected.toString()
+             || all[i]->pid() != expected.pid()
+             || all[i]->classID() != expected.classID()
+            ) {
+                ++different;
+            }
+        }
+        TEST_IS_EQUAL(different, 0);
+        if (!all.empty()) {
+            TEST_IS_EQUAL(all[0]->toString(), message(0).toString());
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //  A time window (inclusive), and a window within it by severity.          
+    //--------------------------------------------------------------------------
+    {
+        const lib::time::work::DateTime from(
+            lib::time::ds::NanoSeconds(s_Start + 100 * 1000000LL)
+        );
+        const lib::time::work::DateTime to(
+            lib::time::ds::NanoSeconds(s_Start + 199 * 1000000LL)
+        );
+
+        Messages window;
+        const size_t in_window(reader.read(window, from, to));
+        TEST_IS_EQUAL(in_window, 100);
+        if (window.size() == 100) {
+            TEST_IS_EQUAL(window[0]->toString(), message(100).toString());
+            TEST_IS_EQUAL(window[99]->toString(), message(199).toString());
+        }
+
+        Messages warnings;
+        const size_t warned(reader.read(warnings, from, to, ds::WARNING));
+        TEST_IS_EQUAL(warned, 10);
+    }
+
+    //--------------------------------------------------------------------------
+    //  By severity:  the one FATAL is in one block and only it is decoded.     
+    //--------------------------------------------------------------------------
+    {
+        int fatal_blocks(0);
+        for (size_t b = 0; b < reader.blocks().size(); ++b) {
+            if (reader.blocks()[b].worst == ds::FATAL) ++fatal_blocks;
+        }
+        TEST_IS_EQUAL(fatal_blocks, 1);
+
+        Messages fatal;
+        const size_t fatals(reader.read(fatal, ds::FATAL));
+        TEST_IS_EQUAL(fatals, 1);
+        if (fatal.size() == 1) {
+            TEST_IS_EQUAL(fatal[0]->toString(), message(500).toString());
+        }
+
+        Messages warnings;
+        const size_t warned(reader.read(warnings, ds::WARNING));
+        TEST_IS_EQUAL(warned, 100);
+    }
+
+    //--------------------------------------------------------------------------
+    //  One block at a time.                                                    
+    //--------------------------------------------------------------------------
+    {
+        Messages blocks;
+        int short_blocks(0);
+        for (size_t b = 0; b < reader.blocks().size(); ++b) {
+            if (reader.readBlock(b, blocks) != reader.blocks()[b].records) {
+                ++short_blocks;
+            }
+        }
+        TEST_IS_EQUAL(short_blocks, 0);
+        TEST_IS_EQUAL(blocks.size(), size_t(count));
+    }
+    TEST(reader.error().empty());
+
+    //--------------------------------------------------------------------------
+    //  A file still being written:  the blocks flushed so far.                 
+    //--------------------------------------------------------------------------
+    {
+        TestFile open_file("open");
+        BinaryLogWriter writer(open_file.path(), 1024);
+        for (int i = 0; i < 300; ++i) writer.write(message(i));
+        TEST(writer.flush());
+
+        BinaryLogReader partial(open_file.path());
+        TEST(partial.isOpen());
+        TEST(!partial.wasClosed());
+        TEST_IS_EQUAL(partial.records(), 300);
+
+        Messages all;
+        const size_t read(partial.read(all));
+        TEST_IS_EQUAL(read, 300);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Not a binary log, and no file at all.                                   
+    //--------------------------------------------------------------------------
+    {
+        TestFile text("text");
+        {
+            std::ofstream out(text.path().c_str());
+            out << message(1) << std::endl;
+        }
+        BinaryLogReader not_log(text.path());
+        TEST(!not_log.isOpen());
+        TEST(!not_log.error().empty());
+
+        BinaryLogReader missing(text.path() + ".missing");
+        TEST(!missing.isOpen());
+        TEST(!missing.error().empty());
+    }
+
+} // void BinaryLogReaderTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Compare writing and reading back as text (toString, and parsing     
+///        each line back into a Message) with the binary log, and reading a    
+///        narrow window.                                                       
+//------------------------------------------------------------------------------
+void BinaryLogReaderTest::runTest3()
+{
+    const int count(200000);
+    TestFile text("text");
+    TestFile binary("binary");
+
+    typedef std::chrono::steady_clock clock;
+    auto seconds = [](clock::time_point start) {
+        return std::chrono::duration<double>(clock::now() - start).count();
+    };
+
+    Messages messages;
+    for (int i = 0; i < count; ++i) {
+        messages.push_back(ConstMessagePtr(new Message(message(i))));
+    }
+
+    //--------------------------------------------------------------------------
+    //  Text.                                                                   
+    //--------------------------------------------------------------------------
+    clock::time_point start(clock::now());
+    {
+        std::ofstream out(text.path().c_str());
+        for (int i = 0; i < count; ++i) out << *messages[i] << '\n';
+    }
+    const double text_write(seconds(start));
+
+    start = clock::now();
+    Messages from_text;
+    {
+        std::ifstream in(text.path().c_str());
+        std::string line;
+        while (std::getline(in, line)) {
+            from_text.push_back(ConstMessagePtr(new Message(line)));
+        }
+    }
+    const double text_read(seconds(start));
+
+    //--------------------------------------------------------------------------
+    //  Binary.                                                                 
+    //--------------------------------------------------------------------------
+    start = clock::now();
+    {
+        BinaryLogWriter writer(binary.path());
+        writer.write(messages);
+    }
+    const double binary_write(seconds(start));
+
+    BinaryLogReader reader(binary.path());
+    start = clock::now();
+    Messages from_binary;
+    reader.read(from_binary);
+    const double binary_read(seconds(start));
+    TEST_IS_EQUAL(from_binary.size(), size_t(count));
+
+    start = clock::now();
+    Messages window;
+    reader.read(
+        window
+      , lib::time::work::DateTime(
+            lib::time::ds::NanoSeconds(s_Start + 150000 * 1000000LL)
+        )
+      , lib::time::work::DateTime(
+            lib::time::ds::NanoSeconds(s_Start + 150999 * 1000000LL)
+        )
+    );
+    const double window_read(seconds(start));
+    TEST_IS_EQUAL(window.size(), 1000);
+
+    std::ifstream text_size(text.path().c_str(), std::ios::ate);
+    std::ifstream binary_size(binary.path().c_str(), std::ios::ate);
+
+    output(
+        vSummary
+      , lib::format(
+            "text   %9ld bytes  write %6.1lf ns  read %6.1lf ns (%zu)"
+          , long(text_size.tellg())
+          , text_write * 1e9 / count
+          , text_read * 1e9 / count
+          , from_text.size()
+        )
+    );
+    output(
+        vSummary
+      , lib::format(
+            "binary %9ld bytes  write %6.1lf ns  read %6.1lf ns"
+            "  window of 1000 %.3lf ms"
+          , long(binary_size.tellg())
+          , binary_write * 1e9 / count
+          , binary_read * 1e9 / count
+          , window_read * 1e3
+        )
+    );
+
+} // void BinaryLogReaderTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_binarylogreadertest.h                                     
+//------------------------------------------------------------------------------
+#ifndef LIB_LOG_WORK_BINARYLOGREADERTEST_H
+#define LIB_LOG_WORK_BINARYLOGREADERTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: BinaryLogReaderTest                                              
+///                                                                             
+///@par Purpose:                                                                
+///         The BinaryLogReaderTest class provides the regression test for      
+///         the lib::log::work::BinaryLogReader class.                          
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class BinaryLogReaderTest : public dev::test::work::Test {
+    public:
+        BinaryLogReaderTest();
+        BinaryLogReaderTest(const BinaryLogReaderTest& that);
+        virtual ~BinaryLogReaderTest();
+        BinaryLogReaderTest& operator=(const BinaryLogReaderTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class BinaryLogReaderTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_LOG_WORK_BINARYLOGREADERTEST_H //
@@ -0,0 +1,223 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_binarylogwriter.cpp                                       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   Log messages written to a compact, indexed binary file.             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_log_work_binarylogwriter.h"
+
+#include <errno.h>
+#include <string.h>                 // strerror
+
+namespace lib {
+namespace log {
+namespace work {
+
+using lib::log::ds::BinaryLog;
+
+//------------------------------------------------------------------------------
+///@brief   Create (or truncate) the file and write its magic number.           
+///@param   path        The file to write.                                      
+///@param   block_size  The bytes gathered before a block is written.           
+//------------------------------------------------------------------------------
+BinaryLogWriter::BinaryLogWriter(
+    const std::string&  path
+  , size_t              block_size
+)
+    : m_Path(path)
+    , m_File(path.c_str(), std::ios::binary | std::ios::trunc)
+    , m_BlockSize(block_size)
+    , m_Offset(0)
+    , m_Records(0)
+    , m_PreviousTime(0)
+    , m_PreviousPID(0)
+{
+    m_Block.records = 0;
+
+    if (!m_File.is_open()) {
+        m_Error = path + ": " + strerror(errno);
+        return;
+    }
+
+    output(BinaryLog::fileMagic());
+
+} // BinaryLogWriter::BinaryLogWriter() //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object (closing the file first).          
+//------------------------------------------------------------------------------
+BinaryLogWriter::~BinaryLogWriter()
+{
+    close();
+
+} // BinaryLogWriter::~BinaryLogWriter() //
+
+//------------------------------------------------------------------------------
+///@brief   Add the message to the block (writing the block if it is full).     
+///@return  false if the file is not open or a write failed.                    
+//------------------------------------------------------------------------------
+bool BinaryLogWriter::write(const Message& message)
+{
+    if (!isOpen()) return false;
+
+    const int64_t time(message.timeStamp().nanoSeconds().count());
+    const ds::level_t severity(message.severityLevel());
+
+    if (m_Block.records == 0) {
+        m_Block.first = m_Block.last = time;
+        m_Block.worst = severity;
+        m_PreviousTime = 0;
+        m_PreviousPID = 0;
+    } else {
+        if (time < m_Block.first) m_Block.first = time;
+        if (time > m_Block.last) m_Block.last = time;
+        if (severity < m_Block.worst) m_Block.worst = severity;
+    }
+
+    const int64_t micro(time / 1000);
+    BinaryLog::putVarint(m_Data, BinaryLog::zigzag(micro - m_PreviousTime));
+    BinaryLog::putVarint(m_Data, message.classID());
+    BinaryLog::putVarint(m_Data, message.messageID());
+    m_Data += char(severity);
+    BinaryLog::putVarint(
+        m_Data, BinaryLog::zigzag(message.pid() - m_PreviousPID)
+    );
+    BinaryLog::putVarint(m_Data, string(message.applicationMnemonic()));
+    BinaryLog::putVarint(m_Data, string(message.message()));
+
+    m_PreviousTime = micro;
+    m_PreviousPID = message.pid();
+    ++m_Block.records;
+    ++m_Records;
+
+    if (m_Strings.size() + m_Data.size() >= m_BlockSize) return endBlock();
+    return true;
+
+} // bool BinaryLogWriter::write(const Message& message) //
+
+//------------------------------------------------------------------------------
+///@brief   Add each of the messages.                                           
+//------------------------------------------------------------------------------
+bool BinaryLogWriter::write(const Messages& messages)
+{
+    for (size_t m = 0; m < messages.size(); ++m) {
+        if (!write(*messages[m])) return false;
+    }
+    return true;
+
+} // bool BinaryLogWriter::write(const Messages& messages) //
+
+//------------------------------------------------------------------------------
+///@brief   Write the block gathered so far (even if it is not full).           
+//------------------------------------------------------------------------------
+bool BinaryLogWriter::flush()
+{
+    if (!endBlock()) return false;
+    m_File.flush();
+    return m_File.good();
+
+} // bool BinaryLogWriter::flush() //
+
+//------------------------------------------------------------------------------
+///@brief   Write the last block, the index and the tail, and close the file.   
+///@return  false if the file was not open or a write failed.                   
+//------------------------------------------------------------------------------
+bool BinaryLogWriter::close()
+{
+    if (!m_File.is_open()) return false;
+
+    if (endBlock()) {
+        const uint64_t index(m_Offset);
+
+        m_Buffer.assign(BinaryLog::indexMagic());
+        BinaryLog::put32(m_Buffer, uint32_t(m_Index.size()));
+        for (size_t b = 0; b < m_Index.size(); ++b) {
+            BinaryLog::putIndexEntry(m_Buffer, m_Index[b]);
+        }
+        BinaryLog::put64(m_Buffer, index);
+        m_Buffer += BinaryLog::endMagic();
+
+        output(m_Buffer);
+    }
+
+    m_File.close();
+    if (m_File.fail() && m_Error.empty()) m_Error = m_Path + ": close failed";
+
+    return m_Error.empty();
+
+} // bool BinaryLogWriter::close() //
+
+//------------------------------------------------------------------------------
+///@brief   The string's index in the block's string table (adding it if it is  
+///         not there yet).                                                     
+//------------------------------------------------------------------------------
+uint32_t BinaryLogWriter::string(const std::string& str)
+{
+    std::pair<std::unordered_map<std::string, uint32_t>::iterator, bool> added(
+        m_StringIndex.insert(
+            std::make_pair(str, uint32_t(m_StringIndex.size()))
+        )
+    );
+
+    if (added.second) {
+        BinaryLog::putVarint(m_Strings, str.size());
+        m_Strings += str;
+    }
+
+    return added.first->second;
+
+} // uint32_t BinaryLogWriter::string(const std::string& str) //
+
+//------------------------------------------------------------------------------
+///@brief   Write the block gathered (if any) and start the next.               
+//------------------------------------------------------------------------------
+bool BinaryLogWriter::endBlock()
+{
+    if (!isOpen()) return false;
+    if (m_Block.records == 0) return true;
+
+    std::string count;
+    BinaryLog::putVarint(count, m_StringIndex.size());
+
+    m_Block.offset = m_Offset;
+    m_Block.size = uint32_t(count.size() + m_Strings.size() + m_Data.size());
+
+    m_Buffer.clear();
+    BinaryLog::putBlockHeader(m_Buffer, m_Block);
+    m_Buffer += count;
+
+    const bool result(output(m_Buffer) && output(m_Strings) && output(m_Data));
+    m_Index.push_back(m_Block);
+
+    m_Block.records = 0;
+    m_Strings.clear();
+    m_StringIndex.clear();
+    m_Data.clear();
+
+    return result;
+
+} // bool BinaryLogWriter::endBlock() //
+
+//------------------------------------------------------------------------------
+///@brief   Write the bytes to the file.                                        
+//------------------------------------------------------------------------------
+bool BinaryLogWriter::output(const std::string& bytes)
+{
+    m_File.write(bytes.data(), std::streamsize(bytes.size()));
+    if (!m_File.good()) {
+        if (m_Error.empty()) m_Error = m_Path + ": write failed";
+        return false;
+    }
+
+    m_Offset += bytes.size();
+    return true;
+
+} // bool BinaryLogWriter::output(const std::string& bytes) //
+
+} // namespace work
+} // namespace log
+} // namespace lib
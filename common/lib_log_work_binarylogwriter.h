@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_binarylogwriter.h                                         
+///@brief Holds lib::log::work::BinaryLogWriter, log messages written to a      
+///       compact, indexed binary file.                                         
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_LOG_WORK_BINARYLOGWRITER_H_FILE_GUARD
+#define LIB_LOG_WORK_BINARYLOGWRITER_H_FILE_GUARD
+
+#include "lib_log_ds_binarylog.h"
+#include "lib_log_work_message.h"
+
+#include <fstream>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lib {
+namespace log {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Write Messages to a binary log file (lib::log::ds::BinaryLog) for   
+///         BinaryLogReader to read back.                                       
+///                                                                             
+///@par Purpose:                                                                
+///         A test run archives millions of messages.  As text (toString)       
+///         each is some 60 bytes plus its text, and reading it back is a       
+///         parse (operator>>) per line.  Here each is a handful of varints     
+///         and string table indexes, in blocks that carry their time span      
+///         and worst severity, so a reader goes straight to the blocks of a    
+///         time window or of the messages worse than a level.                  
+///                                                                             
+///@par Blocks                                                                  
+///         Messages are gathered in memory until the block holds               
+///         block_size bytes (or flush() is called), and the block is then      
+///         written as a whole.  Mnemonics and texts are kept once per block    
+///         in its string table.                                                
+///                                                                             
+///@par Errors                                                                  
+///         isOpen() is false (and error() says why) if the file could not      
+///         be created or a write failed; write and close then return false.    
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::log::work::BinaryLogWriter log("run.dlog");                    
+///         if (!log.isOpen()) throw std::runtime_error(log.error());           
+///         ...                                                                 
+///         log.write(message);                                                 
+///         ...                                                                 
+///         log.close();                                                        
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class BinaryLogWriter
+{
+    public:
+        static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+        explicit BinaryLogWriter(
+            const std::string&  path
+          , size_t              block_size = DEFAULT_BLOCK_SIZE
+        );
+        virtual ~BinaryLogWriter();
+
+        bool isOpen() const { return m_File.is_open() && m_Error.empty(); }
+        const std::string& error() const { return m_Error; }
+        const std::string& path() const { return m_Path; }
+
+        bool write(const Message& message);
+        bool write(const Messages& messages);
+
+        inline void operator()(ConstMessagePtr msg) { write(*msg); }
+        inline void operator()(const Messages& msgs) { write(msgs); }
+
+        bool flush();
+        bool close();
+
+        uint64_t records() const { return m_Records; }
+        size_t blocks() const { return m_Index.size(); }
+
+    private:
+        BinaryLogWriter(const BinaryLogWriter& that);
+        BinaryLogWriter& operator=(const BinaryLogWriter& that);
+
+        uint32_t string(const std::string& str);
+        bool endBlock();
+        bool output(const std::string& bytes);
+
+        std::string                                 m_Path;
+        std::string                                 m_Error;
+        std::ofstream                               m_File;
+        const size_t                                m_BlockSize;
+        uint64_t                                    m_Offset;
+        uint64_t                                    m_Records;
+        std::vector<ds::BinaryLogBlock>             m_Index;
+
+        ds::BinaryLogBlock                          m_Block;
+        std::string                                 m_Strings;
+        std::unordered_map<std::string, uint32_t>   m_StringIndex;
+        std::string                                 m_Data;
+        int64_t                                     m_PreviousTime;
+        int64_t                                     m_PreviousPID;
+        std::string                                 m_Buffer;
+
+}; // class BinaryLogWriter //
+
+} // namespace work
+} // namespace log
+} // namespace lib
+
+#endif // #ifndef LIB_LOG_WORK_BINARYLOGWRITER_H_FILE_GUARD
@@ -0,0 +1,240 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_indexedmessages.cpp                                       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   Messages that find by id and count by severity without a scan.      
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_log_work_indexedmessages.h"
+
+#include <algorithm>
+
+namespace lib {
+namespace log {
+namespace work {
+
+//------------------------------------------------------------------------------
+///@brief   Construct an empty collection.                                      
+//------------------------------------------------------------------------------
+IndexedMessages::IndexedMessages()
+{
+    std::fill(m_Severities, m_Severities + LEVELS, 0);
+
+} // IndexedMessages::IndexedMessages() //
+
+//------------------------------------------------------------------------------
+///@brief   Copy the messages and their indexes.                                
+//------------------------------------------------------------------------------
+IndexedMessages::IndexedMessages(const IndexedMessages& that)
+    : Messages(that)
+    , m_ByMessageID(that.m_ByMessageID)
+    , m_ByClassAndMessageID(that.m_ByClassAndMessageID)
+{
+    std::copy(that.m_Severities, that.m_Severities + LEVELS, m_Severities);
+
+} // IndexedMessages::IndexedMessages(const IndexedMessages& that) //
+
+//------------------------------------------------------------------------------
+///@brief   Index the messages of a plain Messages.                             
+//------------------------------------------------------------------------------
+IndexedMessages::IndexedMessages(const Messages& that)
+{
+    std::fill(m_Severities, m_Severities + LEVELS, 0);
+    push_back(that);
+
+} // IndexedMessages::IndexedMessages(const Messages& that) //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+IndexedMessages::~IndexedMessages()
+{
+
+} // IndexedMessages::~IndexedMessages() //
+
+//------------------------------------------------------------------------------
+///@brief   Copy the messages and their indexes.                                
+//------------------------------------------------------------------------------
+IndexedMessages& IndexedMessages::operator=(const IndexedMessages& that)
+{
+    Messages::operator=(that);
+    m_ByMessageID = that.m_ByMessageID;
+    m_ByClassAndMessageID = that.m_ByClassAndMessageID;
+    std::copy(that.m_Severities, that.m_Severities + LEVELS, m_Severities);
+    return *this;
+
+} // IndexedMessages::operator=(const IndexedMessages& that) //
+
+//------------------------------------------------------------------------------
+///@brief   Append the message and index it.                                    
+//------------------------------------------------------------------------------
+void IndexedMessages::push_back(ConstMessagePtr msg)
+{
+    Messages::push_back(msg);
+
+    const size_t at(size() - 1);
+    add(m_ByMessageID, msg->messageID(), at, 1);
+    add(m_ByClassAndMessageID, key(msg->classID(), msg->messageID()), at, 1);
+    ++m_Severities[bucket(msg->severityLevel())];
+
+} // void IndexedMessages::push_back(ConstMessagePtr msg) //
+
+//------------------------------------------------------------------------------
+///@brief   Append the messages; another IndexedMessages' indexes are merged    
+///         into these rather than rebuilt.                                     
+//------------------------------------------------------------------------------
+void IndexedMessages::push_back(const Messages& msgs)
+{
+    if (&msgs == this) {
+        const IndexedMessages copy(*this);
+        push_back(copy);
+        return;
+    }
+
+    reserve(size() + msgs.size());
+
+    const IndexedMessages* indexed(dynamic_cast<const IndexedMessages*>(&msgs));
+    if (indexed == nullptr) {
+        for (size_t m = 0; m < msgs.size(); ++m) push_back(msgs[m]);
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    //  Messages::push_back keeps the highest severity level; the ids are       
+    //  merged a distinct id at a time.                                         
+    //--------------------------------------------------------------------------
+    const size_t offset(size());
+    for (size_t m = 0; m < msgs.size(); ++m) Messages::push_back(msgs[m]);
+
+    for (Index::const_iterator i = indexed->m_ByMessageID.begin();
+         i != indexed->m_ByMessageID.end();
+         ++i
+    ) {
+        add(
+            m_ByMessageID
+          , i->first
+          , offset + i->second.first
+          , i->second.count
+        );
+    }
+    for (Index::const_iterator i = indexed->m_ByClassAndMessageID.begin();
+         i != indexed->m_ByClassAndMessageID.end();
+         ++i
+    ) {
+        add(
+            m_ByClassAndMessageID
+          , i->first
+          , offset + i->second.first
+          , i->second.count
+        );
+    }
+    for (size_t l = 0; l < LEVELS; ++l) {
+        m_Severities[l] += indexed->m_Severities[l];
+    }
+
+} // void IndexedMessages::push_back(const Messages& msgs) //
+
+//------------------------------------------------------------------------------
+///@brief   Remove every message (and the indexes).                             
+//------------------------------------------------------------------------------
+void IndexedMessages::clear()
+{
+    Messages::clear();
+    m_ByMessageID.clear();
+    m_ByClassAndMessageID.clear();
+    std::fill(m_Severities, m_Severities + LEVELS, 0);
+
+} // void IndexedMessages::clear() //
+
+//------------------------------------------------------------------------------
+///@brief   The index of the first message with the message id (-1 if none).    
+//------------------------------------------------------------------------------
+int IndexedMessages::find(ds::messageid_t messageid)
+{
+    Index::const_iterator i(m_ByMessageID.find(messageid));
+    return i == m_ByMessageID.end() ? -1 : int(i->second.first);
+
+} // int IndexedMessages::find(ds::messageid_t messageid) //
+
+//------------------------------------------------------------------------------
+///@brief   The index of the first message with the class and message ids (-1   
+///         if none).                                                           
+//------------------------------------------------------------------------------
+int IndexedMessages::find(
+    lib::log::ds::class_t   classid
+  , ds::messageid_t         messageid
+)
+{
+    Index::const_iterator i(
+        m_ByClassAndMessageID.find(key(classid, messageid))
+    );
+    return i == m_ByClassAndMessageID.end() ? -1 : int(i->second.first);
+
+} // int IndexedMessages::find(classid, messageid) //
+
+//------------------------------------------------------------------------------
+///@brief   The number of messages with the message id.                         
+//------------------------------------------------------------------------------
+size_t IndexedMessages::count(ds::messageid_t messageid) const
+{
+    Index::const_iterator i(m_ByMessageID.find(messageid));
+    return i == m_ByMessageID.end() ? 0 : i->second.count;
+
+} // size_t IndexedMessages::count(ds::messageid_t messageid) const //
+
+//------------------------------------------------------------------------------
+///@brief   The number of messages with the class and message ids.              
+//------------------------------------------------------------------------------
+size_t IndexedMessages::count(
+    lib::log::ds::class_t   classid
+  , ds::messageid_t         messageid
+) const
+{
+    Index::const_iterator i(
+        m_ByClassAndMessageID.find(key(classid, messageid))
+    );
+    return i == m_ByClassAndMessageID.end() ? 0 : i->second.count;
+
+} // size_t IndexedMessages::count(classid, messageid) const //
+
+//------------------------------------------------------------------------------
+///@brief   The number of messages of the severity.                             
+///@note    Levels past LEVEL_MAX (e.g., UNDEFINED) are counted together.       
+//------------------------------------------------------------------------------
+size_t IndexedMessages::count(ds::level_t severity) const
+{
+    return m_Severities[bucket(severity)];
+
+} // size_t IndexedMessages::count(ds::level_t severity) const //
+
+//------------------------------------------------------------------------------
+///@brief   The number of messages as bad as or worse than level (see           
+///         Message::asBadOrWorseThan).                                         
+//------------------------------------------------------------------------------
+size_t IndexedMessages::countAsBadOrWorseThan(ds::level_t level) const
+{
+    size_t result(0);
+    for (size_t l = 0; l <= bucket(level); ++l) result += m_Severities[l];
+    return result;
+
+} // size_t IndexedMessages::countAsBadOrWorseThan(ds::level_t level) const //
+
+//------------------------------------------------------------------------------
+///@brief   Note count messages under key, the first at at.                     
+//------------------------------------------------------------------------------
+void IndexedMessages::add(Index& index, uint64_t key, size_t at, size_t count)
+{
+    Entry entry = { at, count };
+    std::pair<Index::iterator, bool> added(
+        index.insert(std::make_pair(key, entry))
+    );
+    if (!added.second) added.first->second.count += count;
+
+} // void IndexedMessages::add() //
+
+} // namespace work
+} // namespace log
+} // namespace lib
@@ -0,0 +1,121 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_indexedmessages.h                                         
+///@brief Holds lib::log::work::IndexedMessages, Messages that find by id and   
+///       count by severity without a scan.                                     
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_LOG_WORK_INDEXEDMESSAGES_H_FILE_GUARD
+#define LIB_LOG_WORK_INDEXEDMESSAGES_H_FILE_GUARD
+
+#include "lib_log_ds.h"
+#include "lib_log_work_message.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+
+namespace lib {
+namespace log {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Messages kept with hash indexes by message id and by (class id,     
+///         message id), and a count of each severity.                          
+///                                                                             
+///@par Purpose:                                                                
+///         Messages::find is a scan of the whole collection; a validator       
+///         asking after many ids in a result set of 100k messages makes it     
+///         quadratic.  Here the indexes are kept up as messages are pushed:    
+///         find is a hash lookup, and count() and countAsBadOrWorseThan()      
+///         are a few additions.                                                
+///                                                                             
+///@par Merging                                                                 
+///         push_back of another IndexedMessages appends its messages and       
+///         merges its indexes (one step per distinct id, not per message).     
+///         Other Messages are indexed one message at a time.                   
+///                                                                             
+///@note    Change the collection only through push_back and clear (as for      
+///         Messages' severity level); the vector's own insert, erase and       
+///         the like do not keep the indexes.                                   
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::log::work::IndexedMessages results;                            
+///         reader.read(results);                                               
+///         ...                                                                 
+///         if (results.find(ds::MAIN, MSG_CHECKSUM) >= 0) ...                  
+///         if (results.count(ds::MAIN, MSG_DROPOUT) > 3) ...                   
+///         if (results.countAsBadOrWorseThan(ds::WARNING) > 0) ...             
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class IndexedMessages : public Messages
+{
+    public:
+        IndexedMessages();
+        IndexedMessages(const IndexedMessages& that);
+        explicit IndexedMessages(const Messages& that);
+        virtual ~IndexedMessages();
+        IndexedMessages& operator=(const IndexedMessages& that);
+
+        void push_back(ConstMessagePtr msg) override;
+        void push_back(const Messages& msgs) override;
+        void clear() override;
+
+        int find(ds::messageid_t messageid) override;
+        int find(
+            lib::log::ds::class_t   classid
+          , ds::messageid_t         messageid
+        ) override;
+
+        size_t count(ds::messageid_t messageid) const;
+        size_t count(
+            lib::log::ds::class_t   classid
+          , ds::messageid_t         messageid
+        ) const;
+        size_t count(ds::level_t severity) const;
+        size_t countAsBadOrWorseThan(ds::level_t level) const;
+
+    private:
+        //----------------------------------------------------------------------
+        //  Where an id was first seen and how many times.                      
+        //----------------------------------------------------------------------
+        struct Entry
+        {
+            size_t  first;
+            size_t  count;
+        };
+        using Index = std::unordered_map<uint64_t, Entry>;
+
+        static uint64_t key(
+            lib::log::ds::class_t   classid
+          , ds::messageid_t         messageid
+        )
+        {
+            return uint64_t(classid) << 32 | messageid;
+        }
+        static size_t bucket(ds::level_t level)
+        {
+            return level <= ds::LEVEL_MAX ? size_t(level) : LEVELS - 1;
+        }
+        static void add(Index& index, uint64_t key, size_t at, size_t count);
+
+        static const size_t LEVELS = ds::LEVEL_MAX + 2;     ///< + the others
+
+        Index       m_ByMessageID;
+        Index       m_ByClassAndMessageID;
+        size_t      m_Severities[LEVELS];
+
+}; // class IndexedMessages //
+
+} // namespace work
+} // namespace log
+} // namespace lib
+
+#endif // #ifndef LIB_LOG_WORK_INDEXEDMESSAGES_H_FILE_GUARD
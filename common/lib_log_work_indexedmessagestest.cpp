@@ -0,0 +1,293 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_indexedmessagestest.cpp                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_log_work_indexedmessagestest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_log_work_indexedmessages.h"
+#include "lib_log_work_message.h"
+#include "lib_string.h"
+
+#include <chrono>
+#include <stdlib.h>
+#include <string>
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::log::work::test::IndexedMessagesTest);
+
+//------------------------------------------------------------------------------
+//  A message of (class, id) and severity.                                      
+//------------------------------------------------------------------------------
+static ConstMessagePtr message(
+    ds::class_t         classid
+  , ds::messageid_t     id
+  , ds::level_t         severity
+)
+{
+    return ConstMessagePtr(
+        new Message(classid, severity, id, "", lib::time::work::DateTime())
+    );
+}
+
+//------------------------------------------------------------------------------
+//  The number of messages with the class and message ids, by looking.          
+//------------------------------------------------------------------------------
+static size_t scan(
+    const Messages&     messages
+  , ds::class_t         classid
+  , ds::messageid_t     id
+)
+{
+    size_t result(0);
+    for (size_t m = 0; m < messages.size(); ++m) {
+        if (messages[m]->classID() == classid && messages[m]->messageID() == id)
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+IndexedMessagesTest::IndexedMessagesTest()
+    : Test("lib::log::work::IndexedMessages")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    IndexedMessagesTest object to copy.                         
+//------------------------------------------------------------------------------
+IndexedMessagesTest::IndexedMessagesTest(const IndexedMessagesTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+IndexedMessagesTest::~IndexedMessagesTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+/// @param  that    The IndexedMessagesTest object to copy.                     
+//------------------------------------------------------------------------------
+IndexedMessagesTest& IndexedMessagesTest::operator=(
+    const IndexedMessagesTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // IndexedMessagesTest::operator=(const IndexedMessagesTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Test find and the counts against Messages, merges, and the indexes   
+///        through a Messages reference.                                        
+//------------------------------------------------------------------------------
+void IndexedMessagesTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  The same answers as Messages (which looks).                             
+    //--------------------------------------------------------------------------
+    Messages plain;
+    IndexedMessages indexed;
+
+    for (int i = 0; i < 1000; ++i) {
+        ConstMessagePtr m(
+            message(
+                i % 2 == 0 ? ds::MAIN : ds::LIB_MP_THREADINFO
+              , ds::messageid_t(i % 13)
+              , i % 100 == 0 ? ds::CRITICAL : ds::VERBOSE
+            )
+        );
+        plain.push_back(m);
+        indexed.push_back(m);
+    }
+
+    TEST_IS_EQUAL(indexed.size(), plain.size());
+    TEST_IS_EQUAL(indexed.severityLevel(), ds::CRITICAL);
+
+    int wrong(0);
+    for (ds::messageid_t id = 0; id < 15; ++id) {
+        if (indexed.find(id) != plain.find(id)) ++wrong;
+        if (indexed.find(ds::MAIN, id) != plain.find(ds::MAIN, id)) ++wrong;
+        if (indexed.find(ds::LIB_MP_THREADINFO, id)
+         != plain.find(ds::LIB_MP_THREADINFO, id)
+        ) {
+            ++wrong;
+        }
+        if (indexed.count(ds::MAIN, id) != scan(plain, ds::MAIN, id)) ++wrong;
+    }
+    TEST_IS_EQUAL(wrong, 0);
+
+    TEST_IS_EQUAL(indexed.find(ds::messageid_t(99)), -1);
+    TEST_IS_EQUAL(indexed.find(ds::CLASS_UNKNOWN, 1), -1);
+    TEST_IS_EQUAL(indexed.count(ds::CLASS_UNKNOWN, 1), 0);
+    TEST_IS_EQUAL(indexed.count(ds::messageid_t(1)), 77);
+
+    TEST_IS_EQUAL(indexed.count(ds::CRITICAL), 10);
+    TEST_IS_EQUAL(indexed.count(ds::VERBOSE), 990);
+    TEST_IS_EQUAL(indexed.count(ds::FATAL), 0);
+    TEST_IS_EQUAL(indexed.countAsBadOrWorseThan(ds::WARNING), 10);
+    TEST_IS_EQUAL(indexed.countAsBadOrWorseThan(ds::LEVEL_MAX), 1000);
+
+    //--------------------------------------------------------------------------
+    //  Through a Messages reference, find is the indexed one.                  
+    //--------------------------------------------------------------------------
+    {
+        Messages& as_messages(indexed);
+        TEST_IS_EQUAL(as_messages.find(ds::MAIN, 4), plain.find(ds::MAIN, 4));
+        as_messages.push_back(message(ds::LIB_LOG_ASYNC_SINK, 1, ds::FATAL));
+        TEST_IS_EQUAL(indexed.find(ds::LIB_LOG_ASYNC_SINK, 1), 1000);
+        TEST_IS_EQUAL(indexed.count(ds::FATAL), 1);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Merging:  the other's first indexes move up by the size before.         
+    //--------------------------------------------------------------------------
+    {
+        IndexedMessages more;
+        more.push_back(message(ds::MAIN, 500, ds::WARNING));
+        more.push_back(message(ds::MAIN, 3, ds::WARNING));
+        more.push_back(message(ds::MAIN, 500, ds::INFORMATIONAL));
+
+        IndexedMessages merged(indexed);
+        merged.push_back(more);
+
+        TEST_IS_EQUAL(merged.size(), 1004);
+        TEST_IS_EQUAL(merged.find(ds::MAIN, 500), 1001);
+        TEST_IS_EQUAL(merged.count(ds::MAIN, 500), 2);
+        TEST_IS_EQUAL(merged.find(ds::MAIN, 3), indexed.find(ds::MAIN, 3));
+        TEST_IS_EQUAL(
+            merged.count(ds::MAIN, 3), indexed.count(ds::MAIN, 3) + 1
+        );
+        TEST_IS_EQUAL(merged.count(ds::WARNING), 2);
+        TEST_IS_EQUAL(merged.severityLevel(), ds::FATAL);
+
+        //----------------------------------------------------------------------
+        //  ... and a plain Messages is indexed as it is appended.              
+        //----------------------------------------------------------------------
+        Messages other;
+        other.push_back(message(ds::MAIN, 600, ds::VERBOSE));
+        merged.push_back(other);
+        TEST_IS_EQUAL(merged.find(ds::MAIN, 600), 1004);
+
+        //----------------------------------------------------------------------
+        //  ... and itself.                                                     
+        //----------------------------------------------------------------------
+        merged.push_back(merged);
+        TEST_IS_EQUAL(merged.size(), 2010);
+        TEST_IS_EQUAL(merged.count(ds::MAIN, 600), 2);
+        TEST_IS_EQUAL(merged.find(ds::MAIN, 600), 1004);
+
+        const IndexedMessages from_plain(plain);
+        TEST_IS_EQUAL(from_plain.count(ds::CRITICAL), 10);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Cleared.                                                                
+    //--------------------------------------------------------------------------
+    indexed.clear();
+    TEST(indexed.empty());
+    TEST_IS_EQUAL(indexed.find(ds::MAIN, 4), -1);
+    TEST_IS_EQUAL(indexed.count(ds::VERBOSE), 0);
+    TEST_IS_EQUAL(indexed.severityLevel(), ds::UNDEFINED);
+
+} // void IndexedMessagesTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Time finds in and merges of 100k messages, Messages against          
+///        IndexedMessages.                                                     
+//------------------------------------------------------------------------------
+void IndexedMessagesTest::runTest3()
+{
+    const int count(100000);
+    const int finds(2000);
+
+    typedef std::chrono::steady_clock clock;
+    auto seconds = [](clock::time_point start) {
+        return std::chrono::duration<double>(clock::now() - start).count();
+    };
+
+    Messages plain;
+    IndexedMessages indexed;
+    for (int i = 0; i < count; ++i) {
+        ConstMessagePtr m(
+            message(ds::MAIN, ds::messageid_t(i % 5000), ds::VERBOSE)
+        );
+        plain.push_back(m);
+        indexed.push_back(m);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Finds, half of them for ids that are not there.                         
+    //--------------------------------------------------------------------------
+    int64_t sum(0);
+    clock::time_point start(clock::now());
+    for (int f = 0; f < finds; ++f) sum += plain.find(ds::MAIN, f * 5);
+    const double plain_find(seconds(start));
+
+    int64_t indexed_sum(0);
+    start = clock::now();
+    for (int f = 0; f < finds; ++f) indexed_sum += indexed.find(ds::MAIN, f*5);
+    const double indexed_find(seconds(start));
+    TEST_IS_EQUAL(indexed_sum, sum);
+
+    //--------------------------------------------------------------------------
+    //  Merging result sets.                                                    
+    //--------------------------------------------------------------------------
+    start = clock::now();
+    Messages plain_merged;
+    for (int r = 0; r < 10; ++r) plain_merged.push_back(plain);
+    const double plain_merge(seconds(start));
+
+    start = clock::now();
+    IndexedMessages indexed_merged;
+    for (int r = 0; r < 10; ++r) indexed_merged.push_back(indexed);
+    const double indexed_merge(seconds(start));
+    TEST_IS_EQUAL(indexed_merged.count(ds::MAIN, 7), 200);
+
+    output(
+        vSummary
+      , lib::format(
+            "find in %d:  Messages %8.1lf us  IndexedMessages %6.3lf us"
+          , count
+          , plain_find * 1e6 / finds
+          , indexed_find * 1e6 / finds
+        )
+    );
+    output(
+        vSummary
+      , lib::format(
+            "merge 10 x %d:  Messages %6.2lf ms  IndexedMessages %6.2lf ms"
+          , count
+          , plain_merge * 1e3
+          , indexed_merge * 1e3
+        )
+    );
+
+} // void IndexedMessagesTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_indexedmessagestest.h                                     
+//------------------------------------------------------------------------------
+#ifndef LIB_LOG_WORK_INDEXEDMESSAGESTEST_H
+#define LIB_LOG_WORK_INDEXEDMESSAGESTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: IndexedMessagesTest                                              
+///                                                                             
+///@par Purpose:                                                                
+///         The IndexedMessagesTest class provides the regression test for      
+///         the lib::log::work::IndexedMessages class.                          
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class IndexedMessagesTest : public dev::test::work::Test {
+    public:
+        IndexedMessagesTest();
+        IndexedMessagesTest(const IndexedMessagesTest& that);
+        virtual ~IndexedMessagesTest();
+        IndexedMessagesTest& operator=(const IndexedMessagesTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class IndexedMessagesTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_LOG_WORK_INDEXEDMESSAGESTEST_H //
@@ -6,6 +6,13 @@
 ///                                                                             
 ///@brief   Object respenting a single log message.                             
 ///                                                                             
+///@version 2026-10-16  DHF     Added Messages' destructor (its modifiers are   
+///                             now virtual).                                   
+///                                                                             
+///@version 2026-10-16  DHF     Added setPID.                                   
+///                                                                             
+///@version 2026-10-16  DHF     Time stamps written by DateTimeFormatter.       
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2017-02-16  DHF     Modified Messages empty severity level to       
@@ -31,6 +38,7 @@
 #include "lib_log_work.h"
 #include "lib_si_ds_prefixes.h"
 #include "lib_string.h"
+#include "lib_time_work_datetimeformatter.h"
 
 #include <boost/algorithm/string.hpp>
 
@@ -284,6 +292,14 @@ void Message::setMessage(const std::string& msg)
 
 } // Message::void setMessage(const std:;string& fac) //
 
+//------------------------------------------------------------------------------
+///@brief   Set the process identifier that generated the message.              
+//------------------------------------------------------------------------------
+void Message::setPID(int pid)
+{
+    m_PID = int32_t(pid);
+}
+
 //------------------------------------------------------------------------------
 ///@brief   The process identifier that generated the message.                  
 //------------------------------------------------------------------------------
@@ -305,7 +321,8 @@ std::string Message::toString(PARTS part) const
 
     std::string spaces(80, ' ');
 
-    IF (TIME_STAMP, timeStamp().toString());
+    lib::time::work::DateTimeFormatter time_stamp;
+    IF (TIME_STAMP, time_stamp.toString(timeStamp()));
     IF (PID, lib::format("%04" PRIx32, m_PID));
     IF (MNEMONIC, (applicationMnemonic() + spaces).substr(0,20));
 
@@ -451,6 +468,13 @@ Messages::Messages(const Messages& msgs)
 {
 }
 
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+Messages::~Messages()
+{
+}
+
 //------------------------------------------------------------------------------
 ///@brief                                                                       
 //------------------------------------------------------------------------------
@@ -29,6 +29,12 @@ namespace work {
 ///         Note that the static method application mnemonic is not thread-safe,
 ///         but it should only be called once per application instance anyway.  
 ///                                                                             
+///@version 2026-10-16  DHF     Messages' push_back, clear and find are         
+///                             virtual (for IndexedMessages).                  
+///                                                                             
+///@version 2026-10-16  DHF     Added setPID (for messages read back from a     
+///                             file).                                          
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -121,6 +127,7 @@ class Message
 
         std::string toString(PARTS part = ALL) const;
 
+        void setPID(int pid);
         int pid() const;
 
         bool worseThan(ds::level_t level) const;
@@ -155,10 +162,11 @@ class Messages : public std::vector<ConstMessagePtr>
     public:
         Messages();
         Messages(const Messages& msgs);
+        virtual ~Messages();
 
-        void push_back(ConstMessagePtr msg);
-        void push_back(const Messages& msg);
-        void clear();
+        virtual void push_back(ConstMessagePtr msg);
+        virtual void push_back(const Messages& msg);
+        virtual void clear();
 
         inline void operator()(ConstMessagePtr msg) { push_back(msg); }
         inline void operator()(const Messages& msg) { push_back(msg); }
@@ -167,8 +175,8 @@ class Messages : public std::vector<ConstMessagePtr>
         bool worseThan(ds::level_t level) const;
         bool asBadOrWorseThan(ds::level_t level) const;
 
-        int find(ds::messageid_t mesasgeid);
-        int find(
+        virtual int find(ds::messageid_t mesasgeid);
+        virtual int find(
             lib::log::ds::class_t   classid
           , ds::messageid_t         mesasgeid
         );
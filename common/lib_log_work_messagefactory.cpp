@@ -5,6 +5,8 @@
 ///                                                                             
 ///@brief   Factory for generating Messages with defaults set.                  
 ///                                                                             
+///@version 2026-10-16  DHF     Added the thresholds.                           
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2014-10-02  DHF     lib::DateTime moved to lib::time::work::DateTime
@@ -20,10 +22,36 @@
 #include "lib_string.h"
 #include "lib_work_version.h"
 
+#include <bitset>
+#include <boost/thread/mutex.hpp>
+
 namespace lib {
 namespace log {
 namespace work {
 
+std::atomic<uint8_t> MessageFactory::s_Quieter[0x10000];
+
+//------------------------------------------------------------------------------
+//  The global threshold and the classes with one of their own (guarded by      
+//  mutex()).                                                                   
+//------------------------------------------------------------------------------
+static ds::level_t              s_Threshold(ds::LEVEL_MAX);
+static std::bitset<0x10000>     s_HasThreshold;
+
+static boost::mutex& mutex()
+{
+    static boost::mutex result;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+///@brief   A threshold clamped to SILENT .. LEVEL_MAX.                         
+//------------------------------------------------------------------------------
+static ds::level_t clamp(ds::level_t threshold)
+{
+    return threshold > ds::LEVEL_MAX ? ds::LEVEL_MAX : threshold;
+}
+
 //------------------------------------------------------------------------------
 ///@brief   Construct the message factory.                                      
 //------------------------------------------------------------------------------
@@ -127,6 +155,72 @@ ConstMessagePtr MessageFactory::message(
 
 }
 
+//------------------------------------------------------------------------------
+///@brief   Set the threshold of the classes without one of their own.          
+///@param   threshold   The least severe level produced (SILENT for none).      
+//------------------------------------------------------------------------------
+void MessageFactory::setThreshold(ds::level_t threshold)
+{
+    boost::mutex::scoped_lock lock(mutex());
+    s_Threshold = clamp(threshold);
+    refresh();
+
+}
+
+//------------------------------------------------------------------------------
+///@brief   The threshold of the classes without one of their own.              
+//------------------------------------------------------------------------------
+ds::level_t MessageFactory::threshold()
+{
+    boost::mutex::scoped_lock lock(mutex());
+    return s_Threshold;
+
+}
+
+//------------------------------------------------------------------------------
+///@brief   Give the class a threshold of its own (instead of the global one).  
+//------------------------------------------------------------------------------
+void MessageFactory::setThreshold(ds::class_t classid, ds::level_t threshold)
+{
+    boost::mutex::scoped_lock lock(mutex());
+    s_HasThreshold.set(classid);
+    s_Quieter[classid] = ds::LEVEL_MAX - clamp(threshold);
+
+}
+
+//------------------------------------------------------------------------------
+///@brief   Return the class to the global threshold.                           
+//------------------------------------------------------------------------------
+void MessageFactory::clearThreshold(ds::class_t classid)
+{
+    boost::mutex::scoped_lock lock(mutex());
+    s_HasThreshold.reset(classid);
+    s_Quieter[classid] = ds::LEVEL_MAX - s_Threshold;
+
+}
+
+//------------------------------------------------------------------------------
+///@brief   The threshold the class's messages are held to.                     
+//------------------------------------------------------------------------------
+ds::level_t MessageFactory::threshold(ds::class_t classid)
+{
+    return ds::level_t(ds::LEVEL_MAX - s_Quieter[classid].load());
+
+}
+
+//------------------------------------------------------------------------------
+///@brief   Carry the global threshold to every class without one of its own.   
+///@note    Call with mutex() locked.                                           
+//------------------------------------------------------------------------------
+void MessageFactory::refresh()
+{
+    const uint8_t quieter(ds::LEVEL_MAX - s_Threshold);
+    for (size_t c = 0; c < s_HasThreshold.size(); ++c) {
+        if (!s_HasThreshold[c]) s_Quieter[c] = quieter;
+    }
+
+}
+
 //------------------------------------------------------------------------------
 ///@brief   Generated a standard application started message.                   
 //------------------------------------------------------------------------------
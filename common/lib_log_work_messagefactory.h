@@ -9,7 +9,12 @@
 #include "lib_time_work_datetime.h"
 #include "lib_log_ds.h"
 #include "lib_log_work_message.h"
+#include "lib_string.h"
+
+#include <atomic>
+#include <stdint.h>
 #include <stdlib.h>                 // EXIT_SUCCESS 
+#include <type_traits>
 
 namespace lib {
 namespace log {
@@ -22,6 +27,21 @@ namespace work {
 ///@brief   Factory for generating lib::log::Messages with defaults set.        
 ///                                                                             
 ///@par Thread Safety:  object                                                  
+///         The thresholds are the process's; set them from any thread.         
+///                                                                             
+///@par Thresholds                                                              
+///         A message above the threshold of its class (or, for a class with    
+///         none, the global threshold) is suppressed.  Both start at           
+///         LEVEL_MAX:  everything is produced.  isEnabled() is inline, one     
+///         load and one compare.                                               
+///                                                                             
+///@par Lazy Messages                                                           
+///         message(), debug(), verbose() and informational() also take the     
+///         text as a callable returning it, or as a printf format and its      
+///         arguments (a std::string argument is passed as its c_str()).        
+///         These return a null ConstMessagePtr without calling the callable,   
+///         formatting, allocating or reading the clock when the level is       
+///         suppressed.  The std::string forms always produce the message.      
 ///                                                                             
 ///@note    In the initial implementation the factory is going to produce       
 ///         ConstMessagePtr.  If we find that unworkable, chagne it.            
@@ -45,8 +65,23 @@ namespace work {
 ///             }                                                               
 ///         @endcode                                                            
 ///                                                                             
+///         Lazily:                                                             
+///         @code                                                               
+///             if (ConstMessagePtr m = factory.debug(MSG_ID_ROW, [&] {         
+///                     return "row " + row.toString();                         
+///                 })) {                                                       
+///                 publish(m);                                                 
+///             }                                                               
+///             ...                                                             
+///             if (ConstMessagePtr m = factory.debug(MSG_ID_ROW, "row %d", n)) 
+///                 publish(m);                                                 
+///         @endcode                                                            
+///                                                                             
 ///@author  David H. Flatman        DHF     davidflatman@email.com              
 ///                                                                             
+///@version 2026-10-16  DHF     Added thresholds and lazy (callable and         
+///                             format) messages.                               
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2014-10-02  DHF     lib::DateTime moved to lib::time::work::DateTime
@@ -110,6 +145,69 @@ class MessageFactory
           , const std::string& msg
         ) const;
 
+        //----------------------------------------------------------------------
+        //  Thresholds                                                          
+        //----------------------------------------------------------------------
+        static void setThreshold(ds::level_t threshold);
+        static ds::level_t threshold();
+
+        static void setThreshold(ds::class_t classid, ds::level_t threshold);
+        static void clearThreshold(ds::class_t classid);
+        static ds::level_t threshold(ds::class_t classid);
+
+        //----------------------------------------------------------------------
+        ///@brief   Would a message of this level (from this factory's class)   
+        ///         pass the threshold?                                         
+        //----------------------------------------------------------------------
+        bool isEnabled(ds::level_t level) const
+        {
+            return unsigned(level)
+                 + s_Quieter[m_ClassID].load(std::memory_order_relaxed)
+                <= unsigned(ds::LEVEL_MAX);
+        }
+
+        //----------------------------------------------------------------------
+        //  Lazy messages:  null if the level is suppressed.                    
+        //----------------------------------------------------------------------
+        template <typename MAKE>
+        auto message(ds::level_t level, ds::messageid_t id, MAKE make) const
+            -> typename std::enable_if<
+                   std::is_convertible<decltype(make()), std::string>::value
+                 , ConstMessagePtr
+               >::type
+        {
+            if (!isEnabled(level)) return ConstMessagePtr();
+            return message(level, id, std::string(make()));
+        }
+
+        template <typename ARG, typename... ARGS>
+        ConstMessagePtr message(
+            ds::level_t level
+          , ds::messageid_t id
+          , const char* format
+          , const ARG& arg
+          , const ARGS&... args
+        ) const
+        {
+            if (!isEnabled(level)) return ConstMessagePtr();
+            return message(
+                level, id, lib::format(format, vararg(arg), vararg(args)...)
+            );
+        }
+
+        template <typename... LAZY>
+        ConstMessagePtr debug(ds::messageid_t id, const LAZY&... lazy) const
+            { return message(ds::DEBUG_LEVEL_1, id, lazy...); }
+        template <typename... LAZY>
+        ConstMessagePtr verbose(ds::messageid_t id, const LAZY&... lazy) const
+            { return message(ds::VERBOSE, id, lazy...); }
+        template <typename... LAZY>
+        ConstMessagePtr informational(
+            ds::messageid_t id
+          , const LAZY&... lazy
+        ) const
+            { return message(ds::INFORMATIONAL, id, lazy...); }
+
         //----------------------------------------------------------------------
         //  Standard messages                                                   
         //----------------------------------------------------------------------
@@ -171,8 +269,20 @@ class MessageFactory
         //  design.                                                             
         //----------------------------------------------------------------------
 
+        static const char* vararg(const std::string& arg) {return arg.c_str();}
+        template <typename ARG>
+        static const ARG& vararg(const ARG& arg) { return arg; }
+
+        static void refresh();
+
         lib::log::ds::class_t m_ClassID;
 
+        //----------------------------------------------------------------------
+        //  Per class, LEVEL_MAX less the class's threshold (so the zero each   
+        //  starts as lets everything through).                                 
+        //----------------------------------------------------------------------
+        static std::atomic<uint8_t> s_Quieter[0x10000];
+
 }; // class MessageFactory //
 
 } // namespace work 
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_messagefactorytest.cpp                                    
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_log_work_messagefactorytest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_log_work_messagefactory.h"
+
+#include <stdlib.h>
+#include <string>
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::log::work::test::MessageFactoryTest);
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+MessageFactoryTest::MessageFactoryTest()
+    : Test("lib::log::work::MessageFactory")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    MessageFactoryTest object to copy.                          
+//------------------------------------------------------------------------------
+MessageFactoryTest::MessageFactoryTest(const MessageFactoryTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+MessageFactoryTest::~MessageFactoryTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+/// @param  that    The MessageFactoryTest object to copy.                      
+//------------------------------------------------------------------------------
+MessageFactoryTest& MessageFactoryTest::operator=(
+    const MessageFactoryTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // MessageFactoryTest::operator=(const MessageFactoryTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Test the eager and lazy messages against the global and per class    
+///        thresholds.                                                          
+//------------------------------------------------------------------------------
+void MessageFactoryTest::runTest()
+{
+    const MessageFactory main(ds::MAIN);
+    const MessageFactory other(ds::LIB_MP_THREADINFO);
+
+    int made(0);
+    auto make = [&made] { ++made; return std::string("made"); };
+
+    //--------------------------------------------------------------------------
+    //  By default everything is produced.                                      
+    //--------------------------------------------------------------------------
+    TEST_IS_EQUAL(MessageFactory::threshold(), ds::LEVEL_MAX);
+    TEST_IS_EQUAL(MessageFactory::threshold(ds::MAIN), ds::LEVEL_MAX);
+    TEST(main.isEnabled(ds::DEBUG_LEVEL_1));
+
+    ConstMessagePtr m(main.debug(1, make));
+    TEST(m.get() != nullptr);
+    TEST_IS_EQUAL(made, 1);
+    if (m) {
+        TEST_IS_EQUAL(m->message(), "made");
+        TEST_IS_EQUAL(m->severityLevel(), ds::DEBUG_LEVEL_1);
+        TEST_IS_EQUAL(m->classID(), ds::MAIN);
+        TEST_IS_EQUAL(m->messageID(), 1);
+    }
+
+    m = main.verbose(2, "row %d of %s", 5, std::string("file.txt"));
+    TEST(m.get() != nullptr);
+    if (m) {
+        TEST_IS_EQUAL(m->message(), "row 5 of file.txt");
+        TEST_IS_EQUAL(m->severityLevel(), ds::VERBOSE);
+    }
+
+    m = main.informational(3, [] { return "const char*"; });
+    TEST(m.get() != nullptr);
+    if (m) TEST_IS_EQUAL(m->message(), "const char*");
+
+    //--------------------------------------------------------------------------
+    //  Above the global threshold:  null, and nothing made.                    
+    //--------------------------------------------------------------------------
+    MessageFactory::setThreshold(ds::WARNING);
+    TEST_IS_EQUAL(MessageFactory::threshold(), ds::WARNING);
+    TEST_IS_EQUAL(MessageFactory::threshold(ds::MAIN), ds::WARNING);
+
+    TEST(!main.isEnabled(ds::INFORMATIONAL));
+    TEST(main.isEnabled(ds::WARNING));
+    TEST(main.isEnabled(ds::FATAL));
+
+    made = 0;
+    TEST(main.debug(1, make).get() == nullptr);
+    TEST(main.verbose(2, "%d", 7).get() == nullptr);
+    TEST(main.message(ds::INFORMATIONAL, 3, make).get() == nullptr);
+    TEST(main.message(ds::WARNING, 4, make).get() != nullptr);
+    TEST_IS_EQUAL(made, 1);
+
+    //--------------------------------------------------------------------------
+    //  The std::string forms are not gated.                                    
+    //--------------------------------------------------------------------------
+    TEST(main.debug(1, std::string("eager")).get() != nullptr);
+    TEST(main.debug(1, "eager").get() != nullptr);
+
+    //--------------------------------------------------------------------------
+    //  A class threshold of its own wins over the global one.                  
+    //--------------------------------------------------------------------------
+    MessageFactory::setThreshold(ds::MAIN, ds::DEBUG_LEVEL_1);
+    TEST_IS_EQUAL(MessageFactory::threshold(ds::MAIN), ds::DEBUG_LEVEL_1);
+    TEST(main.isEnabled(ds::DEBUG_LEVEL_1));
+    TEST(!other.isEnabled(ds::INFORMATIONAL));
+
+    MessageFactory::setThreshold(ds::CRITICAL);
+    TEST_IS_EQUAL(MessageFactory::threshold(ds::MAIN), ds::DEBUG_LEVEL_1);
+    TEST(!other.isEnabled(ds::WARNING));
+    TEST(other.isEnabled(ds::CRITICAL));
+
+    MessageFactory::clearThreshold(ds::MAIN);
+    TEST_IS_EQUAL(MessageFactory::threshold(ds::MAIN), ds::CRITICAL);
+    TEST(!main.isEnabled(ds::WARNING));
+
+    //--------------------------------------------------------------------------
+    //  SILENT lets nothing through; a threshold past LEVEL_MAX is LEVEL_MAX.   
+    //--------------------------------------------------------------------------
+    MessageFactory::setThreshold(ds::SILENT);
+    TEST(!main.isEnabled(ds::FATAL));
+
+    MessageFactory::setThreshold(ds::UNDEFINED);
+    TEST_IS_EQUAL(MessageFactory::threshold(), ds::LEVEL_MAX);
+    TEST(main.isEnabled(ds::DEBUG_LEVEL_1));
+    TEST(!main.isEnabled(ds::UNDEFINED));
+
+} // void MessageFactoryTest::runTest() //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
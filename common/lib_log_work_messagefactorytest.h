@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+///@file lib_log_work_messagefactorytest.h                                      
+//------------------------------------------------------------------------------
+#ifndef LIB_LOG_WORK_MESSAGEFACTORYTEST_H
+#define LIB_LOG_WORK_MESSAGEFACTORYTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace log {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: MessageFactoryTest                                               
+///                                                                             
+///@par Purpose:                                                                
+///         The MessageFactoryTest class provides the regression test for       
+///         the lib::log::work::MessageFactory class.                           
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class MessageFactoryTest : public dev::test::work::Test {
+    public:
+        MessageFactoryTest();
+        MessageFactoryTest(const MessageFactoryTest& that);
+        virtual ~MessageFactoryTest();
+        MessageFactoryTest& operator=(const MessageFactoryTest& that);
+
+    protected:
+        void runTest();
+
+    private:
+
+}; //  class MessageFactoryTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace log
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_LOG_WORK_MESSAGEFACTORYTEST_H //
@@ -6,11 +6,14 @@
 #ifndef LIB_MP_QUEUE_H
 #define LIB_MP_QUEUE_H
 
+#include "lib_mp_work_queuestats.h"
+
 #include <boost/shared_ptr.hpp>
 #include <boost/thread/condition.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
 #include <deque>
+#include <vector>
 
 namespace lib {
 namespace mp {
@@ -36,6 +39,17 @@ namespace work {
 ///                                                                             
 ///@par Thread Safety:  object                                                  
 ///                                                                             
+///@par Instrumentation                                                         
+///         setStats gives the queue a QueueStats to count in:  items in and    
+///         out, and the time writers waited on the governor and the reader     
+///         waited for data.                                                    
+///                                                                             
+///@version 2026-10-16  DHF     Added setStats.                                 
+///                                                                             
+///@version 2026-10-16  DHF     Added tryPopMany; push can skip the governor.   
+///                                                                             
+///@version 2026-10-16  DHF     Added popMany.                                  
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2019-10-02  DHF     Made maximumSize() constant.                    
@@ -71,6 +85,7 @@ class Queue
             , m_MaximumSize(0)
             , m_Interrupt(false)
             , m_Aborted(false)
+            , m_StatsCounter(nullptr)
         {
         }
 
@@ -84,7 +99,7 @@ class Queue
         ///@param   use_governor True = if the queue would exceed max size, wait
         ///                     False = stuff the data in the queue regardless  
         //----------------------------------------------------------------------
-        void push(TYPE item)
+        void push(TYPE item, bool use_governor = true)
         {
             if (m_Aborted) return;
 
@@ -92,8 +107,14 @@ class Queue
             /// @todo size check?                                               
             //------------------------------------------------------------------
             boost::unique_lock<boost::mutex> lock(m_QueueMutex);
-            if (m_Governor > 0 && m_Governor <= m_Queue.size()) {
+            if (use_governor && m_Governor > 0 && m_Governor <= m_Queue.size()) {
+                const int64_t start(m_StatsCounter ? QueueStats::now() : 0);
                 m_QueueReady.wait(lock);
+                if (m_StatsCounter) {
+                    m_StatsCounter->blockedOnGovernor(
+                        QueueStats::now() - start
+                    );
+                }
                 if (m_Aborted) return;
             }
 
@@ -102,6 +123,7 @@ class Queue
             if (m_Queue.size() > m_MaximumSize) m_MaximumSize = m_Queue.size();
             lock.unlock();
 
+            if (m_StatsCounter) m_StatsCounter->enqueued();
             m_DataReady.notify_one();
         }
 
@@ -121,9 +143,7 @@ class Queue
             if (m_Aborted) return false;
 
             boost::unique_lock<boost::mutex> lock(m_QueueMutex);
-            while (m_Queue.empty() && !m_Interrupt && !m_Aborted) {
-                m_DataReady.wait(lock);
-            }
+            waitForData(lock, true);
 
             if (m_Aborted) return false;
 
@@ -133,11 +153,36 @@ class Queue
                 m_Queue.pop_front();
 
                 m_QueueReady.notify_one();
+                if (m_StatsCounter) m_StatsCounter->dequeued();
             }
 
             return result;
         }
 
+        //----------------------------------------------------------------------
+        ///@brief       Remove (up to) max_items items from the front of the    
+        ///             queue with a single lock.                               
+        ///@warning     Like pop, hangs the calling thread while the queue is   
+        ///             empty until there is something to read or setInterrupt. 
+        ///@param       items       The popped items are appended to this.      
+        ///@param       max_items   The most items to pop (0 = all of them).    
+        ///@return      The number of items appended to items; 0 = an interrupt 
+        ///             was received with an empty queue (or abort).            
+        //----------------------------------------------------------------------
+        size_t popMany(std::vector<TYPE>& items, size_t max_items = 0)
+        {
+            return popItems(items, max_items, true);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief       As popMany, but returns 0 rather than waiting when the  
+        ///             queue is empty.                                         
+        //----------------------------------------------------------------------
+        size_t tryPopMany(std::vector<TYPE>& items, size_t max_items = 0)
+        {
+            return popItems(items, max_items, false);
+        }
+
         //----------------------------------------------------------------------
         ///@brief   Return the number of items currently in the queue (subject  
         ///         to change without notice).                                  
@@ -184,6 +229,18 @@ class Queue
             return m_MaximumSize;
         }
 
+        //----------------------------------------------------------------------
+        ///@brief   Count in stats from now on (null = stop counting).          
+        ///@warning Call before the queue is in use; the readers and writers    
+        ///         do not lock to look at it.                                  
+        //----------------------------------------------------------------------
+        void setStats(const QueueStatsPtr& stats)
+        {
+            m_Stats = stats;
+            m_StatsCounter = stats.get();
+        }
+        const QueueStatsPtr& stats() const { return m_Stats; }
+
         //----------------------------------------------------------------------
         ///@brief   Used when the queue will no longer be used.                 
         //----------------------------------------------------------------------
@@ -206,6 +263,51 @@ class Queue
         Queue& operator=(const Queue& that);
         Queue(const Queue& that);
 
+        //----------------------------------------------------------------------
+        ///@brief   Implement popMany and tryPopMany.                           
+        //----------------------------------------------------------------------
+        size_t popItems(std::vector<TYPE>& items, size_t max_items, bool wait)
+        {
+            if (m_Aborted) return 0;
+
+            boost::unique_lock<boost::mutex> lock(m_QueueMutex);
+            waitForData(lock, wait);
+
+            if (m_Aborted) return 0;
+
+            size_t result(m_Queue.size());
+            if (max_items > 0 && max_items < result) result = max_items;
+
+            for (size_t i = 0; i < result; ++i) {
+                items.push_back(m_Queue.front());
+                m_Queue.pop_front();
+            }
+
+            if (result > 0) {
+                m_QueueReady.notify_all();
+                if (m_StatsCounter) m_StatsCounter->dequeued(result);
+            }
+
+            return result;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Wait (if wait) while the queue is empty, not interrupted    
+        ///         and not aborted; the wait is counted in the stats.          
+        //----------------------------------------------------------------------
+        void waitForData(boost::unique_lock<boost::mutex>& lock, bool wait)
+        {
+            if (!wait || !m_Queue.empty() || m_Interrupt || m_Aborted) return;
+
+            const int64_t start(m_StatsCounter ? QueueStats::now() : 0);
+            while (m_Queue.empty() && !m_Interrupt && !m_Aborted) {
+                m_DataReady.wait(lock);
+            }
+            if (m_StatsCounter) {
+                m_StatsCounter->waitedForData(QueueStats::now() - start);
+            }
+        }
+
         //----------------------------------------------------------------------
         ///@brief The most number of items that the queue should hold.          
         //----------------------------------------------------------------------
@@ -245,6 +347,13 @@ class Queue
         //----------------------------------------------------------------------
         bool m_Aborted;
 
+        //----------------------------------------------------------------------
+        ///@brief   The counters (null = not counting); m_StatsCounter is the   
+        ///         raw pointer the hot paths test.                             
+        //----------------------------------------------------------------------
+        QueueStatsPtr   m_Stats;
+        QueueStats*     m_StatsCounter;
+
 }; // class Queue //
 
 }  // namespace work //
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_queuepolicy.h                                              
+///@brief Holds the compile-time policies for choosing a thread safe queue.     
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_QUEUEPOLICY_H_FILE_GUARD
+#define LIB_MP_WORK_QUEUEPOLICY_H_FILE_GUARD
+
+#include "lib_mp_work_queue.h"
+#include "lib_mp_work_ringqueue.h"
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Queue policy selecting the std::deque + mutex lib::mp::work::Queue. 
+///                                                                             
+///@par Purpose:                                                                
+///         A queue policy is a type with a nested template, queue, that maps   
+///         an item type to the thread safe queue that should hold it.  Users   
+///         of a queue (lib::msg::Subscription, lib::msg::Subscriber) take the  
+///         policy as a template parameter rather than the queue itself so that 
+///         they can instantiate the queue with whatever item type they need.   
+///         @code                                                               
+///             template <typename QUEUE_POLICY>                                
+///             class MyClass                                                   
+///             {                                                               
+///                 typename QUEUE_POLICY::template queue<int> m_Queue;         
+///             };                                                              
+///         @endcode                                                            
+///\n\n                                                                         
+///         The policy also says whether the queue is bounded (can make a       
+///         writer wait even when told to ignore the governor).                 
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     Added bounded.                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+struct DequeQueuePolicy
+{
+    //--------------------------------------------------------------------------
+    ///@brief   False = push(item, false) never waits.                          
+    //--------------------------------------------------------------------------
+    static const bool bounded = false;
+
+    template <typename TYPE>
+    using queue = lib::mp::work::Queue<TYPE>;
+};
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Queue policy selecting the lock-free lib::mp::work::RingQueue.      
+///                                                                             
+///@note    The ring is bounded.  A governor (max size) of zero gets            
+///         RingQueue::DEFAULT_CAPACITY slots rather than unlimited growth.     
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+struct RingQueuePolicy
+{
+    //--------------------------------------------------------------------------
+    ///@brief   True = push(item, false) still waits on a full ring.            
+    //--------------------------------------------------------------------------
+    static const bool bounded = true;
+
+    template <typename TYPE>
+    using queue = lib::mp::work::RingQueue<TYPE>;
+};
+
+} // namespace work //
+} // namespace mp //
+} // namespace lib //
+
+#endif // #ifndef LIB_MP_WORK_QUEUEPOLICY_H_FILE_GUARD
@@ -0,0 +1,294 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_queuestats.cpp                                             
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   The optional counters of a queue, and the registry of them all.     
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_mp_work_queuestats.h"
+#include "lib_string.h"
+#include "lib_time_work_clock.h"
+
+#include <algorithm>
+#include <memory>
+
+#ifdef IS_VISUAL_STUDIO
+    #define LIB_MP_WORK_THREAD_LOCAL __declspec(thread)
+#else
+    #define LIB_MP_WORK_THREAD_LOCAL __thread
+#endif
+
+namespace lib {
+namespace mp {
+namespace work {
+
+const size_t QueueStats::SHARDS;
+
+//------------------------------------------------------------------------------
+//  The calling thread's shard (SHARDS = not dealt yet) and the next to deal.   
+//------------------------------------------------------------------------------
+static LIB_MP_WORK_THREAD_LOCAL size_t s_Shard(QueueStats::SHARDS);
+static std::atomic<size_t> s_NextShard(0);
+
+static std::atomic<bool> s_EnabledByDefault(false);
+
+//------------------------------------------------------------------------------
+//  The registry.                                                               
+//------------------------------------------------------------------------------
+static boost::mutex& registryMutex()
+{
+    static boost::mutex s_Mutex;
+    return s_Mutex;
+}
+
+static std::vector<std::weak_ptr<QueueStats> >& registry()
+{
+    static std::vector<std::weak_ptr<QueueStats> > s_Registry;
+    return s_Registry;
+}
+
+//==============================================================================
+//  QueueStats                                                                  
+//==============================================================================
+
+//------------------------------------------------------------------------------
+///@param   name    How the queue is known in QueueStatsRegistry::dump.         
+//------------------------------------------------------------------------------
+QueueStats::QueueStats(const std::string& name)
+    : m_Name(name)
+{
+    clear();
+
+} // QueueStats::QueueStats(const std::string& name) //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+QueueStats::~QueueStats()
+{
+
+} // QueueStats::~QueueStats() //
+
+//------------------------------------------------------------------------------
+///@brief   Change how the queue is known.                                      
+//------------------------------------------------------------------------------
+void QueueStats::setName(const std::string& name)
+{
+    boost::mutex::scoped_lock lock(m_Mutex);
+    m_Name = name;
+
+} // void QueueStats::setName(const std::string& name) //
+
+//------------------------------------------------------------------------------
+///@brief   Return how the queue is known.                                      
+//------------------------------------------------------------------------------
+std::string QueueStats::name() const
+{
+    boost::mutex::scoped_lock lock(m_Mutex);
+    return m_Name;
+
+} // std::string QueueStats::name() const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the counters summed over the shards.                         
+//------------------------------------------------------------------------------
+QueueStats::Snapshot QueueStats::snapshot() const
+{
+    Snapshot result;
+    result.name = name();
+    result.enqueued = 0;
+    result.dequeued = 0;
+    result.governorWaits = 0;
+    result.governorNanoSeconds = 0;
+    result.dataWaits = 0;
+    result.dataNanoSeconds = 0;
+
+    for (size_t s = 0; s < SHARDS; ++s) {
+        const Shard& shard(m_Shards[s]);
+        result.enqueued += shard.m_Enqueued.load(std::memory_order_relaxed);
+        result.dequeued += shard.m_Dequeued.load(std::memory_order_relaxed);
+        result.governorWaits
+            += shard.m_GovernorWaits.load(std::memory_order_relaxed);
+        result.governorNanoSeconds
+            += shard.m_GovernorNanoSeconds.load(std::memory_order_relaxed);
+        result.dataWaits += shard.m_DataWaits.load(std::memory_order_relaxed);
+        result.dataNanoSeconds
+            += shard.m_DataNanoSeconds.load(std::memory_order_relaxed);
+    }
+    result.residence = m_Residence;
+
+    return result;
+
+} // QueueStats::Snapshot QueueStats::snapshot() const //
+
+//------------------------------------------------------------------------------
+///@brief   Zero the counters.                                                  
+//------------------------------------------------------------------------------
+void QueueStats::clear()
+{
+    for (size_t s = 0; s < SHARDS; ++s) {
+        Shard& shard(m_Shards[s]);
+        shard.m_Enqueued.store(0);
+        shard.m_Dequeued.store(0);
+        shard.m_GovernorWaits.store(0);
+        shard.m_GovernorNanoSeconds.store(0);
+        shard.m_DataWaits.store(0);
+        shard.m_DataNanoSeconds.store(0);
+    }
+    m_Residence.clear();
+
+} // void QueueStats::clear() //
+
+//------------------------------------------------------------------------------
+///@brief   Return the time the queues measure with (Clock::elapsed(), ns).     
+//------------------------------------------------------------------------------
+int64_t QueueStats::now()
+{
+    return lib::time::work::Clock::elapsed().count();
+
+} // int64_t QueueStats::now() //
+
+//------------------------------------------------------------------------------
+///@brief   Have every Subscriber constructed from now on instrument itself.    
+//------------------------------------------------------------------------------
+void QueueStats::setEnabledByDefault(bool enabled)
+{
+    s_EnabledByDefault.store(enabled);
+
+} // void QueueStats::setEnabledByDefault(bool enabled) //
+
+//------------------------------------------------------------------------------
+///@brief   Return true if new Subscribers instrument themselves.               
+//------------------------------------------------------------------------------
+bool QueueStats::enabledByDefault()
+{
+    return s_EnabledByDefault.load();
+
+} // bool QueueStats::enabledByDefault() //
+
+//------------------------------------------------------------------------------
+///@brief   Return the calling thread's shard, dealing it one if need be.       
+//------------------------------------------------------------------------------
+size_t QueueStats::shardIndex()
+{
+    if (s_Shard == SHARDS) {
+        s_Shard = s_NextShard.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+    }
+    return s_Shard;
+
+} // size_t QueueStats::shardIndex() //
+
+//------------------------------------------------------------------------------
+///@brief   Return a line:  the counts, the waits (ms) and the residence.       
+//------------------------------------------------------------------------------
+std::string QueueStats::Snapshot::toString() const
+{
+    return format(
+        "%-24s in %10llu out %10llu queued %6llu"
+        "  governor %6llu waits %10.3lf ms"
+        "  data %6llu waits %10.3lf ms"
+        "  residence %s"
+      , name.c_str()
+      , (unsigned long long) enqueued
+      , (unsigned long long) dequeued
+      , (unsigned long long) depth()
+      , (unsigned long long) governorWaits
+      , governorNanoSeconds / 1e6
+      , (unsigned long long) dataWaits
+      , dataNanoSeconds / 1e6
+      , residence.toString().c_str()
+    );
+
+} // std::string QueueStats::Snapshot::toString() const //
+
+//==============================================================================
+//  QueueStatsRegistry                                                          
+//==============================================================================
+
+//------------------------------------------------------------------------------
+///@brief   Remember the stats (until they are destroyed).                      
+//------------------------------------------------------------------------------
+void QueueStatsRegistry::add(const QueueStatsPtr& stats)
+{
+    if (!stats) return;
+
+    boost::mutex::scoped_lock lock(registryMutex());
+    std::vector<std::weak_ptr<QueueStats> >& all(registry());
+
+    //--------------------------------------------------------------------------
+    //  Make room from the ones that have gone before growing.                  
+    //--------------------------------------------------------------------------
+    all.erase(
+        std::remove_if(
+            all.begin()
+          , all.end()
+          , [](const std::weak_ptr<QueueStats>& s) { return s.expired(); }
+        )
+      , all.end()
+    );
+    all.push_back(stats);
+
+} // void QueueStatsRegistry::add(const QueueStatsPtr& stats) //
+
+//------------------------------------------------------------------------------
+///@brief   Return a snapshot of each live QueueStats, the longest blocked on   
+///         the governor first.                                                 
+//------------------------------------------------------------------------------
+std::vector<QueueStats::Snapshot> QueueStatsRegistry::snapshots()
+{
+    std::vector<std::shared_ptr<QueueStats> > live;
+    {
+        boost::mutex::scoped_lock lock(registryMutex());
+        std::vector<std::weak_ptr<QueueStats> >& all(registry());
+        for (size_t s = 0; s < all.size(); ++s) {
+            std::shared_ptr<QueueStats> stats(all[s].lock());
+            if (stats) live.push_back(stats);
+        }
+    }
+
+    std::vector<QueueStats::Snapshot> result;
+    result.reserve(live.size());
+    for (size_t s = 0; s < live.size(); ++s) {
+        result.push_back(live[s]->snapshot());
+    }
+
+    std::stable_sort(
+        result.begin()
+      , result.end()
+      , [](const QueueStats::Snapshot& a, const QueueStats::Snapshot& b) {
+            return a.governorNanoSeconds > b.governorNanoSeconds;
+        }
+    );
+
+    return result;
+
+} // std::vector<QueueStats::Snapshot> QueueStatsRegistry::snapshots() //
+
+//------------------------------------------------------------------------------
+///@brief   Write a line per live QueueStats (see snapshots()).                 
+//------------------------------------------------------------------------------
+void QueueStatsRegistry::dump(std::ostream& out)
+{
+    const std::vector<QueueStats::Snapshot> all(snapshots());
+    for (size_t s = 0; s < all.size(); ++s) {
+        out << all[s].toString() << std::endl;
+    }
+
+} // void QueueStatsRegistry::dump(std::ostream& out) //
+
+//------------------------------------------------------------------------------
+///@brief   Forget every QueueStats registered so far.                          
+//------------------------------------------------------------------------------
+void QueueStatsRegistry::clear()
+{
+    boost::mutex::scoped_lock lock(registryMutex());
+    registry().clear();
+
+} // void QueueStatsRegistry::clear() //
+
+} // namespace work
+} // namespace mp
+} // namespace lib
@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_queuestats.h                                               
+///@brief Holds lib::mp::work::QueueStats, the optional counters of a Queue or  
+///       RingQueue, and QueueStatsRegistry, which dumps them all.              
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_QUEUESTATS_H_FILE_GUARD
+#define LIB_MP_WORK_QUEUESTATS_H_FILE_GUARD
+
+#include "lib_ds_hdrhistogram.h"
+#include "lib_ds_shared_ptr.h"
+
+#include <atomic>
+#include <boost/thread/mutex.hpp>
+#include <iostream>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   How much went through a queue, how long its writers were held up    
+///         by the governor, how long its reader waited for data, and how long  
+///         items sat in it.                                                    
+///                                                                             
+///@par Purpose:                                                                
+///         maximumSize() says a queue filled up, not who waited or for how     
+///         long.  A queue whose writers spend their time blocked on the        
+///         governor sits in front of the stage that holds the pipeline back;   
+///         one whose reader spends its time waiting for data sits behind it.   
+///                                                                             
+///@par Counters                                                                
+///         The counters are sharded:  each thread adds to the shard it was     
+///         given the first time it counted anything (threads are dealt out     
+///         round robin over SHARDS cache line sized shards), so a writer and   
+///         a reader never fight over a line.  snapshot() adds the shards up.   
+///                                                                             
+///@par Residence                                                               
+///         The time each item spent queued goes in an HdrHistogram.  The       
+///         queue cannot time its items itself (it holds them as they are);     
+///         lib::msg::Subscriber stamps its entries as they are queued and      
+///         records the time when it takes them out.                            
+///                                                                             
+///@par Turning It On                                                           
+///         A queue counts only once given a QueueStats (Queue::setStats);      
+///         without one, the cost is a test of a null pointer.  Subscriber's    
+///         instrument() does this for its queue, and every Subscriber made     
+///         after setEnabledByDefault(true) instruments itself.                 
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class QueueStats
+{
+    public:
+        static const size_t SHARDS = 8;
+
+        //----------------------------------------------------------------------
+        ///@brief   The counters as they were when snapshot() was called.       
+        //----------------------------------------------------------------------
+        struct Snapshot
+        {
+            std::string             name;
+            uint64_t                enqueued;
+            uint64_t                dequeued;
+            uint64_t                governorWaits;
+            uint64_t                governorNanoSeconds;
+            uint64_t                dataWaits;
+            uint64_t                dataNanoSeconds;
+            lib::ds::HdrHistogram   residence;      ///< ns
+
+            uint64_t depth() const
+                { return enqueued > dequeued ? enqueued - dequeued : 0; }
+            std::string toString() const;
+        };
+
+        explicit QueueStats(const std::string& name = "");
+        virtual ~QueueStats();
+
+        void setName(const std::string& name);
+        std::string name() const;
+
+        //----------------------------------------------------------------------
+        //  Called by the queue (and Subscriber).                               
+        //----------------------------------------------------------------------
+        void enqueued(uint64_t count = 1)
+            { add(shard().m_Enqueued, count); }
+        void dequeued(uint64_t count = 1)
+            { add(shard().m_Dequeued, count); }
+        void blockedOnGovernor(int64_t nano_seconds)
+        {
+            Shard& s(shard());
+            add(s.m_GovernorWaits, 1);
+            add(s.m_GovernorNanoSeconds, uint64_t(nano_seconds));
+        }
+        void waitedForData(int64_t nano_seconds)
+        {
+            Shard& s(shard());
+            add(s.m_DataWaits, 1);
+            add(s.m_DataNanoSeconds, uint64_t(nano_seconds));
+        }
+        void residence(int64_t nano_seconds)
+        {
+            m_Residence.record(nano_seconds < 0 ? 0 : uint64_t(nano_seconds));
+        }
+
+        Snapshot snapshot() const;
+        void clear();
+
+        static int64_t now();
+
+        static void setEnabledByDefault(bool enabled);
+        static bool enabledByDefault();
+
+    private:
+        QueueStats(const QueueStats& that);
+        QueueStats& operator=(const QueueStats& that);
+
+        //----------------------------------------------------------------------
+        //  One thread's (or a few threads') counters, padded to a cache line.  
+        //----------------------------------------------------------------------
+        struct Shard
+        {
+            std::atomic<uint64_t>   m_Enqueued;
+            std::atomic<uint64_t>   m_Dequeued;
+            std::atomic<uint64_t>   m_GovernorWaits;
+            std::atomic<uint64_t>   m_GovernorNanoSeconds;
+            std::atomic<uint64_t>   m_DataWaits;
+            std::atomic<uint64_t>   m_DataNanoSeconds;
+            char                    m_Pad[64 - 6 * sizeof(uint64_t)];
+        };
+
+        static void add(std::atomic<uint64_t>& counter, uint64_t count)
+        {
+            counter.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        Shard& shard() { return m_Shards[shardIndex()]; }
+        static size_t shardIndex();
+
+        Shard                   m_Shards[SHARDS];
+        lib::ds::HdrHistogram   m_Residence;
+
+        mutable boost::mutex    m_Mutex;        ///< m_Name
+        std::string             m_Name;
+
+}; // class QueueStats //
+
+using QueueStatsPtr = lib::ds::shared_ptr<QueueStats>;
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Every QueueStats in the process, for dumping the whole graph.       
+///                                                                             
+///@par Purpose:                                                                
+///         Each instrumented Subscriber adds its QueueStats here; dump()       
+///         writes a line per queue, the one whose writers were blocked longest 
+///         first (the queue in front of the bottleneck).                       
+///                                                                             
+///@note    The registry does not keep a QueueStats alive:  the queues of       
+///         Subscribers that have been destroyed drop out.  Dump before the     
+///         pipeline is torn down.                                              
+///                                                                             
+///@par Thread Safety:  class                                                   
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::mp::work::QueueStats::setEnabledByDefault(true);               
+///         ...     // build and start the pipeline                             
+///         threads.joinAll();                                                  
+///         lib::mp::work::QueueStatsRegistry::dump(std::cerr);                 
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class QueueStatsRegistry
+{
+    public:
+        static void add(const QueueStatsPtr& stats);
+        static std::vector<QueueStats::Snapshot> snapshots();
+        static void dump(std::ostream& out);
+        static void clear();
+
+    private:
+        QueueStatsRegistry();
+
+}; // class QueueStatsRegistry //
+
+} // namespace work
+} // namespace mp
+} // namespace lib
+
+#endif // #ifndef LIB_MP_WORK_QUEUESTATS_H_FILE_GUARD
@@ -0,0 +1,377 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_queuestatstest.cpp                                         
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_mp_work_queuestatstest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_ds_hdrhistogram.h"
+#include "lib_mp_work_queue.h"
+#include "lib_mp_work_queuestats.h"
+#include "lib_mp_work_ringqueue.h"
+#include "lib_mp_work_thread.h"
+#include "lib_mp_work_threadablecollection.h"
+#include "lib_msg_publisher.h"
+#include "lib_msg_subscriber.h"
+#include "lib_time_ds_nanoseconds.h"
+
+#include <sstream>
+#include <string>
+#include <time.h>
+#include <vector>
+
+namespace lib {
+namespace mp {
+namespace work {
+namespace test {
+
+using lib::ds::HdrHistogram;
+using lib::time::ds::NanoSeconds;
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::mp::work::test::QueueStatsTest);
+
+static const int ITEMS = 200;
+
+static void nap(NanoSeconds length)
+{
+    timespec time;
+    length.toTimespec(time);
+    nanosleep(&time, nullptr);
+}
+
+//------------------------------------------------------------------------------
+//  Fill the queue faster than it is emptied.                                   
+//------------------------------------------------------------------------------
+static void produce(Queue<int>* queue)
+{
+    for (int i = 0; i < ITEMS; ++i) queue->push(i);
+}
+
+static void produceRing(RingQueue<int>* queue)
+{
+    for (int i = 0; i < ITEMS; ++i) queue->push(i);
+}
+
+//------------------------------------------------------------------------------
+//  The snapshot of the named stats in the registry (false if not there).       
+//------------------------------------------------------------------------------
+static bool registered(const std::string& name, QueueStats::Snapshot& found)
+{
+    const std::vector<QueueStats::Snapshot> all(
+        QueueStatsRegistry::snapshots()
+    );
+    for (size_t s = 0; s < all.size(); ++s) {
+        if (all[s].name == name) {
+            found = all[s];
+            return true;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+//  A publisher of ITEMS ints, and a subscriber that counts them.               
+//------------------------------------------------------------------------------
+class IntPublisher
+    : public lib::msg::Publisher<int>
+    , public lib::mp::work::Threadable
+{
+    public:
+        void operator()()
+        {
+            for (int i = 0; i < ITEMS; ++i) {
+                lib::ds::shared_ptr<int> p_int(new int(i));
+                publish(p_int);
+            }
+            endPublication();
+        }
+};
+
+class IntCounter : public lib::msg::Subscriber<int>
+{
+    public:
+        IntCounter(const std::string& name)
+            : lib::msg::Subscriber<int>(name, 4)
+            , m_Count(0)
+        { }
+
+        void process(lib::ds::shared_ptr<const int>& i)
+        {
+            if (i) ++m_Count;
+        }
+
+        int m_Count;
+};
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+QueueStatsTest::QueueStatsTest()
+    : Test("lib::mp::work::QueueStats")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    QueueStatsTest object to copy.                              
+//------------------------------------------------------------------------------
+QueueStatsTest::QueueStatsTest(const QueueStatsTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+QueueStatsTest::~QueueStatsTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+/// @param  that    The QueueStatsTest object to copy.                          
+//------------------------------------------------------------------------------
+QueueStatsTest& QueueStatsTest::operator=(const QueueStatsTest& that)
+{
+    Test::operator=(that);
+    return *this;
+} // QueueStatsTest::operator=(const QueueStatsTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Test the histogram, both queues counting, an instrumented            
+///        Subscriber and the registry.                                         
+//------------------------------------------------------------------------------
+void QueueStatsTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  HdrHistogram:  the buckets tile the values, and a percentile is within  
+    //  1 / SUB_BUCKETS of the value.                                           
+    //--------------------------------------------------------------------------
+    {
+        TEST_IS_EQUAL(HdrHistogram::bucket(0), 0);
+        TEST_IS_EQUAL(HdrHistogram::bucket(15), 15);
+        TEST_IS_EQUAL(HdrHistogram::bucket(16), 16);
+        TEST_IS_EQUAL(
+            HdrHistogram::bucket(HdrHistogram::MAXIMUM)
+          , HdrHistogram::BUCKETS - 1
+        );
+        TEST_IS_EQUAL(
+            HdrHistogram::bucket(HdrHistogram::MAXIMUM * 4)
+          , HdrHistogram::BUCKETS - 1
+        );
+
+        bool tiled(true);
+        for (size_t b = 1; b < HdrHistogram::BUCKETS; ++b) {
+            if (HdrHistogram::lowest(b) != HdrHistogram::highest(b - 1) + 1
+             || HdrHistogram::bucket(HdrHistogram::lowest(b)) != b
+             || HdrHistogram::bucket(HdrHistogram::highest(b)) != b
+            ) {
+                tiled = false;
+            }
+        }
+        TEST(tiled);
+        TEST_IS_EQUAL(
+            HdrHistogram::highest(HdrHistogram::BUCKETS - 1)
+          , HdrHistogram::MAXIMUM
+        );
+
+        HdrHistogram latency;
+        TEST_IS_EQUAL(latency.count(), 0);
+        TEST_IS_EQUAL(latency.valueAtPercentile(50), 0);
+
+        for (uint64_t v = 1; v <= 1000; ++v) latency.record(v * 1000);
+        TEST_IS_EQUAL(latency.count(), 1000);
+        TEST_IS_EQUAL(latency.maximum(), 1000000);
+        TEST_IS_EQUAL(latency.mean(), 500500);
+
+        const uint64_t median(latency.valueAtPercentile(50));
+        TEST(median >= 500000);
+        TEST(median <= 500000 + 500000 / HdrHistogram::SUB_BUCKETS);
+
+        const uint64_t p99(latency.valueAtPercentile(99));
+        TEST(p99 >= 990000);
+        TEST(p99 <= 990000 + 990000 / HdrHistogram::SUB_BUCKETS);
+        TEST_IS_EQUAL(latency.valueAtPercentile(100), 1000000);
+
+        HdrHistogram copy(latency);
+        copy.record(7, 10);
+        TEST_IS_EQUAL(copy.count(), 1010);
+        TEST_IS_EQUAL(copy.valueAtPercentile(0.5), 7);
+
+        latency.add(copy);
+        TEST_IS_EQUAL(latency.count(), 2010);
+
+        latency.clear();
+        TEST_IS_EQUAL(latency.count(), 0);
+        TEST_IS_EQUAL(latency.maximum(), 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Queue:  a writer held by a governor of 1 waits on it; every item in     
+    //  is counted out.                                                         
+    //--------------------------------------------------------------------------
+    {
+        QueueStatsPtr stats;
+        lib::new_shared(stats, "queue");
+
+        Queue<int> queue(1);
+        queue.setStats(stats);
+        TEST(queue.stats() == stats);
+
+        Thread producer("queue stats producer", produce, &queue);
+        int item(0);
+        for (int i = 0; i < ITEMS; ++i) {
+            if (i % 50 == 0) nap(NanoSeconds::fromMilliSeconds(2));
+            queue.pop(item);
+        }
+        producer.join();
+
+        const QueueStats::Snapshot snapshot(stats->snapshot());
+        TEST_IS_EQUAL(snapshot.name, "queue");
+        TEST_IS_EQUAL(snapshot.enqueued, ITEMS);
+        TEST_IS_EQUAL(snapshot.dequeued, ITEMS);
+        TEST_IS_EQUAL(snapshot.depth(), 0);
+        TEST(snapshot.governorWaits > 0);
+        TEST(snapshot.governorNanoSeconds > 0);
+
+        //----------------------------------------------------------------------
+        //  tryPopMany counts what it took; no stats, no counting.              
+        //----------------------------------------------------------------------
+        stats->clear();
+        queue.push(1);
+        queue.push(2, false);
+        std::vector<int> items;
+        const size_t popped(queue.tryPopMany(items, 10));
+        TEST_IS_EQUAL(popped, 2);
+        TEST_IS_EQUAL(stats->snapshot().dequeued, 2);
+
+        queue.setStats(QueueStatsPtr());
+        queue.push(3);
+        queue.pop(item);
+        TEST_IS_EQUAL(stats->snapshot().enqueued, 2);
+    }
+
+    //--------------------------------------------------------------------------
+    //  RingQueue:  the same, through a ring of 2.                              
+    //--------------------------------------------------------------------------
+    {
+        QueueStatsPtr stats;
+        lib::new_shared(stats, "ring");
+
+        RingQueue<int> queue(2);
+        queue.setStats(stats);
+
+        Thread producer("ring stats producer", produceRing, &queue);
+        int item(0);
+        std::vector<int> items;
+        int taken(0);
+        while (taken < ITEMS) {
+            if (taken % 50 == 0) nap(NanoSeconds::fromMilliSeconds(2));
+            if (taken % 2 == 0) {
+                queue.pop(item);
+                ++taken;
+            } else {
+                items.clear();
+                taken += int(queue.popMany(items, 2));
+            }
+        }
+        producer.join();
+
+        const QueueStats::Snapshot snapshot(stats->snapshot());
+        TEST_IS_EQUAL(snapshot.enqueued, ITEMS);
+        TEST_IS_EQUAL(snapshot.dequeued, ITEMS);
+        TEST(snapshot.governorWaits > 0);
+
+        //----------------------------------------------------------------------
+        //  A reader that finds the ring empty waits for data.                  
+        //----------------------------------------------------------------------
+        stats->clear();
+        Thread late("ring stats producer", produceRing, &queue);
+        for (int i = 0; i < ITEMS; ++i) queue.pop(item);
+        late.join();
+
+        const QueueStats::Snapshot waited(stats->snapshot());
+        TEST_IS_EQUAL(waited.dequeued, ITEMS);
+        TEST(waited.dataWaits > 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  An instrumented Subscriber records every entry's residence, and the     
+    //  registry lists it.                                                      
+    //--------------------------------------------------------------------------
+    {
+        ThreadableCollection threads;
+
+        lib::ds::shared_ptr<IntPublisher> publisher;
+        lib::new_shared(publisher);
+
+        lib::ds::shared_ptr<IntCounter> counter;
+        lib::new_shared(counter, "queue stats counter");
+        TEST(!counter->stats());
+
+        QueueStatsPtr stats(counter->instrument());
+        TEST(counter->stats() == stats);
+        TEST_IS_EQUAL(stats->name(), "queue stats counter");
+
+        publisher >> counter;
+        threads.push_back(publisher);
+        threads.push_back(counter);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST_IS_EQUAL(counter->m_Count, ITEMS);
+
+        const QueueStats::Snapshot snapshot(stats->snapshot());
+        TEST_IS_EQUAL(snapshot.enqueued, ITEMS);
+        TEST_IS_EQUAL(snapshot.dequeued, ITEMS);
+        TEST_IS_EQUAL(snapshot.residence.count(), ITEMS);
+
+        QueueStats::Snapshot found;
+        TEST(registered("queue stats counter", found));
+        TEST_IS_EQUAL(found.enqueued, ITEMS);
+
+        std::ostringstream dump;
+        QueueStatsRegistry::dump(dump);
+        TEST(dump.str().find("queue stats counter") != std::string::npos);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Enabled by default:  a new Subscriber instruments itself; once it is    
+    //  gone, it drops out of the registry.                                     
+    //--------------------------------------------------------------------------
+    {
+        QueueStats::setEnabledByDefault(true);
+        {
+            IntCounter counter("queue stats default");
+            TEST(counter.stats());
+
+            QueueStats::Snapshot found;
+            TEST(registered("queue stats default", found));
+        }
+        QueueStats::setEnabledByDefault(false);
+
+        QueueStats::Snapshot found;
+        TEST(!registered("queue stats default", found));
+        TEST(!registered("queue stats counter", found));
+
+        IntCounter counter("queue stats off");
+        TEST(!counter.stats());
+    }
+
+} // void QueueStatsTest::runTest() //
+
+} // namespace test
+} // namespace work
+} // namespace mp
+} // namespace lib
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_queuestatstest.h                                           
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_QUEUESTATSTEST_H
+#define LIB_MP_WORK_QUEUESTATSTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace mp {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: QueueStatsTest                                                   
+///                                                                             
+///@par Purpose:                                                                
+///         The QueueStatsTest class provides the regression test for           
+///         the lib::mp::work::QueueStats, lib::mp::work::QueueStatsRegistry and
+///         lib::ds::HdrHistogram classes.                                      
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class QueueStatsTest : public dev::test::work::Test {
+    public:
+        QueueStatsTest();
+        QueueStatsTest(const QueueStatsTest& that);
+        virtual ~QueueStatsTest();
+        QueueStatsTest& operator=(const QueueStatsTest& that);
+
+    protected:
+        void runTest();
+
+    private:
+
+}; //  class QueueStatsTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace mp
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_MP_WORK_QUEUESTATSTEST_H //
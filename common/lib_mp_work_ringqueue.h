@@ -0,0 +1,631 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_ringqueue.h                                                
+///@brief Holds the definition of the lock-free lib::mp::work::RingQueue.       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_RINGQUEUE_H_FILE_GUARD
+#define LIB_MP_WORK_RINGQUEUE_H_FILE_GUARD
+
+#include "lib_compiler_info.h"
+#include "lib_mp_work_queuestats.h"
+
+#include <atomic>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#if defined(IS_VISUAL_STUDIO)
+    #include <intrin.h>
+#endif
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   A bounded, lock-free, thread safe queue.                            
+///                                                                             
+///@par Template: RingQueue                                                     
+///                                                                             
+///@par Purpose:                                                                
+///         The RingQueue is a drop-in replacement for lib::mp::work::Queue for 
+///         the hot paths of a publisher / subscriber chain.  The call          
+///         signatures (push, pop, setInterrupt, abort, governor, ...) match    
+///         those of Queue so that the two can be swapped via a queue policy    
+///         (see lib_mp_work_queuepolicy.h).                                    
+///\n\n                                                                         
+///         Queue takes a mutex and signals a condition variable on every push  
+///         and pop.  The RingQueue only touches its mutex when one side has    
+///         run out of things to do (empty for the reader, full for a writer)   
+///         and has spun long enough that it is better to go to sleep.          
+///                                                                             
+///@par Design Note:  Multiple Writers                                          
+///         The ring is the bounded multi-producer / multi-consumer array queue 
+///         described by Dmitry Vyukov.  Each slot carries a sequence number    
+///         that tells a writer (or reader) whether the slot is its turn.  A    
+///         Subscriber has one reader thread, but may have several publishers   
+///         pushing into it, so multiple writers are a requirement.             
+///                                                                             
+///@par Design Note:  Capacity and Governor                                     
+///         Unlike Queue, the RingQueue cannot grow.  The capacity is the       
+///         governor rounded up to a power of two (so that the index wrap is a  
+///         mask rather than a divide).  A governor of 0 -- unlimited in Queue  
+///         terms -- gets DEFAULT_CAPACITY slots.  A push into a full ring      
+///         waits for the reader, exactly as a governed Queue does.             
+///\n\n                                                                         
+///         setGovernor may lower the effective limit below the capacity; it    
+///         cannot raise it above the capacity chosen at construction.          
+///                                                                             
+///@par Design Note:  False Sharing                                             
+///         The writer index, reader index and the sleeping counters are each   
+///         padded out to their own cache line.  Padding is used rather than    
+///         alignas so that the class may be heap allocated under C++11.        
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Instrumentation                                                         
+///         As for Queue (setStats).  A wait is timed from the first look that  
+///         found the ring full (empty), so the spinning counts too.            
+///                                                                             
+///@version 2026-10-16  DHF     Added setStats.                                 
+///                                                                             
+///@version 2026-10-16  DHF     Added popMany, tryPopMany; push can skip the    
+///                             governor.                                       
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+template <typename TYPE>
+class RingQueue
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   Number of slots used when no governor is given.             
+        //----------------------------------------------------------------------
+        static const size_t DEFAULT_CAPACITY = 1024;
+
+        //----------------------------------------------------------------------
+        ///@brief   Number of times a blocked reader or writer re-checks the    
+        ///         ring before going to sleep on the condition variable.       
+        //----------------------------------------------------------------------
+        static const int SPIN_COUNT = 128;
+
+        //----------------------------------------------------------------------
+        ///@param max_size  Control the maximum size of the queue.  If the queue
+        ///                 is at the maximum size and an attempt to add to it  
+        ///                 occurs, the adding thread will hang until something 
+        ///                 is removed from the queue.  0 = DEFAULT_CAPACITY.   
+        //----------------------------------------------------------------------
+        RingQueue(size_t max_size = 0)
+            : m_Capacity(roundUpToPowerOfTwo(max_size))
+            , m_Mask(m_Capacity - 1)
+            , m_Cells(m_Capacity)
+            , m_Governor(max_size)
+            , m_MaximumSize(0)
+            , m_Interrupt(false)
+            , m_Aborted(false)
+            , m_StatsCounter(nullptr)
+        {
+            m_Head = 0;
+            m_Tail = 0;
+            m_SleepingReaders = 0;
+            m_SleepingWriters = 0;
+
+            for (size_t i = 0; i < m_Capacity; ++i) {
+                m_Cells[i].m_Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        //----------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        virtual ~RingQueue() {}
+
+        //----------------------------------------------------------------------
+        ///@brief   Add an item to the queue.                                   
+        ///@param   item    The item to add to the back of the queue.           
+        ///@param   use_governor True = if the queue would exceed max size, wait
+        ///                     False = only wait if the ring itself is full    
+        //----------------------------------------------------------------------
+        void push(TYPE item, bool use_governor = true)
+        {
+            if (m_Aborted) return;
+
+            int spin(0);
+            int64_t start(0);
+            while (!tryPush(item, use_governor)) {
+                if (m_StatsCounter && start == 0) start = QueueStats::now();
+                if (m_Aborted) return;
+
+                if (++spin < SPIN_COUNT) {
+                    pause();
+                    continue;
+                }
+
+                //--------------------------------------------------------------
+                //  Register as a sleeper *before* the last look at the ring;   
+                //  see the note on wakeReaders.                                
+                //--------------------------------------------------------------
+                boost::unique_lock<boost::mutex> lock(m_Mutex);
+                ++m_SleepingWriters;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                while (isFull(use_governor) && !m_Aborted) {
+                    m_NotFull.wait(lock);
+                }
+                --m_SleepingWriters;
+                spin = 0;
+            }
+
+            if (m_StatsCounter) {
+                if (start != 0) {
+                    m_StatsCounter->blockedOnGovernor(
+                        QueueStats::now() - start
+                    );
+                }
+                m_StatsCounter->enqueued();
+            }
+
+            wakeReaders();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief       Remove and return the item from the front of the queue. 
+        ///@warning     If the queue is empty, rather than causing an error,    
+        ///             pop will hang the calling thread until there is         
+        ///             something to read or another thread calls setInterrupt  
+        ///             to wake up the queue.                                   
+        ///@param       item The item popped off the queue.                     
+        ///@return      true = an item was returned from the queue;             
+        ///             false = an item was not returned from the queue, but    
+        ///                     an interrupt was received with an empty queue.  
+        //----------------------------------------------------------------------
+        bool pop(TYPE& item)
+        {
+            if (m_Aborted) return false;
+
+            int spin(0);
+            int64_t start(0);
+            while (!tryPop(item)) {
+                if (m_StatsCounter && start == 0) start = QueueStats::now();
+                if (m_Aborted) return false;
+                if (m_Interrupt) {
+                    const bool result(tryPop(item));
+                    counted(start, result ? 1 : 0);
+                    return result;
+                }
+
+                if (++spin < SPIN_COUNT) {
+                    pause();
+                    continue;
+                }
+
+                boost::unique_lock<boost::mutex> lock(m_Mutex);
+                ++m_SleepingReaders;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                while (isEmpty() && !m_Interrupt && !m_Aborted) {
+                    m_NotEmpty.wait(lock);
+                }
+                --m_SleepingReaders;
+                spin = 0;
+            }
+
+            if (m_Aborted) return false;
+
+            counted(start, 1);
+            wakeWriters();
+            return true;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief       Remove (up to) max_items items from the front of the    
+        ///             queue, waking the writers once.                         
+        ///@warning     Hangs the calling thread the same as pop.               
+        ///@param       items       The popped items are appended to this.      
+        ///@param       max_items   The most items to pop (0 = all of them).    
+        ///@return      The number of items appended to items; 0 = an interrupt 
+        ///             was received with an empty queue (or abort).            
+        //----------------------------------------------------------------------
+        size_t popMany(std::vector<TYPE>& items, size_t max_items = 0)
+        {
+            TYPE item;
+            if (!pop(item)) return 0;
+
+            size_t result(1);
+            items.push_back(std::move(item));
+
+            while ((max_items == 0 || result < max_items) && tryPop(item)) {
+                items.push_back(std::move(item));
+                ++result;
+            }
+
+            counted(0, result - 1);
+            if (result > 1) wakeWriters();
+
+            return result;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief       As popMany, but returns 0 rather than waiting when the  
+        ///             queue is empty.                                         
+        //----------------------------------------------------------------------
+        size_t tryPopMany(std::vector<TYPE>& items, size_t max_items = 0)
+        {
+            if (m_Aborted) return 0;
+
+            size_t result(0);
+            TYPE item;
+            while ((max_items == 0 || result < max_items) && tryPop(item)) {
+                items.push_back(std::move(item));
+                ++result;
+            }
+
+            counted(0, result);
+            if (result > 0) wakeWriters();
+
+            return result;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the number of items currently in the queue (subject  
+        ///         to change without notice).                                  
+        //----------------------------------------------------------------------
+        size_t size() const
+        {
+            size_t tail(m_Tail.load(std::memory_order_acquire));
+            size_t head(m_Head.load(std::memory_order_acquire));
+            return tail > head ? tail - head : 0;
+        }
+
+        size_t governor() const {
+            return m_Governor;
+        }
+
+        void setGovernor(size_t ms) {
+            m_Governor = ms;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the number of slots in the ring.                     
+        //----------------------------------------------------------------------
+        size_t capacity() const {
+            return m_Capacity;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return true if the queue is empty.                          
+        //----------------------------------------------------------------------
+        bool empty() const
+        {
+            return isEmpty();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Change the interrupt value and wake up someone waiting for  
+        ///         the queue.                                                  
+        ///@param value The value to set the interrupt to (almost always true). 
+        //----------------------------------------------------------------------
+        void setInterrupt(bool value = true)
+        {
+            boost::mutex::scoped_lock lock(m_Mutex);
+            m_Interrupt = value;
+            m_NotEmpty.notify_all();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the maximum size that the queue ever grew to.        
+        //----------------------------------------------------------------------
+        uint64_t maximumSize()
+        {
+            return m_MaximumSize;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Count in stats from now on (null = stop counting).          
+        ///@warning Call before the queue is in use; the readers and writers    
+        ///         do not lock to look at it.                                  
+        //----------------------------------------------------------------------
+        void setStats(const QueueStatsPtr& stats)
+        {
+            m_Stats = stats;
+            m_StatsCounter = stats.get();
+        }
+        const QueueStatsPtr& stats() const { return m_Stats; }
+
+        //----------------------------------------------------------------------
+        ///@brief   Used when the queue will no longer be used.                 
+        //----------------------------------------------------------------------
+        void abort()
+        {
+            m_Aborted = true;
+
+            //------------------------------------------------------------------
+            //  Release whatever the ring is still holding on to (it is most    
+            //  likely shared pointers).                                        
+            //------------------------------------------------------------------
+            TYPE item;
+            while (tryPop(item)) { }
+            item = TYPE();
+
+            boost::mutex::scoped_lock lock(m_Mutex);
+            m_NotFull.notify_all();
+            m_NotEmpty.notify_all();
+        }
+
+    protected:
+
+    private:
+        //----------------------------------------------------------------------
+        //  Copying the ring may make sense, copying the threads waiting on it  
+        //  doesn't.                                                            
+        //----------------------------------------------------------------------
+        RingQueue& operator=(const RingQueue& that);
+        RingQueue(const RingQueue& that);
+
+        //----------------------------------------------------------------------
+        ///@brief   One slot in the ring.                                       
+        ///@par m_Sequence                                                      
+        ///         -   index       the slot is empty and it is writer index's  
+        ///                         turn to fill it.                            
+        ///         -   index + 1   the slot is full and it is reader index's   
+        ///                         turn to empty it.                           
+        //----------------------------------------------------------------------
+        struct Cell
+        {
+            Cell() { }
+            Cell(const Cell& that)
+                : m_Sequence(that.m_Sequence.load()), m_Data(that.m_Data) { }
+
+            std::atomic<size_t>     m_Sequence;
+            TYPE                    m_Data;
+        };
+
+        enum { CACHE_LINE = 64 };
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the first power of two at or above size.             
+        //----------------------------------------------------------------------
+        static size_t roundUpToPowerOfTwo(size_t size)
+        {
+            if (size == 0) return DEFAULT_CAPACITY;
+
+            size_t result(2);
+            while (result < size) result <<= 1;
+            return result;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Be polite to the other hyper-thread while spinning.         
+        //----------------------------------------------------------------------
+        static inline void pause()
+        {
+            #if defined(IS_VISUAL_STUDIO)
+                _mm_pause();
+            #elif defined(IS_GCC_COMPILER) && (defined(__x86_64__) || defined(__i386__))
+                __builtin_ia32_pause();
+            #endif
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return true if the governor (or the ring) says the writer   
+        ///         has to wait.                                                
+        //----------------------------------------------------------------------
+        bool isFull(bool use_governor) const
+        {
+            size_t s(size());
+            return s >= m_Capacity
+                || (use_governor && m_Governor > 0 && s >= m_Governor);
+        }
+
+        bool isEmpty() const
+        {
+            return size() == 0;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Attempt to place item in the ring without blocking.         
+        ///@return  true = item placed; false = the ring (or governor) is full. 
+        //----------------------------------------------------------------------
+        bool tryPush(const TYPE& item, bool use_governor)
+        {
+            if (use_governor && m_Governor > 0 && size() >= m_Governor) {
+                return false;
+            }
+
+            size_t position(m_Tail.load(std::memory_order_relaxed));
+            Cell* cell;
+
+            for (;;) {
+                cell = &m_Cells[position & m_Mask];
+                size_t sequence(cell->m_Sequence.load(std::memory_order_acquire));
+                intptr_t difference((intptr_t) sequence - (intptr_t) position);
+
+                if (difference == 0) {
+                    if (m_Tail.compare_exchange_weak(
+                            position
+                          , position + 1
+                          , std::memory_order_relaxed
+                        )
+                    ) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = m_Tail.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->m_Data = item;
+            cell->m_Sequence.store(position + 1, std::memory_order_release);
+
+            //------------------------------------------------------------------
+            //  Statistic only; an occasional lost update is acceptable.        
+            //------------------------------------------------------------------
+            uint64_t s(size());
+            if (s > m_MaximumSize) m_MaximumSize = s;
+
+            return true;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Attempt to remove an item from the ring without blocking.   
+        ///@return  true = item was removed; false = the ring is empty.         
+        //----------------------------------------------------------------------
+        bool tryPop(TYPE& item)
+        {
+            size_t position(m_Head.load(std::memory_order_relaxed));
+            Cell* cell;
+
+            for (;;) {
+                cell = &m_Cells[position & m_Mask];
+                size_t sequence(cell->m_Sequence.load(std::memory_order_acquire));
+                intptr_t difference(
+                    (intptr_t) sequence - (intptr_t) (position + 1)
+                );
+
+                if (difference == 0) {
+                    if (m_Head.compare_exchange_weak(
+                            position
+                          , position + 1
+                          , std::memory_order_relaxed
+                        )
+                    ) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = m_Head.load(std::memory_order_relaxed);
+                }
+            }
+
+            item = cell->m_Data;
+            cell->m_Data = TYPE();
+            cell->m_Sequence.store(
+                position + m_Mask + 1
+              , std::memory_order_release
+            );
+
+            return true;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Count popped items (and the wait since start, if there was  
+        ///         one) in the stats.                                          
+        //----------------------------------------------------------------------
+        void counted(int64_t start, size_t popped)
+        {
+            if (m_StatsCounter == nullptr) return;
+
+            if (start != 0) {
+                m_StatsCounter->waitedForData(QueueStats::now() - start);
+            }
+            if (popped > 0) m_StatsCounter->dequeued(popped);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Wake any reader that has gone to sleep on an empty ring.    
+        ///@note    The writer published the slot before the fence; the reader  
+        ///         registered as sleeping before its fence and last look.  One 
+        ///         of the two is therefore guaranteed to see the other -- the  
+        ///         reader sees the item or the writer sees the sleeper.  Taking
+        ///         the mutex before notifying closes the window between the    
+        ///         reader's last look and its wait.                            
+        //----------------------------------------------------------------------
+        void wakeReaders()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_SleepingReaders.load(std::memory_order_relaxed) > 0) {
+                boost::mutex::scoped_lock lock(m_Mutex);
+                m_NotEmpty.notify_all();
+            }
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Wake any writer that has gone to sleep on a full ring.      
+        //----------------------------------------------------------------------
+        void wakeWriters()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_SleepingWriters.load(std::memory_order_relaxed) > 0) {
+                boost::mutex::scoped_lock lock(m_Mutex);
+                m_NotFull.notify_all();
+            }
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Number of slots; always a power of two.                     
+        //----------------------------------------------------------------------
+        const size_t                m_Capacity;
+        const size_t                m_Mask;
+        std::vector<Cell>           m_Cells;
+
+        char                        m_Pad0[CACHE_LINE];
+
+        //----------------------------------------------------------------------
+        ///@brief   Next position to be written.                                
+        //----------------------------------------------------------------------
+        std::atomic<size_t>         m_Tail;
+        char                        m_Pad1[CACHE_LINE - sizeof(size_t)];
+
+        //----------------------------------------------------------------------
+        ///@brief   Next position to be read.                                   
+        //----------------------------------------------------------------------
+        std::atomic<size_t>         m_Head;
+        char                        m_Pad2[CACHE_LINE - sizeof(size_t)];
+
+        //----------------------------------------------------------------------
+        ///@brief   Number of threads parked on m_NotEmpty / m_NotFull.         
+        //----------------------------------------------------------------------
+        std::atomic<int>            m_SleepingReaders;
+        std::atomic<int>            m_SleepingWriters;
+        char                        m_Pad3[CACHE_LINE - 2 * sizeof(int)];
+
+        //----------------------------------------------------------------------
+        ///@brief The most number of items that the queue should hold.          
+        //----------------------------------------------------------------------
+        size_t                      m_Governor;
+
+        //----------------------------------------------------------------------
+        ///@brief   The largest size the queue ever grew to.                    
+        //----------------------------------------------------------------------
+        volatile uint64_t           m_MaximumSize;
+
+        //----------------------------------------------------------------------
+        ///@brief   Only used for parking; never held while touching the ring.  
+        //----------------------------------------------------------------------
+        boost::mutex                m_Mutex;
+        boost::condition            m_NotEmpty;
+        boost::condition            m_NotFull;
+
+        //----------------------------------------------------------------------
+        ///@brief Simplistically, indicates if setInterrupt was issued; used to 
+        ///       break out of the "pop" even if there's no data.               
+        //----------------------------------------------------------------------
+        std::atomic<bool>           m_Interrupt;
+
+        //----------------------------------------------------------------------
+        ///@brief   Someone signaled that the queue is to terminate/stop/abort. 
+        //----------------------------------------------------------------------
+        std::atomic<bool>           m_Aborted;
+
+        //----------------------------------------------------------------------
+        ///@brief   The counters (null = not counting); m_StatsCounter is the   
+        ///         raw pointer the hot paths test.                             
+        //----------------------------------------------------------------------
+        QueueStatsPtr               m_Stats;
+        QueueStats*                 m_StatsCounter;
+
+}; // class RingQueue //
+
+template <typename TYPE> const size_t RingQueue<TYPE>::DEFAULT_CAPACITY;
+template <typename TYPE> const int RingQueue<TYPE>::SPIN_COUNT;
+
+}  // namespace work //
+}  // namespace mp //
+}  // namespace lib //
+
+#endif // #ifndef LIB_MP_WORK_RINGQUEUE_H_FILE_GUARD
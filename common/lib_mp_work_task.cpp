@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_task.cpp                                                   
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   Work that a WorkStealingPool runs.                                  
+///                                                                             
+///@par State Machine                                                           
+///         - notStarted -> queued      startTask                               
+///         - idle       -> queued      schedule (the task is submitted)        
+///         - queued     -> running     a worker picks it up                    
+///         - running    -> notified    schedule while running                  
+///         - running    -> idle        runTask returned idle                   
+///         - notified   -> queued      runTask returned idle (too late)        
+///         - running    -> queued      runTask returned yield                  
+///         - running    -> finished    runTask returned finished (or threw)    
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_mp_work_task.h"
+#include "lib_mp_work_workstealingpool.h"
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+Task::Task()
+    : m_State(notStarted)
+    , m_Pool(nullptr)
+    , m_Done(false)
+{
+} // Task::Task() //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+Task::~Task()
+{
+} // Task::~Task() //
+
+//------------------------------------------------------------------------------
+///@brief   Hand the task to the pool; its first runTask happens right away.    
+//------------------------------------------------------------------------------
+void Task::startTask(WorkStealingPool* pool)
+{
+    m_Pool = pool;
+    m_State = queued;
+    pool->submit(this);
+
+} // void Task::startTask(WorkStealingPool* pool) //
+
+//------------------------------------------------------------------------------
+///@brief   Say that there is something for runTask to do.                      
+///@note    Cheap (one atomic load) when the task is already queued or has not  
+///         been started as a task (e.g., it is running in its own thread).     
+//------------------------------------------------------------------------------
+void Task::schedule()
+{
+    int state(m_State.load());
+
+    while (true) {
+        if (state == idle) {
+            if (m_State.compare_exchange_weak(state, queued)) {
+                m_Pool.load()->submit(this);
+                return;
+            }
+        } else if (state == running) {
+            if (m_State.compare_exchange_weak(state, notified)) {
+                return;
+            }
+        } else {
+            return;
+        }
+    }
+
+} // void Task::schedule() //
+
+//------------------------------------------------------------------------------
+///@brief   Wait for runTask to return finished.                                
+///@throw   Whatever runTask threw.                                             
+//------------------------------------------------------------------------------
+void Task::joinTask()
+{
+    boost::unique_lock<boost::mutex> lock(m_JoinMutex);
+    while (!m_Done) {
+        m_Finished.wait(lock);
+    }
+
+    if (m_Exception) {
+        std::exception_ptr e(m_Exception);
+        m_Exception = std::exception_ptr();
+        std::rethrow_exception(e);
+    }
+
+} // void Task::joinTask() //
+
+//------------------------------------------------------------------------------
+///@brief   Run a slice of the task (called by a pool worker).                  
+///@note    Once the task is requeued (or finished) another thread may own (or  
+///         destroy) it, so nothing here touches the object afterwards.         
+//------------------------------------------------------------------------------
+void Task::run()
+{
+    m_State = running;
+
+    Result result;
+    try {
+        result = runTask();
+    } catch (...) {
+        m_Exception = std::current_exception();
+        result = Result::finished;
+    }
+
+    WorkStealingPool* pool(m_Pool);
+
+    if (result == Result::finished) {
+        m_State = finished;
+        boost::unique_lock<boost::mutex> lock(m_JoinMutex);
+        m_Done = true;
+        m_Finished.notify_all();
+        return;
+    }
+
+    if (result == Result::idle) {
+        int state(running);
+        if (m_State.compare_exchange_strong(state, idle)) {
+            return;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //  Yielded, or scheduled while it was running:  go around again.           
+    //--------------------------------------------------------------------------
+    m_State = queued;
+    pool->submit(this);
+
+} // void Task::run() //
+
+} // namespace work //
+} // namespace mp //
+} // namespace lib //
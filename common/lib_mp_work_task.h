@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_task.h                                                     
+///@brief Holds lib::mp::work::Task, work that a WorkStealingPool runs.         
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_TASK_H_FILE_GUARD
+#define LIB_MP_WORK_TASK_H_FILE_GUARD
+
+#include <atomic>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <exception>
+
+namespace lib {
+namespace mp {
+namespace work {
+
+class WorkStealingPool;
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Work that can be run, a slice at a time, by a WorkStealingPool      
+///         rather than owning a thread.                                        
+///                                                                             
+///@par Purpose:                                                                
+///         A Threadable owns its thread for its whole life, even when it is    
+///         just waiting for data.  A Task is instead run by one of the pool's  
+///         workers when there is something for it to do (schedule() was        
+///         called).  runTask does a slice of the work and says whether there   
+///         is more to do now (yield), nothing to do until scheduled again      
+///         (idle), or nothing to do ever again (finished).                     
+///\n\n                                                                         
+///         A task is never run by two workers at the same time, so runTask     
+///         needs no more locking than a thread main would.                     
+///                                                                             
+///@par Thread Safety:  object                                                  
+///         schedule() may be called from any thread.                           
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class Task
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   What runTask has left to do.                                
+        //----------------------------------------------------------------------
+        enum class Result
+        {
+            idle        ///< Nothing until schedule() is called again.
+          , yield       ///< More to do; give the other tasks a turn first.
+          , finished    ///< Done; joinTask returns.
+        };
+
+        Task();
+        virtual ~Task();
+
+        //----------------------------------------------------------------------
+        ///@brief   Return false if the object must have a thread of its own    
+        ///         (e.g., it may block inside runTask).                        
+        //----------------------------------------------------------------------
+        virtual bool canRunAsTask() const { return true; }
+
+        void startTask(WorkStealingPool* pool);
+        void schedule();
+        void joinTask();
+
+        //----------------------------------------------------------------------
+        ///@brief   Return true if startTask has been called.                   
+        //----------------------------------------------------------------------
+        bool isTask() const { return m_Pool != nullptr; }
+
+    protected:
+        //----------------------------------------------------------------------
+        ///@brief   Do the next slice of work (in a pool worker's context).     
+        ///@note    An exception thrown finishes the task; joinTask rethrows it.
+        //----------------------------------------------------------------------
+        virtual Result runTask() = 0;
+
+    private:
+        Task(const Task& that);
+        Task& operator=(const Task& that);
+
+        friend class WorkStealingPool;
+        void run();
+
+        enum State { notStarted, idle, queued, running, notified, finished };
+
+        std::atomic<int>                m_State;
+        std::atomic<WorkStealingPool*>  m_Pool;
+
+        boost::mutex                    m_JoinMutex;
+        boost::condition_variable       m_Finished;
+        bool                            m_Done;
+        std::exception_ptr              m_Exception;
+
+}; // class Task //
+
+} // namespace work //
+} // namespace mp //
+} // namespace lib //
+
+#endif // #ifndef LIB_MP_WORK_TASK_H_FILE_GUARD
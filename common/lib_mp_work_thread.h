@@ -121,6 +121,8 @@ class RegisteredThreads
 ///             }                                                               
 ///         @endcode                                                            
 ///                                                                             
+///@version 2026-10-16  DHF     Added the ThreadPlacement constructor.          
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -159,6 +161,22 @@ class Thread
         {
         }
 
+        //----------------------------------------------------------------------
+        ///@brief   As above, but the thread first applies the placement (CPU   
+        ///         affinity, memory node, scheduling policy and priority).     
+        ///@see     placementError                                              
+        //----------------------------------------------------------------------
+        template<typename F>
+        Thread(
+            const ThreadPlacement& placement
+          , const std::string& name
+          , F* f
+        )
+            : ThreadInfo(name, placement)
+            , boost::thread(trackThread<F>, this, f)
+        {
+        }
+
         //----------------------------------------------------------------------
         //----------------------------------------------------------------------
         template<typename F, typename A1>
@@ -200,6 +218,7 @@ class Thread
         inline static void initialize(Thread* thread) 
         {
             thread->setHandle(self());
+            thread->applyPlacement();
             thread->setRunning(true);
 
             RegisteredThreads::instance->insert(thread);
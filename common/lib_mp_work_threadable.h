@@ -63,6 +63,8 @@ namespace work {
 ///             };                                                              
 ///         @endcode                                                            
 ///                                                                             
+///@version 2026-10-16  DHF     Added setPlacement.                             
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -89,6 +91,17 @@ class Threadable : virtual public lib::work::NamedObject
         void setThread(lib::ds::shared_ptr<Thread> t) {m_Thread = t;}
         ThreadPtr thread() { return m_Thread; }
 
+        //----------------------------------------------------------------------
+        ///@brief   Set where (and how) the thread ThreadableCollection starts  
+        ///         for this object runs.                                       
+        ///@note    Only applies to threads started after the call.             
+        //----------------------------------------------------------------------
+        void setPlacement(const ThreadPlacement& placement)
+        {
+            m_Placement = placement;
+        }
+        const ThreadPlacement& placement() const { return m_Placement; }
+
         //----------------------------------------------------------------------
         ///@brief   Give the derived class an oppontunity to indicate that      
         ///         there is a problem (most likely in incomplete initaliation).
@@ -148,7 +161,8 @@ class Threadable : virtual public lib::work::NamedObject
     private:
         Threadable& operator=(const Threadable& that);
 
-        ThreadPtr  m_Thread;
+        ThreadPtr           m_Thread;
+        ThreadPlacement     m_Placement;
 
 }; // class Threadable //
 
@@ -4,6 +4,14 @@
 ///                                                                             
 ///@brief   Allow control (join, start) of multiple threads at one time.        
 ///                                                                             
+///@version 2026-10-16  DHF     The debug messages' text is only made when      
+///                             DEBUG_LEVEL_1 is enabled.                       
+///                                                                             
+///@version 2026-10-16  DHF     Added the colocate placement policy; threads    
+///                             are started with the Threadable's placement.    
+///                                                                             
+///@version 2026-10-16  DHF     Added the work stealing pool executor.          
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                             Changed (*this)[j]->thread() == NULL to         
 ///                             (*this)[j]->thread().get() == nullptr           
@@ -16,9 +24,12 @@
 
 #include "lib_mp_work_threadablecollection.h"
 #include "lib_log_work_messagefactory.h"
+#include "lib_mp_work_task.h"
 #include "lib_mp_work_thread.h"
 
 #include <boost/scoped_array.hpp>
+#include <algorithm>
+#include <map>
 
 namespace lib {
 namespace mp {
@@ -32,10 +43,28 @@ static const lib::log::work::MessageFactory s_Message(
     lib::log::ds::LIB_MP_THREADABLE_COLLECTION
 );
 
+//------------------------------------------------------------------------------
+///@brief   Publish a DEBUG_LEVEL_1 message, its text made only if enabled.     
+//------------------------------------------------------------------------------
+template <typename MAKE>
+static void debug(
+    lib::msg::Publisher<lib::log::work::Message>& to
+  , lib::log::ds::messageid_t id
+  , MAKE make
+)
+{
+    if (lib::log::work::ConstMessagePtr m = s_Message.debug(id, make)) {
+        to.publish(m);
+    }
+}
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 ThreadableCollection::ThreadableCollection()
     : m_IsStarted(false)
+    , m_Executor(Executor::threads)
+    , m_PoolSize(0)
+    , m_Placement(PlacementPolicy::none)
 {
 } // ThreadableCollection::ThreadableCollection() //
 
@@ -63,6 +92,14 @@ void ThreadableCollection::startAll(bool checkAllIsWell)
         if (checkAllIsWell) (*this)[i]->checkIfAllIsWell();
     }
 
+    if (m_Executor == Executor::workStealingPool && !m_Pool) {
+        m_Pool = lib::ds::shared_ptr<WorkStealingPool>(
+            new WorkStealingPool(m_PoolSize)
+        );
+    }
+
+    if (m_Placement == PlacementPolicy::colocate) colocate();
+
     //--------------------------------------------------------------------------
     //  Start the threadables in reverse order (odds are the publishers are     
     //  put in first so we want the dependents started and ready to catch the   
@@ -71,54 +108,86 @@ void ThreadableCollection::startAll(bool checkAllIsWell)
     for (int i = 0; i < s; ++i) {
         int j = s - i - 1;
 
+        Task* task(nullptr);
+        if (m_Pool) {
+            lib::cast_dynamic(task, (*this)[j].get());
+            if (task != nullptr && !task->canRunAsTask()) task = nullptr;
+        }
+
         //----------------------------------------------------------------------
         //  Don't try to restart something that already has a thread.           
         //----------------------------------------------------------------------
-        if ((*this)[j]->thread().get() == nullptr) {
+        if (task != nullptr) {
+
+            if (!task->isTask() && (*this)[j]->beforeThreadStarts()) {
+                task->startTask(m_Pool.get());
+
+                debug(*this, MSG_THREADS_STARTED, [&] {
+                    return "started   task:    " + (*this)[j]->name();
+                });
+            }
+
+        } else if ((*this)[j]->thread().get() == nullptr) {
 
             if ((*this)[j]->beforeThreadStarts()) {
                 (*this)[j]->setThread(
                     ThreadPtr(
-                        new Thread((*this)[j]->name(), (*this)[j].get())
+                        new Thread(
+                            (*this)[j]->placement()
+                          , (*this)[j]->name()
+                          , (*this)[j].get()
+                        )
                     )
                 );
 
-                publish(
-                    s_Message.debug(
-                        MSG_THREADS_STARTED
-                      , "started   thread:  " + (*this)[j]->name() 
-                    )
-                );
+                debug(*this, MSG_THREADS_STARTED, [&] {
+                    return "started   thread:  " + (*this)[j]->name();
+                });
             }
         }
     }
 
-    publish(s_Message.debug(MSG_THREADS_STARTED, "threads started"));
+    debug(*this, MSG_THREADS_STARTED, [] { return "threads started"; });
 
     m_IsStarted = true;
 
 } // void ThreadableCollection::startAll() //
 
+//------------------------------------------------------------------------------
+///@brief   Select how startAll runs the Threadables.                           
+///@param   executor    See Executor.                                           
+///@param   pool_size   The number of pool threads; 0 = one per hardware thread.
+///@note    Call before startAll.                                               
+//------------------------------------------------------------------------------
+void ThreadableCollection::setExecutor(Executor executor, size_t pool_size)
+{
+    m_Executor = executor;
+    m_PoolSize = pool_size;
+
+} // void ThreadableCollection::setExecutor() //
+
 //------------------------------------------------------------------------------
 ///@brief                                                                       
+///@throw   The first exception thrown by a task (after everything is joined).  
 //------------------------------------------------------------------------------
 void ThreadableCollection::joinAll()
 {
     for (iterator t = begin(); t != end(); ++t) {
-        if ((*t)->thread()->joinable()) {
+        if ((*t)->thread() && (*t)->thread()->joinable()) {
             (*t)->thread()->join();
-            publish(
-                s_Message.debug(
-                    MSG_THREAD_COMPLETED
-                  , "thread " + (*t)->name() + " stopped"
-                )
-            );
+            debug(*this, MSG_THREAD_COMPLETED, [&] {
+                return "thread " + (*t)->name() + " stopped";
+            });
             (*t)->afterJoin();
         }
     }
-    publish(s_Message.debug(MSG_THREADS_COMPLETED, "threads completed"));
+    std::exception_ptr e(joinTasks());
+
+    debug(*this, MSG_THREADS_COMPLETED, [] { return "threads completed"; });
     endPublication();
 
+    if (e) std::rethrow_exception(e);
+
 } // void ThreadableCollection::joinAll() //
 
 
@@ -129,12 +198,16 @@ void ThreadableCollection::joinAllDebug()
 {                                                                               
     boost::scoped_array<bool> done(new bool[size()]);                           
                                                                                 
+    size_t completed = 0;
+
+    //--------------------------------------------------------------------------
+    //  Tasks (and anything never started) have no thread to wait on.           
+    //--------------------------------------------------------------------------
     for (size_t d = 0; d < size(); ++d) {                                       
-        done[d] = false;                                                        
+        done[d] = !(*this)[d]->thread();
+        if (done[d]) ++completed;
     }                                                                           
                                                                                 
-    size_t completed = 0;                                                       
-                                                                                
     while (completed < size()) {                                                
         for (size_t t = 0; t < size(); ++t) {                                   
             if (!done[t]) {                                                     
@@ -149,12 +222,9 @@ void ThreadableCollection::joinAllDebug()
                                                                                 
                     ++completed;                                                
                     done[t] = true;                                             
-                    publish(                                                    
-                        s_Message.debug(                                        
-                            MSG_THREAD_COMPLETED                                
-                          , "completed thread: " + thread->name()               
-                        )                                                       
-                    );                                                          
+                    debug(*this, MSG_THREAD_COMPLETED, [&] {                    
+                        return "completed thread: " + thread->name();           
+                    });                                                         
                                                                                 
                 } // if (thread->timed_join(timeout)) //                        
                                                                                 
@@ -163,12 +233,127 @@ void ThreadableCollection::joinAllDebug()
         } // for (size_t t = 0; t < size(); ++t) //                             
                                                                                 
     } // while (completed < size()) //                                          
-    publish(s_Message.debug(MSG_THREADS_COMPLETED, "threads completed"));       
+    std::exception_ptr e(joinTasks());
+
+    debug(*this, MSG_THREADS_COMPLETED, [] { return "threads completed"; });    
     endPublication();                                                           
+
+    if (e) std::rethrow_exception(e);
                                                                                 
 } // void ThreadableCollection::joinAllDebug() //
 
 
+//------------------------------------------------------------------------------
+///@brief   Wait for the tasks started by startAll and then stop the pool.      
+///@return  The first exception thrown by a task (the rest are dropped).        
+//------------------------------------------------------------------------------
+std::exception_ptr ThreadableCollection::joinTasks()
+{
+    std::exception_ptr result;
+
+    if (!m_Pool) return result;
+
+    for (iterator t = begin(); t != end(); ++t) {
+        Task* task;
+        if (lib::cast_dynamic(task, t->get()) == nullptr || !task->isTask()) {
+            continue;
+        }
+
+        try {
+            task->joinTask();
+        } catch (...) {
+            if (!result) result = std::current_exception();
+        }
+
+        debug(*this, MSG_THREAD_COMPLETED, [&] {
+            return "task " + (*t)->name() + " stopped";
+        });
+        (*t)->afterJoin();
+    }
+
+    m_Pool->stop();
+    m_Pool.reset();
+
+    return result;
+
+} // std::exception_ptr ThreadableCollection::joinTasks() //
+
+//------------------------------------------------------------------------------
+///@brief   Give each group of connected Threadables (publisher to subscriber)  
+///         a core complex; the biggest groups are placed first, each on the    
+///         complex with the fewest Threadables so far.                         
+//------------------------------------------------------------------------------
+void ThreadableCollection::colocate()
+{
+    std::vector<std::vector<int> > complexes(ThreadPlacement::coreComplexes());
+    if (complexes.size() < 2) return;
+
+    //--------------------------------------------------------------------------
+    //  Union-find over the collection:  a subscriber joins the group of each   
+    //  of its publishers that is also in the collection.                       
+    //--------------------------------------------------------------------------
+    std::vector<size_t> group(size());
+    std::map<const lib::msg::PublisherSubscriberBase*, size_t> index;
+    for (size_t i = 0; i < size(); ++i) {
+        group[i] = i;
+
+        lib::msg::PublisherSubscriberBase* p;
+        if (lib::cast_dynamic(p, (*this)[i].get()) != nullptr) index[p] = i;
+    }
+
+    auto root = [&group](size_t i) {
+        while (group[i] != i) i = group[i] = group[group[i]];
+        return i;
+    };
+
+    for (size_t i = 0; i < size(); ++i) {
+        lib::msg::PublisherSubscriberBase* p;
+        if (lib::cast_dynamic(p, (*this)[i].get()) == nullptr) continue;
+
+        std::vector<const lib::msg::PublisherSubscriberBase*> publishers(
+            p->publishers()
+        );
+        for (size_t k = 0; k < publishers.size(); ++k) {
+            auto found(index.find(publishers[k]));
+            if (found != index.end()) {
+                group[root(i)] = root(found->second);
+            }
+        }
+    }
+
+    std::map<size_t, std::vector<size_t> > members;
+    for (size_t i = 0; i < size(); ++i) {
+        members[root(i)].push_back(i);
+    }
+
+    std::vector<std::vector<size_t> > groups;
+    for (auto m = members.begin(); m != members.end(); ++m) {
+        groups.push_back(m->second);
+    }
+    std::stable_sort(
+        groups.begin()
+      , groups.end()
+      , [](const std::vector<size_t>& a, const std::vector<size_t>& b) {
+            return a.size() > b.size();
+        }
+    );
+
+    std::vector<size_t> load(complexes.size(), 0);
+    for (size_t g = 0; g < groups.size(); ++g) {
+        size_t c(std::min_element(load.begin(), load.end()) - load.begin());
+        load[c] += groups[g].size();
+
+        ThreadPlacement placement;
+        placement.setCpus(complexes[c]);
+
+        for (size_t m = 0; m < groups[g].size(); ++m) {
+            Threadable& t(*(*this)[groups[g][m]]);
+            if (t.placement().isDefault()) t.setPlacement(placement);
+        }
+    }
+
+} // void ThreadableCollection::colocate() //
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 bool ThreadableCollection::isStarted() const
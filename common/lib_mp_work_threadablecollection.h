@@ -10,9 +10,11 @@
 #include "lib_ds_shared_ptr.h"
 #include "lib_log_work_message.h"
 #include "lib_mp_work_threadable.h"
+#include "lib_mp_work_workstealingpool.h"
 #include "lib_msg_publisher.h"
 
 #include <boost/type_traits.hpp>
+#include <exception>
 #include <vector>
 
 
@@ -33,6 +35,24 @@ namespace work {
 ///         that represent status / debug information.  This can safely be      
 ///         ignored.                                                            
 ///                                                                             
+///@par Executors                                                               
+///         By default each Threadable gets a thread of its own.  After         
+///         setExecutor(Executor::workStealingPool), those that are also a      
+///         lib::mp::work::Task (and canRunAsTask) are instead run by a         
+///         WorkStealingPool owned by the collection; joinAll waits for them    
+///         just as it does the threads and then stops the pool.                
+///                                                                             
+///@par Placement                                                               
+///         After setPlacementPolicy(PlacementPolicy::colocate), startAll groups
+///         the Threadables connected publisher to subscriber and pins each     
+///         group to one core complex (the CPUs sharing a last level cache),    
+///         spreading the groups over the complexes.  A Threadable given its own
+///         placement (Threadable::setPlacement) keeps it.                      
+///                                                                             
+///@version 2026-10-16  DHF     Added setPlacementPolicy.                       
+///                                                                             
+///@version 2026-10-16  DHF     Added setExecutor (WorkStealingPool).           
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -106,6 +126,33 @@ class ThreadableCollection
 
         bool isStarted() const;
 
+        //----------------------------------------------------------------------
+        ///@brief   How startAll runs the Threadables.                          
+        //----------------------------------------------------------------------
+        enum class Executor
+        {
+            threads             ///< One thread each.
+          , workStealingPool    ///< Tasks share a WorkStealingPool.
+        };
+
+        void setExecutor(Executor executor, size_t pool_size = 0);
+        Executor executor() const { return m_Executor; }
+
+        //----------------------------------------------------------------------
+        ///@brief   How startAll places the threads it starts.                  
+        //----------------------------------------------------------------------
+        enum class PlacementPolicy
+        {
+            none        ///< Each Threadable's own placement (if any).
+          , colocate    ///< Connected Threadables share a core complex.
+        };
+
+        void setPlacementPolicy(PlacementPolicy policy)
+        {
+            m_Placement = policy;
+        }
+        PlacementPolicy placementPolicy() const { return m_Placement; }
+
         virtual void startAll(bool checkAllIsWell = true);
         virtual void joinAll();
         virtual void joinAllDebug();
@@ -125,6 +172,19 @@ class ThreadableCollection
 
         bool m_IsStarted;
 
+        Executor    m_Executor;
+        size_t      m_PoolSize;
+
+        PlacementPolicy m_Placement;
+
+        //----------------------------------------------------------------------
+        ///@brief   Runs the tasks when m_Executor is workStealingPool; created 
+        ///         by startAll.                                                
+        //----------------------------------------------------------------------
+        lib::ds::shared_ptr<WorkStealingPool> m_Pool;
+
+        std::exception_ptr joinTasks();
+        void colocate();
 
 
 }; // class ThreadableCollection //
@@ -6,6 +6,11 @@
 ///                                                                             
 ///@brief   Provide information about a thread.                                 
 ///                                                                             
+///@version 2026-10-16  DHF     Added cpuNanoSeconds; historyOfCPU returns a    
+///                             copy (made under the lock).                     
+///                                                                             
+///@version 2026-10-16  DHF     Added placement.                                
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-08-02  DHF     DeltaTime::seconds renamed inSeconds.           
@@ -42,6 +47,19 @@ ThreadInfo::ThreadInfo(const std::string& name)
 
 } // ThreadInfo::ThreadInfo() //
 
+//------------------------------------------------------------------------------
+///@param   placement   Applied (by applyPlacement) when the thread starts.     
+//------------------------------------------------------------------------------
+ThreadInfo::ThreadInfo(
+    const std::string& name
+  , const ThreadPlacement& placement
+) : lib::work::NamedObject(name)
+  , m_IsRunning(false)
+  , m_Placement(placement)
+{
+
+} // ThreadInfo::ThreadInfo(name, placement) //
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 ThreadInfo::ThreadInfo(
@@ -63,6 +81,31 @@ ThreadInfo::~ThreadInfo()
 
 } // ThreadInfo::~ThreadInfo
 
+//------------------------------------------------------------------------------
+///@brief   Apply the placement to the thread (called in the thread's context). 
+//------------------------------------------------------------------------------
+void ThreadInfo::applyPlacement()
+{
+    if (m_Placement.isDefault()) return;
+
+    std::string error(m_Placement.apply(m_Handle));
+
+    boost::mutex::scoped_lock lock(m_ThreadMutex);
+    m_PlacementError = error;
+
+} // void ThreadInfo::applyPlacement() //
+
+//------------------------------------------------------------------------------
+///@brief   Return what part of the placement could not be applied (e.g., a     
+///         real time policy without the privilege); empty if all was well.     
+//------------------------------------------------------------------------------
+std::string ThreadInfo::placementError() const
+{
+    boost::mutex::scoped_lock lock(m_ThreadMutex);
+    return m_PlacementError;
+
+} // std::string ThreadInfo::placementError() const //
+
 //------------------------------------------------------------------------------
 ///@brief   Return the name of this thread.                                     
 //------------------------------------------------------------------------------
@@ -162,14 +205,47 @@ double ThreadInfo::cpuPercentTotal() const
 
 //------------------------------------------------------------------------------
 ///@brief   Return the [current] history of CPU utilization.                    
+///@note    A copy:  a reference would be read after the lock is let go, while 
+///         updateHistory changes the deque.                                    
 //------------------------------------------------------------------------------
-const std::deque<double>& ThreadInfo::historyOfCPU() const
+std::deque<double> ThreadInfo::historyOfCPU() const
 {
 
     boost::mutex::scoped_lock lock(m_ThreadMutex);
 
     return m_HistoryOfCPU;
-} // const std::deque<double>& ThreadInfo::historyOfCPU() const //
+} // std::deque<double> ThreadInfo::historyOfCPU() const //
+
+//------------------------------------------------------------------------------
+///@brief   Read the CPU time the thread has consumed (nanoseconds) straight    
+///         from its CPU clock (pthread_getcpuclockid).                         
+///@return  false (nano_seconds untouched) if the thread is not running or its  
+///         clock cannot be read.                                               
+///@note    Unlike cpuTime() this is safe against the thread finishing:  it     
+///         holds the lock that setRunning(false) takes, so the thread cannot   
+///         exit (and its handle go stale) part way through.                    
+//------------------------------------------------------------------------------
+bool ThreadInfo::cpuNanoSeconds(int64_t& nano_seconds) const
+{
+
+    boost::mutex::scoped_lock lock(m_ThreadMutex);
+
+    if (!m_IsRunning) return false;
+
+    #ifdef _WIN32
+        const timespec cpu(runningCPUTime());
+    #else
+        clockid_t cid;
+        if (pthread_getcpuclockid(m_Handle, &cid) != 0) return false;
+
+        timespec cpu;
+        if (clock_gettime(cid, &cpu) != 0) return false;
+    #endif
+
+    nano_seconds = int64_t(cpu.tv_sec) * 1000000000 + cpu.tv_nsec;
+    return true;
+
+} // bool ThreadInfo::cpuNanoSeconds(int64_t& nano_seconds) const //
 
 //------------------------------------------------------------------------------
 ///@brief   Update the CPU utilization history by pushing the current CPU       
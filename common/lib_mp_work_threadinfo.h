@@ -7,11 +7,13 @@
 #define LIB_MP_THREADINFO_H_FILE_GUARD
 
 #include "lib_log_work_message.h"
+#include "lib_mp_work_threadplacement.h"
 #include "lib_work_namedobject.h"
 #include "lib_time_work_datetime.h"
 #include "lib_time_work_deltatime.h"
 #include <boost/thread.hpp>
 #include <deque>
+#include <stdint.h>
 
 namespace lib {
 namespace mp {
@@ -25,6 +27,11 @@ namespace work {
 ///                                                                             
 ///@par Thread Safety:  object                                                  
 ///                                                                             
+///@version 2026-10-16  DHF     Added cpuNanoSeconds; historyOfCPU returns a    
+///                             copy (made under the lock).                     
+///                                                                             
+///@version 2026-10-16  DHF     Added placement.                                
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2010-04-07  DHF     File creation                                   
@@ -33,6 +40,10 @@ class ThreadInfo : public lib::work::NamedObject
 {
     public:
         ThreadInfo(const std::string& name = "");
+        ThreadInfo(
+            const std::string& name
+          , const ThreadPlacement& placement
+        );
         ThreadInfo(boost::thread::native_handle_type handle, const std::string& name = "");
         virtual ~ThreadInfo();
 
@@ -40,13 +51,18 @@ class ThreadInfo : public lib::work::NamedObject
         lib::time::work::DeltaTime runTime() const;
         double cpuPercentCurrent() const;
         double cpuPercentTotal() const;
-        const std::deque<double>& historyOfCPU() const;
+        std::deque<double> historyOfCPU() const;
+        bool cpuNanoSeconds(int64_t& nano_seconds) const;
 
         double updateHistory();
 
         void setRunning(bool is_running);
         bool isRunning() const;
 
+        const ThreadPlacement& placement() const { return m_Placement; }
+        std::string placementError() const;
+        void applyPlacement();
+
         //----------------------------------------------------------------------
         //  Override the NamedObject methods to make them thread safe.          
         //----------------------------------------------------------------------
@@ -72,6 +88,8 @@ class ThreadInfo : public lib::work::NamedObject
         lib::time::work::DeltaTime          m_CPU;
         lib::time::work::DeltaTime          m_RunTime;
         bool                                m_IsRunning;
+        const ThreadPlacement               m_Placement;
+        std::string                         m_PlacementError;
 
         mutable boost::mutex                m_ThreadMutex;
 
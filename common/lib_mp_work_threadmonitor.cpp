@@ -0,0 +1,314 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_threadmonitor.cpp                                          
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   Sample the CPU of every registered thread; publish the stats.       
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_mp_work_threadmonitor.h"
+#include "lib_mp_work_thread.h"
+#include "lib_string.h"
+#include "lib_time_work_clock.h"
+
+#include <algorithm>
+#include <time.h>                   // nanosleep
+
+namespace lib {
+namespace mp {
+namespace work {
+
+using lib::time::ds::NanoSeconds;
+
+//------------------------------------------------------------------------------
+//  The longest ThreadMonitor::operator() sleeps before looking at m_Stop.      
+//------------------------------------------------------------------------------
+static const NanoSeconds s_MaximumNap(NanoSeconds::fromMilliSeconds(10));
+
+//==============================================================================
+//  CPUHistory                                                                  
+//==============================================================================
+
+//------------------------------------------------------------------------------
+///@brief   Construct an empty history of capacity samples (at least one).      
+//------------------------------------------------------------------------------
+CPUHistory::CPUHistory(size_t capacity)
+    : m_Capacity(capacity == 0 ? 1 : capacity)
+    , m_Samples(new std::atomic<float>[m_Capacity])
+    , m_Writing(0)
+    , m_Count(0)
+{
+    for (size_t s = 0; s < m_Capacity; ++s) m_Samples[s].store(0);
+
+} // CPUHistory::CPUHistory(size_t capacity) //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+CPUHistory::~CPUHistory()
+{
+
+} // CPUHistory::~CPUHistory() //
+
+//------------------------------------------------------------------------------
+///@brief   Add a sample (overwriting the oldest once full).                    
+///@note    m_Writing moves before the slot is touched, so a reader that sees   
+///         the new value also sees that its copy of the slot is suspect.       
+//------------------------------------------------------------------------------
+void CPUHistory::push(float percent)
+{
+    const uint64_t count(m_Count.load(std::memory_order_relaxed));
+
+    m_Writing.store(count + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_Samples[count % m_Capacity].store(percent, std::memory_order_relaxed);
+    m_Count.store(count + 1, std::memory_order_release);
+
+} // void CPUHistory::push(float percent) //
+
+//------------------------------------------------------------------------------
+///@brief   Return up to the most recent samples, oldest first.                 
+//------------------------------------------------------------------------------
+std::vector<float> CPUHistory::recent(size_t most) const
+{
+    const uint64_t count(m_Count.load(std::memory_order_acquire));
+    const uint64_t size(
+        std::min<uint64_t>(std::min<uint64_t>(count, m_Capacity), most)
+    );
+    const uint64_t first(count - size);
+
+    std::vector<float> result;
+    result.reserve(size_t(size));
+    for (uint64_t s = first; s < count; ++s) {
+        result.push_back(
+            m_Samples[s % m_Capacity].load(std::memory_order_relaxed)
+        );
+    }
+
+    //--------------------------------------------------------------------------
+    //  Anything the writer may have started on since is dropped.               
+    //--------------------------------------------------------------------------
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t writing(m_Writing.load(std::memory_order_relaxed));
+    if (writing > first + m_Capacity) {
+        const uint64_t lapped(
+            std::min<uint64_t>(writing - m_Capacity - first, size)
+        );
+        result.erase(result.begin(), result.begin() + size_t(lapped));
+    }
+
+    return result;
+
+} // std::vector<float> CPUHistory::recent(size_t most) const //
+
+//==============================================================================
+//  ThreadCPUStats                                                              
+//==============================================================================
+
+//------------------------------------------------------------------------------
+///@brief   Return the names of the threads whose last sample was at or over    
+///         percent of a CPU.                                                   
+//------------------------------------------------------------------------------
+std::vector<std::string> ThreadCPUStats::saturated(float percent) const
+{
+    std::vector<std::string> result;
+    for (size_t t = 0; t < threads.size(); ++t) {
+        if (threads[t].current >= percent) result.push_back(threads[t].name);
+    }
+    return result;
+
+} // std::vector<std::string> ThreadCPUStats::saturated(float percent) const //
+
+//------------------------------------------------------------------------------
+///@brief   Return a line per thread:  current, average and peak percent.       
+//------------------------------------------------------------------------------
+std::string ThreadCPUStats::toString() const
+{
+    std::string result;
+    for (size_t t = 0; t < threads.size(); ++t) {
+        result += format(
+            "%6.1f%% now %6.1f%% average %6.1f%% peak  %s\n"
+          , threads[t].current
+          , threads[t].average
+          , threads[t].peak
+          , threads[t].name.c_str()
+        );
+    }
+    return result;
+
+} // std::string ThreadCPUStats::toString() const //
+
+//==============================================================================
+//  ThreadMonitor                                                               
+//==============================================================================
+
+//------------------------------------------------------------------------------
+///@param   period  How often operator() samples.                               
+///@param   history How many samples are kept per thread.                       
+//------------------------------------------------------------------------------
+ThreadMonitor::ThreadMonitor(NanoSeconds period, size_t history)
+    : lib::mp::work::Threadable("thread monitor")
+    , m_Period(period)
+    , m_History(history)
+    , m_Stop(false)
+    , m_Pass(0)
+    , m_LastSample(0)
+{
+
+} // ThreadMonitor::ThreadMonitor() //
+
+//------------------------------------------------------------------------------
+///@brief   Reclaim resources held by object.                                   
+//------------------------------------------------------------------------------
+ThreadMonitor::~ThreadMonitor()
+{
+
+} // ThreadMonitor::~ThreadMonitor() //
+
+//------------------------------------------------------------------------------
+///@brief   Sample every registered thread, publish the stats, and return them. 
+//------------------------------------------------------------------------------
+ConstThreadCPUStatsPtr ThreadMonitor::sample()
+{
+    lib::ds::shared_ptr<ThreadCPUStats> stats(new ThreadCPUStats);
+    stats->time = lib::time::work::DateTime::now();
+
+    ++m_Pass;
+
+    //--------------------------------------------------------------------------
+    //  The registry is held only while the clocks are read (a thread that      
+    //  starts or ends meanwhile waits).                                        
+    //--------------------------------------------------------------------------
+    {
+        RegisteredThreads::lease registered;
+
+        const int64_t now(lib::time::work::Clock::elapsed().count());
+        const int64_t wall(now - m_LastSample);
+        stats->period = NanoSeconds(m_LastSample == 0 ? 0 : wall);
+        m_LastSample = now;
+
+        for (RegisteredThreads::const_iterator t = registered->begin();
+             t != registered->end();
+             ++t
+        ) {
+            int64_t cpu;
+            if (!(*t)->cpuNanoSeconds(cpu)) continue;
+
+            //------------------------------------------------------------------
+            //  A new thread (or a new ThreadInfo where an old one was) only    
+            //  starts its count.                                               
+            //------------------------------------------------------------------
+            std::map<const ThreadInfo*, Track>::iterator track(
+                m_Tracks.find(*t)
+            );
+            if (track == m_Tracks.end()
+             || cpu < track->second.cpu
+             || track->second.pass + 1 != m_Pass
+            ) {
+                Track fresh;
+                fresh.cpu = cpu;
+                fresh.pass = m_Pass;
+                fresh.history.reset(new CPUHistory(m_History));
+                m_Tracks[*t] = fresh;
+                continue;
+            }
+
+            const float percent(
+                wall <= 0 ? 0 : float(100.0 * (cpu - track->second.cpu) / wall)
+            );
+            track->second.cpu = cpu;
+            track->second.pass = m_Pass;
+            track->second.history->push(percent);
+
+            ThreadCPU line;
+            line.name = (*t)->name();
+            line.current = percent;
+            line.history = track->second.history;
+            stats->threads.push_back(line);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //  Forget the threads that have gone.                                      
+    //--------------------------------------------------------------------------
+    for (std::map<const ThreadInfo*, Track>::iterator t = m_Tracks.begin();
+         t != m_Tracks.end();
+    ) {
+        if (t->second.pass != m_Pass) m_Tracks.erase(t++);
+        else ++t;
+    }
+
+    //--------------------------------------------------------------------------
+    //  Average and peak over each history; busiest first.                      
+    //--------------------------------------------------------------------------
+    for (size_t t = 0; t < stats->threads.size(); ++t) {
+        ThreadCPU& line(stats->threads[t]);
+        const std::vector<float> samples(line.history->recent());
+
+        double sum(0);
+        line.peak = 0;
+        for (size_t s = 0; s < samples.size(); ++s) {
+            sum += samples[s];
+            line.peak = std::max(line.peak, samples[s]);
+        }
+        line.average = samples.empty() ? 0 : float(sum / samples.size());
+    }
+    std::sort(
+        stats->threads.begin()
+      , stats->threads.end()
+      , [](const ThreadCPU& a, const ThreadCPU& b) {
+            return a.current > b.current;
+        }
+    );
+
+    ConstThreadCPUStatsPtr result(stats);
+    {
+        boost::mutex::scoped_lock lock(m_Mutex);
+        m_Latest = result;
+    }
+    publish(result);
+
+    return result;
+
+} // ConstThreadCPUStatsPtr ThreadMonitor::sample() //
+
+//------------------------------------------------------------------------------
+///@brief   Return the stats last published (null before the first sample).     
+//------------------------------------------------------------------------------
+ConstThreadCPUStatsPtr ThreadMonitor::latest() const
+{
+    boost::mutex::scoped_lock lock(m_Mutex);
+    return m_Latest;
+
+} // ConstThreadCPUStatsPtr ThreadMonitor::latest() const //
+
+//------------------------------------------------------------------------------
+///@brief   Sample every period until stop().                                   
+//------------------------------------------------------------------------------
+void ThreadMonitor::operator()()
+{
+    NanoSeconds next(lib::time::work::Clock::elapsed());
+
+    while (!m_Stop.load()) {
+        sample();
+
+        next = next + m_Period;
+        for (NanoSeconds now = lib::time::work::Clock::elapsed();
+             now < next && !m_Stop.load();
+             now = lib::time::work::Clock::elapsed()
+        ) {
+            timespec nap;
+            std::min(next - now, s_MaximumNap).toTimespec(nap);
+            nanosleep(&nap, nullptr);
+        }
+    }
+
+    endPublication();
+
+} // void ThreadMonitor::operator()() //
+
+} // namespace work
+} // namespace mp
+} // namespace lib
@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_threadmonitor.h                                            
+///@brief Holds lib::mp::work::ThreadMonitor, a Threadable that samples the CPU 
+///       of every registered thread, and the records it publishes.             
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_MP_WORK_THREADMONITOR_H_FILE_GUARD
+#define LIB_MP_WORK_THREADMONITOR_H_FILE_GUARD
+
+#include "lib_ds_shared_ptr.h"
+#include "lib_msg_publisher.h"
+#include "lib_mp_work_threadable.h"
+#include "lib_mp_work_threadinfo.h"
+#include "lib_time_ds_nanoseconds.h"
+#include "lib_time_work_datetime.h"
+
+#include <atomic>
+#include <boost/thread/mutex.hpp>
+#include <map>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   The last so many CPU samples (percent of one CPU) of a thread:  one 
+///         writer, any number of readers, no lock.                             
+///                                                                             
+///@par Readers                                                                 
+///         recent() copies the samples and then checks the writer did not      
+///         lap it while it did; samples that may have been overwritten part    
+///         way through the copy are left out (so a reader racing a writer      
+///         can get fewer than it asked for, never a torn one).                 
+///                                                                             
+///@par Thread Safety:  object                                                  
+///         push() from one thread; recent(), count() from any.                 
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class CPUHistory
+{
+    public:
+        explicit CPUHistory(size_t capacity);
+        virtual ~CPUHistory();
+
+        size_t capacity() const { return m_Capacity; }
+        uint64_t count() const
+            { return m_Count.load(std::memory_order_acquire); }
+
+        void push(float percent);
+        std::vector<float> recent(size_t most = SIZE_MAX) const;
+
+    private:
+        CPUHistory(const CPUHistory& that);
+        CPUHistory& operator=(const CPUHistory& that);
+
+        const size_t                            m_Capacity;
+        std::unique_ptr<std::atomic<float>[]>   m_Samples;
+        std::atomic<uint64_t>                   m_Writing;  ///< being written
+        std::atomic<uint64_t>                   m_Count;    ///< written
+
+}; // class CPUHistory //
+
+using ConstCPUHistoryPtr = lib::ds::shared_ptr<const CPUHistory>;
+
+//------------------------------------------------------------------------------
+///@brief   One thread's line of a ThreadCPUStats.                              
+//------------------------------------------------------------------------------
+struct ThreadCPU
+{
+    std::string         name;
+    float               current;    ///< % of a CPU over the last period
+    float               average;    ///< % of a CPU over the history
+    float               peak;       ///< highest sample in the history
+    ConstCPUHistoryPtr  history;    ///< the samples (read without a lock)
+
+}; // struct ThreadCPU //
+
+//------------------------------------------------------------------------------
+///@brief   What ThreadMonitor publishes each period:  a line per running       
+///         registered thread, busiest first.                                   
+//------------------------------------------------------------------------------
+struct ThreadCPUStats
+{
+    lib::time::work::DateTime   time;
+    lib::time::ds::NanoSeconds  period;     ///< since the sample before
+    std::vector<ThreadCPU>      threads;
+
+    std::vector<std::string> saturated(float percent = 90) const;
+    std::string toString() const;
+
+}; // struct ThreadCPUStats //
+
+using ConstThreadCPUStatsPtr = lib::ds::shared_ptr<const ThreadCPUStats>;
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Sample the CPU time of every thread in RegisteredThreads at a set   
+///         rate, keep a history of each, and publish a ThreadCPUStats.         
+///                                                                             
+///@par Purpose:                                                                
+///         ThreadInfo can say how busy a thread is, but nothing asks it        
+///         regularly.  Run one of these (in a ThreadableCollection with the    
+///         pipeline) and a stage pinned at 100% of a CPU shows up in the       
+///         published stats (see ThreadCPUStats::saturated) without a           
+///         profiler attached.                                                  
+///                                                                             
+///@par Sampling                                                                
+///         Each period the thread clock of each registered thread is read      
+///         (pthread_getcpuclockid via ThreadInfo::cpuNanoSeconds) and the      
+///         CPU used since the last sample is divided by the time since it      
+///         (Clock::elapsed()).  A thread's first sample only starts its        
+///         count; threads that have finished are dropped.  ThreadInfo's own    
+///         history (updateHistory) is left for its callers.                    
+///                                                                             
+///@par Readers                                                                 
+///         latest() returns the last record published; its histories are       
+///         lock-free rings still being written, so a dashboard can keep a      
+///         record and read the newest samples from it at any time.             
+///                                                                             
+///@par Thread Safety:  object                                                  
+///         sample() from one thread at a time (operator() or a caller's        
+///         own loop); latest() and stop() from any.                            
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::ds::shared_ptr<lib::mp::work::ThreadMonitor> monitor;          
+///         lib::new_shared(monitor, NanoSeconds::fromMilliSeconds(500));       
+///         threads.push_back(monitor);                                         
+///         monitor->connect(dashboard);    // Subscriber<ThreadCPUStats>       
+///         threads.startAll();                                                 
+///         ...                                                                 
+///         monitor->stop();                                                    
+///         threads.joinAll();                                                  
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ThreadMonitor
+    : public lib::msg::Publisher<ThreadCPUStats>
+    , public lib::mp::work::Threadable
+{
+    public:
+        static const size_t DEFAULT_HISTORY = 120;      ///< samples per thread
+
+        explicit ThreadMonitor(
+            lib::time::ds::NanoSeconds  period
+                = lib::time::ds::NanoSeconds::fromSeconds(1)
+          , size_t                      history = DEFAULT_HISTORY
+        );
+        virtual ~ThreadMonitor();
+
+        lib::time::ds::NanoSeconds period() const { return m_Period; }
+
+        ConstThreadCPUStatsPtr sample();
+        ConstThreadCPUStatsPtr latest() const;
+
+        void operator()() override;
+        void stop() { m_Stop.store(true); }
+
+    private:
+        ThreadMonitor(const ThreadMonitor& that);
+        ThreadMonitor& operator=(const ThreadMonitor& that);
+
+        //----------------------------------------------------------------------
+        //  What is known of a thread between samples.                          
+        //----------------------------------------------------------------------
+        struct Track
+        {
+            int64_t                             cpu;
+            uint64_t                            pass;
+            lib::ds::shared_ptr<CPUHistory>     history;
+        };
+
+        const lib::time::ds::NanoSeconds        m_Period;
+        const size_t                            m_History;
+        std::atomic<bool>                       m_Stop;
+
+        std::map<const ThreadInfo*, Track>      m_Tracks;
+        uint64_t                                m_Pass;
+        int64_t                                 m_LastSample;
+
+        mutable boost::mutex                    m_Mutex;    ///< m_Latest
+        ConstThreadCPUStatsPtr                  m_Latest;
+
+}; // class ThreadMonitor //
+
+} // namespace work
+} // namespace mp
+} // namespace lib
+
+#endif // #ifndef LIB_MP_WORK_THREADMONITOR_H_FILE_GUARD
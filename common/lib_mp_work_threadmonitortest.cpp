@@ -0,0 +1,249 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_threadmonitortest.cpp                                      
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_mp_work_threadmonitortest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_mp_work_thread.h"
+#include "lib_mp_work_threadablecollection.h"
+#include "lib_mp_work_threadmonitor.h"
+#include "lib_msg_subscriber.h"
+#include "lib_time_ds_nanoseconds.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <time.h>
+#include <vector>
+
+namespace lib {
+namespace mp {
+namespace work {
+namespace test {
+
+using lib::time::ds::NanoSeconds;
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::mp::work::test::ThreadMonitorTest);
+
+//------------------------------------------------------------------------------
+//  Threads to watch:  one that spins and one that naps, until told to stop.    
+//------------------------------------------------------------------------------
+static std::atomic<bool> s_Stop(false);
+
+static void nap(NanoSeconds length)
+{
+    timespec time;
+    length.toTimespec(time);
+    nanosleep(&time, nullptr);
+}
+
+static void spin()
+{
+    volatile uint64_t count(0);
+    while (!s_Stop.load(std::memory_order_relaxed)) ++count;
+}
+
+static void idle()
+{
+    while (!s_Stop.load()) nap(NanoSeconds::fromMilliSeconds(1));
+}
+
+//------------------------------------------------------------------------------
+//  The line for the named thread (null if none).                               
+//------------------------------------------------------------------------------
+static const ThreadCPU* line(
+    const ThreadCPUStats&   stats
+  , const std::string&      name
+)
+{
+    for (size_t t = 0; t < stats.threads.size(); ++t) {
+        if (stats.threads[t].name == name) return &stats.threads[t];
+    }
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+//  Count the stats published.                                                  
+//------------------------------------------------------------------------------
+class StatsCounter : public lib::msg::Subscriber<ThreadCPUStats>
+{
+    public:
+        StatsCounter() : m_Count(0) { }
+
+        void process(ConstThreadCPUStatsPtr& stats)
+        {
+            if (stats) ++m_Count;
+        }
+
+        size_t m_Count;
+};
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+ThreadMonitorTest::ThreadMonitorTest()
+    : Test("lib::mp::work::ThreadMonitor")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    ThreadMonitorTest object to copy.                           
+//------------------------------------------------------------------------------
+ThreadMonitorTest::ThreadMonitorTest(const ThreadMonitorTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+ThreadMonitorTest::~ThreadMonitorTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+/// @param  that    The ThreadMonitorTest object to copy.                       
+//------------------------------------------------------------------------------
+ThreadMonitorTest& ThreadMonitorTest::operator=(const ThreadMonitorTest& that)
+{
+    Test::operator=(that);
+    return *this;
+} // ThreadMonitorTest::operator=(const ThreadMonitorTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Test the history ring, a busy and an idle thread sampled by hand,    
+///        and the monitor run as a Threadable.                                 
+//------------------------------------------------------------------------------
+void ThreadMonitorTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  CPUHistory keeps the last capacity samples, oldest first.               
+    //--------------------------------------------------------------------------
+    {
+        CPUHistory history(4);
+        TEST(history.recent().empty());
+
+        for (int s = 1; s <= 10; ++s) history.push(float(s));
+        TEST_IS_EQUAL(history.count(), 10);
+
+        const std::vector<float> all(history.recent());
+        TEST_IS_EQUAL(all.size(), 4);
+        TEST_IS_EQUAL(all.front(), 7);
+        TEST_IS_EQUAL(all.back(), 10);
+
+        const std::vector<float> two(history.recent(2));
+        TEST_IS_EQUAL(two.size(), 2);
+        TEST_IS_EQUAL(two.front(), 9);
+
+        CPUHistory none(0);
+        none.push(5);
+        TEST_IS_EQUAL(none.capacity(), 1);
+        TEST_IS_EQUAL(none.recent().size(), 1);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Sampled by hand:  the spinner is busy, the napper is not.               
+    //--------------------------------------------------------------------------
+    {
+        s_Stop.store(false);
+        Thread busy("monitor test spinner", spin);
+        Thread lazy("monitor test napper", idle);
+        nap(NanoSeconds::fromMilliSeconds(20));
+
+        ThreadMonitor monitor(NanoSeconds::fromMilliSeconds(20), 8);
+        TEST(!monitor.latest());
+
+        ConstThreadCPUStatsPtr first(monitor.sample());
+        TEST(line(*first, "monitor test spinner") == nullptr);
+
+        nap(NanoSeconds::fromMilliSeconds(200));
+        ConstThreadCPUStatsPtr stats(monitor.sample());
+        TEST(monitor.latest() == stats);
+        TEST(stats->period.count() >= 200000000);
+
+        const ThreadCPU* spinner(line(*stats, "monitor test spinner"));
+        const ThreadCPU* napper(line(*stats, "monitor test napper"));
+        TEST(spinner != nullptr);
+        TEST(napper != nullptr);
+
+        if (spinner != nullptr && napper != nullptr) {
+            TEST(spinner->current > 30);
+            TEST(spinner->current <= 105);
+            TEST(napper->current < 10);
+            TEST_IS_EQUAL(spinner->history->count(), 1);
+            TEST_IS_EQUAL(spinner->peak, spinner->current);
+
+            const std::vector<std::string> hot(stats->saturated(30));
+            TEST(
+                std::find(hot.begin(), hot.end(), "monitor test spinner")
+             != hot.end()
+            );
+            TEST(
+                std::find(hot.begin(), hot.end(), "monitor test napper")
+             == hot.end()
+            );
+        }
+        TEST(stats->threads.front().current >= stats->threads.back().current);
+
+        //----------------------------------------------------------------------
+        //  Finished threads are dropped (though still registered).             
+        //----------------------------------------------------------------------
+        s_Stop.store(true);
+        busy.join();
+        lazy.join();
+
+        stats = monitor.sample();
+        TEST(line(*stats, "monitor test spinner") == nullptr);
+        TEST(line(*stats, "monitor test napper") == nullptr);
+    }
+
+    //--------------------------------------------------------------------------
+    //  Run as a Threadable:  publishes each period until stopped.              
+    //--------------------------------------------------------------------------
+    {
+        ThreadableCollection threads;
+
+        lib::ds::shared_ptr<ThreadMonitor> monitor;
+        lib::new_shared(monitor, NanoSeconds::fromMilliSeconds(5), 16);
+        threads.push_back(monitor);
+
+        lib::ds::shared_ptr<StatsCounter> counter;
+        lib::new_shared(counter);
+        threads.push_back(counter);
+
+        monitor->connect(counter);
+
+        threads.startAll();
+        nap(NanoSeconds::fromMilliSeconds(100));
+        monitor->stop();
+        threads.joinAll();
+
+        TEST(counter->m_Count >= 5);
+        TEST(counter->m_Count <= 25);
+        TEST(monitor->latest());
+
+        //----------------------------------------------------------------------
+        //  The monitor's own thread was running (and sampled) throughout.      
+        //----------------------------------------------------------------------
+        TEST(line(*monitor->latest(), "thread monitor") != nullptr);
+    }
+
+} // void ThreadMonitorTest::runTest() //
+
+} // namespace test
+} // namespace work
+} // namespace mp
+} // namespace lib
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_threadmonitortest.h                                        
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_THREADMONITORTEST_H
+#define LIB_MP_WORK_THREADMONITORTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace mp {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: ThreadMonitorTest                                                
+///                                                                             
+///@par Purpose:                                                                
+///         The ThreadMonitorTest class provides the regression test for        
+///         the lib::mp::work::ThreadMonitor and lib::mp::work::CPUHistory      
+///         classes.                                                            
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ThreadMonitorTest : public dev::test::work::Test {
+    public:
+        ThreadMonitorTest();
+        ThreadMonitorTest(const ThreadMonitorTest& that);
+        virtual ~ThreadMonitorTest();
+        ThreadMonitorTest& operator=(const ThreadMonitorTest& that);
+
+    protected:
+        void runTest();
+
+    private:
+
+}; //  class ThreadMonitorTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace mp
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_MP_WORK_THREADMONITORTEST_H //
@@ -0,0 +1,260 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_threadplacement.cpp                                        
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   Which CPUs (and memory node) a thread runs on and how it is         
+///         scheduled.                                                          
+///                                                                             
+///@par Memory Node                                                             
+///         setNode restricts the thread to the node's CPUs and, where the      
+///         kernel allows, makes the node the thread's preferred memory node    
+///         (set_mempolicy MPOL_PREFERRED).  Either way, memory the thread      
+///         first touches ends up on that node.                                 
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_mp_work_threadplacement.h"
+#include "lib_string.h"
+
+#include <errno.h>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdio.h>
+#include <system_error>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///@brief   Read a sysfs CPU list (e.g., "0-3,8-11").                           
+///@return  The CPUs listed; empty if the file could not be read.               
+//------------------------------------------------------------------------------
+static std::vector<int> readCpuList(const std::string& path)
+{
+    std::vector<int> result;
+
+    std::ifstream file(path.c_str());
+    std::string list;
+    if (!std::getline(file, list)) return result;
+
+    std::istringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        int first;
+        int last;
+        int n(sscanf(range.c_str(), "%d-%d", &first, &last));
+        if (n < 1) continue;
+        if (n == 1) last = first;
+
+        for (int cpu = first; cpu <= last; ++cpu) {
+            result.push_back(cpu);
+        }
+    }
+
+    return result;
+
+} // static std::vector<int> readCpuList(const std::string& path) //
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+ThreadPlacement::ThreadPlacement()
+    : m_Node(-1)
+    , m_Policy(Policy::inherit)
+    , m_Priority(0)
+{
+} // ThreadPlacement::ThreadPlacement() //
+
+//------------------------------------------------------------------------------
+///@brief   Restrict the thread to the given CPUs.                              
+//------------------------------------------------------------------------------
+void ThreadPlacement::setCpus(const std::vector<int>& cpus)
+{
+    m_Cpus = cpus;
+
+} // void ThreadPlacement::setCpus() //
+
+//------------------------------------------------------------------------------
+///@brief   Restrict the thread to the CPUs (and memory) of the NUMA node.      
+///@note    Replaces any CPUs given to setCpus.                                 
+//------------------------------------------------------------------------------
+void ThreadPlacement::setNode(int node)
+{
+    m_Node = node;
+    m_Cpus = nodeCpus(node);
+
+} // void ThreadPlacement::setNode(int node) //
+
+//------------------------------------------------------------------------------
+///@brief   Set the scheduling policy and priority.                             
+///@param   priority    For fifo and roundRobin, 1 (low) - 99 (high); must be   
+///                     zero for the others.                                    
+//------------------------------------------------------------------------------
+void ThreadPlacement::setPolicy(Policy policy, int priority)
+{
+    m_Policy = policy;
+    m_Priority = priority;
+
+} // void ThreadPlacement::setPolicy() //
+
+//------------------------------------------------------------------------------
+///@brief   Return true if applying the placement would change nothing.         
+//------------------------------------------------------------------------------
+bool ThreadPlacement::isDefault() const
+{
+    return m_Cpus.empty() && m_Node < 0 && m_Policy == Policy::inherit;
+
+} // bool ThreadPlacement::isDefault() const //
+
+//------------------------------------------------------------------------------
+///@brief   Apply the placement to the thread.                                  
+///@note    Meant to be called by the thread itself (the memory node policy     
+///         only applies to the calling thread).                                
+///@return  A description of what could not be applied; empty if all was well.  
+//------------------------------------------------------------------------------
+std::string ThreadPlacement::apply(
+    boost::thread::native_handle_type handle
+) const
+{
+    std::string result;
+
+    #ifdef _WIN32
+    if (!m_Cpus.empty()) {
+        DWORD_PTR mask(0);
+        for (size_t c = 0; c < m_Cpus.size(); ++c) {
+            if (m_Cpus[c] < int(sizeof(mask) * 8)) {
+                mask |= DWORD_PTR(1) << m_Cpus[c];
+            }
+        }
+        if (SetThreadAffinityMask(handle, mask) == 0) {
+            result += "affinity: SetThreadAffinityMask failed; ";
+        }
+    }
+
+    if (m_Policy != Policy::inherit) {
+        if (!SetThreadPriority(handle, m_Priority)) {
+            result += "priority: SetThreadPriority failed; ";
+        }
+    }
+    #else
+    if (!m_Cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (size_t c = 0; c < m_Cpus.size(); ++c) {
+            if (m_Cpus[c] >= 0 && m_Cpus[c] < CPU_SETSIZE) {
+                CPU_SET(m_Cpus[c], &set);
+            }
+        }
+
+        int error(pthread_setaffinity_np(handle, sizeof(set), &set));
+        if (error != 0) {
+            result += "affinity: ";
+            result += std::generic_category().message(error) + "; ";
+        }
+    }
+
+    #ifdef SYS_set_mempolicy
+    if (m_Node >= 0 && m_Node < int(sizeof(unsigned long) * 8)) {
+        const int preferred(1);             // MPOL_PREFERRED, <numaif.h>
+        unsigned long mask(1UL << m_Node);
+        if (syscall(SYS_set_mempolicy, preferred, &mask, sizeof(mask) * 8)) {
+            int error(errno);
+            result += "memory node: ";
+            result += std::generic_category().message(error) + "; ";
+        }
+    }
+    #endif
+
+    if (m_Policy != Policy::inherit) {
+        int policy(SCHED_OTHER);
+        switch (m_Policy) {
+            case Policy::fifo:       policy = SCHED_FIFO;   break;
+            case Policy::roundRobin: policy = SCHED_RR;     break;
+            #ifdef SCHED_BATCH
+            case Policy::batch:      policy = SCHED_BATCH;  break;
+            #endif
+            #ifdef SCHED_IDLE
+            case Policy::idle:       policy = SCHED_IDLE;   break;
+            #endif
+            default:                 policy = SCHED_OTHER;  break;
+        }
+
+        sched_param param;
+        param.sched_priority = m_Priority;
+
+        int error(pthread_setschedparam(handle, policy, &param));
+        if (error != 0) {
+            result += "policy: ";
+            result += std::generic_category().message(error) + "; ";
+        }
+    }
+    #endif
+
+    return result;
+
+} // std::string ThreadPlacement::apply() const //
+
+//------------------------------------------------------------------------------
+///@brief   Return the CPUs of the NUMA node (empty if unknown).                
+//------------------------------------------------------------------------------
+std::vector<int> ThreadPlacement::nodeCpus(int node)
+{
+    return readCpuList(
+        lib::format("/sys/devices/system/node/node%d/cpulist", node)
+    );
+
+} // std::vector<int> ThreadPlacement::nodeCpus(int node) //
+
+//------------------------------------------------------------------------------
+///@brief   Return the groups of CPUs that share a last level (L3) cache.       
+///@note    Falls back to the NUMA nodes, and then to one group holding every   
+///         CPU, when the cache topology is not available.                      
+//------------------------------------------------------------------------------
+std::vector<std::vector<int> > ThreadPlacement::coreComplexes()
+{
+    std::set<std::vector<int> > groups;
+
+    int cpus(int(boost::thread::hardware_concurrency()));
+    for (int cpu = 0; cpu < cpus; ++cpu) {
+        std::vector<int> shared(
+            readCpuList(
+                lib::format(
+                    "/sys/devices/system/cpu/cpu%d/cache/index3/shared_cpu_list"
+                  , cpu
+                )
+            )
+        );
+        if (!shared.empty()) groups.insert(shared);
+    }
+
+    if (groups.empty()) {
+        for (int node = 0; ; ++node) {
+            std::vector<int> shared(nodeCpus(node));
+            if (shared.empty()) break;
+            groups.insert(shared);
+        }
+    }
+
+    if (groups.empty()) {
+        std::vector<int> all;
+        for (int cpu = 0; cpu < cpus; ++cpu) all.push_back(cpu);
+        groups.insert(all);
+    }
+
+    return std::vector<std::vector<int> >(groups.begin(), groups.end());
+
+} // std::vector<std::vector<int> > ThreadPlacement::coreComplexes() //
+
+} // namespace work //
+} // namespace mp //
+} // namespace lib //
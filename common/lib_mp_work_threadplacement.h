@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_threadplacement.h                                          
+///@brief Holds lib::mp::work::ThreadPlacement:  which CPUs (and memory node) a 
+///       thread runs on and how it is scheduled.                               
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_THREADPLACEMENT_H_FILE_GUARD
+#define LIB_MP_WORK_THREADPLACEMENT_H_FILE_GUARD
+
+#include <boost/thread.hpp>
+#include <string>
+#include <vector>
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   The CPU affinity, memory node, scheduling policy and priority to    
+///         give a thread.                                                      
+///                                                                             
+///@par Purpose:                                                                
+///         On a multi-socket machine the scheduler is free to move a thread    
+///         to the other socket, away from both its data and the threads it     
+///         exchanges data with.  A ThreadPlacement given to a Threadable (or   
+///         Thread) is applied by the thread itself as it starts, so the        
+///         thread never runs (or allocates) anywhere else.                     
+///\n\n                                                                         
+///         A default constructed ThreadPlacement changes nothing.              
+///                                                                             
+///@par Expected Usage:                                                         
+///         @code                                                               
+///             lib::mp::work::ThreadPlacement placement;                       
+///             placement.setNode(1);                                           
+///             placement.setPolicy(                                            
+///                 lib::mp::work::ThreadPlacement::Policy::fifo                
+///               , 10                                                          
+///             );                                                              
+///             decoder->setPlacement(placement);                               
+///         @endcode                                                            
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ThreadPlacement
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   The scheduling policy (see sched(7)).                       
+        //----------------------------------------------------------------------
+        enum class Policy
+        {
+            inherit         ///< Leave the policy (and priority) alone.
+          , other           ///< SCHED_OTHER; the normal time sharing policy.
+          , fifo            ///< SCHED_FIFO (real time; needs privilege).
+          , roundRobin      ///< SCHED_RR (real time; needs privilege).
+          , batch           ///< SCHED_BATCH (Linux only).
+          , idle            ///< SCHED_IDLE (Linux only).
+        };
+
+        ThreadPlacement();
+
+        void setCpus(const std::vector<int>& cpus);
+        void setNode(int node);
+        void setPolicy(Policy policy, int priority = 0);
+
+        const std::vector<int>& cpus() const { return m_Cpus; }
+        int node() const { return m_Node; }
+        Policy policy() const { return m_Policy; }
+        int priority() const { return m_Priority; }
+
+        bool isDefault() const;
+
+        std::string apply(boost::thread::native_handle_type handle) const;
+
+        //======================================================================
+        //  static methods                                                      
+        //======================================================================
+        static std::vector<int> nodeCpus(int node);
+        static std::vector<std::vector<int> > coreComplexes();
+
+    private:
+        std::vector<int>    m_Cpus;
+        int                 m_Node;
+        Policy              m_Policy;
+        int                 m_Priority;
+
+}; // class ThreadPlacement //
+
+} // namespace work //
+} // namespace mp //
+} // namespace lib //
+
+#endif // #ifndef LIB_MP_WORK_THREADPLACEMENT_H_FILE_GUARD
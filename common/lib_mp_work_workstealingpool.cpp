@@ -0,0 +1,235 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_workstealingpool.cpp                                       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@brief   A fixed set of threads that run lib::mp::work::Task objects.        
+///                                                                             
+///@par Going To Sleep                                                          
+///         submit increments m_Pending and then looks at m_Sleeping; a worker  
+///         increments m_Sleeping (under m_IdleMutex) and then looks at         
+///         m_Pending.  At least one of them sees the other's increment, so a   
+///         worker never sleeps through a submitted task.                       
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_mp_work_workstealingpool.h"
+#include "lib_mp_work_thread.h"
+
+#include <atomic>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <deque>
+#include <string>
+#include <vector>
+
+#ifdef IS_VISUAL_STUDIO
+    #define LIB_MP_WORK_THREAD_LOCAL __declspec(thread)
+#else
+    #define LIB_MP_WORK_THREAD_LOCAL __thread
+#endif
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///@brief   The pool (and the worker within it) the calling thread belongs to.  
+//------------------------------------------------------------------------------
+static LIB_MP_WORK_THREAD_LOCAL const void* s_Pool(nullptr);
+static LIB_MP_WORK_THREAD_LOCAL size_t s_Worker(0);
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+struct WorkStealingPool::Data
+{
+    struct Worker
+    {
+        boost::mutex        m_Mutex;
+        std::deque<Task*>   m_Tasks;
+    };
+
+    Data()
+        : m_Pending(0)
+        , m_Sleeping(0)
+        , m_Next(0)
+        , m_Stop(false)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    ///@brief   Worker thread main.                                             
+    //--------------------------------------------------------------------------
+    void operator()(size_t index)
+    {
+        s_Pool = this;
+        s_Worker = index;
+
+        while (!m_Stop) {
+            Task* task(take(index));
+            if (task != nullptr) {
+                task->run();
+                continue;
+            }
+
+            boost::unique_lock<boost::mutex> lock(m_IdleMutex);
+            ++m_Sleeping;
+            while (m_Pending == 0 && !m_Stop) {
+                m_Idle.wait(lock);
+            }
+            --m_Sleeping;
+        }
+
+        s_Pool = nullptr;
+    }
+
+    //--------------------------------------------------------------------------
+    ///@brief   Queue the task with the given worker and wake a sleeper.        
+    //--------------------------------------------------------------------------
+    void submit(size_t index, Task* task)
+    {
+        {
+            boost::mutex::scoped_lock lock(m_Workers[index]->m_Mutex);
+            m_Workers[index]->m_Tasks.push_back(task);
+        }
+
+        ++m_Pending;
+
+        if (m_Sleeping > 0) {
+            boost::mutex::scoped_lock lock(m_IdleMutex);
+            m_Idle.notify_one();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    ///@brief   Take the next task from our own queue, else steal one.          
+    ///@return  nullptr if every queue is empty.                                
+    //--------------------------------------------------------------------------
+    Task* take(size_t index)
+    {
+        for (size_t i = 0; i < m_Workers.size(); ++i) {
+            Worker& worker(*m_Workers[(index + i) % m_Workers.size()]);
+
+            boost::mutex::scoped_lock lock(worker.m_Mutex);
+            if (!worker.m_Tasks.empty()) {
+                Task* task;
+                if (i == 0) {
+                    task = worker.m_Tasks.front();
+                    worker.m_Tasks.pop_front();
+                } else {
+                    task = worker.m_Tasks.back();
+                    worker.m_Tasks.pop_back();
+                }
+                --m_Pending;
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::vector<std::unique_ptr<Worker> >   m_Workers;
+    std::vector<ThreadPtr>                  m_Threads;
+
+    boost::mutex                m_IdleMutex;
+    boost::condition_variable   m_Idle;
+
+    std::atomic<size_t>         m_Pending;
+    std::atomic<size_t>         m_Sleeping;
+    std::atomic<size_t>         m_Next;
+    std::atomic<bool>           m_Stop;
+};
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+WorkStealingPool::WorkStealingPool(size_t size)
+    : m_Data(new Data)
+{
+    if (size == 0) size = boost::thread::hardware_concurrency();
+    if (size == 0) size = 1;
+
+    for (size_t i = 0; i < size; ++i) {
+        m_Data->m_Workers.push_back(
+            std::unique_ptr<Data::Worker>(new Data::Worker)
+        );
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        m_Data->m_Threads.push_back(
+            ThreadPtr(
+                new Thread("pool-" + std::to_string(i), m_Data.get(), i)
+            )
+        );
+    }
+
+} // WorkStealingPool::WorkStealingPool() //
+
+//------------------------------------------------------------------------------
+///@brief   Stop (and join) the workers.                                        
+//------------------------------------------------------------------------------
+WorkStealingPool::~WorkStealingPool()
+{
+    stop();
+
+} // WorkStealingPool::~WorkStealingPool() //
+
+//------------------------------------------------------------------------------
+///@brief   Queue the task to be run.                                           
+//------------------------------------------------------------------------------
+void WorkStealingPool::submit(Task* task)
+{
+    size_t index;
+    if (s_Pool == m_Data.get()) {
+        index = s_Worker;
+    } else {
+        index = m_Data->m_Next++ % m_Data->m_Workers.size();
+    }
+
+    m_Data->submit(index, task);
+
+} // void WorkStealingPool::submit(Task* task) //
+
+//------------------------------------------------------------------------------
+///@brief   Return the number of worker threads.                                
+//------------------------------------------------------------------------------
+size_t WorkStealingPool::size() const
+{
+    return m_Data->m_Workers.size();
+
+} // size_t WorkStealingPool::size() const //
+
+//------------------------------------------------------------------------------
+///@brief   Stop the workers once they finish the task at hand and join them.   
+///@note    Tasks still queued are not run; join the tasks first.               
+//------------------------------------------------------------------------------
+void WorkStealingPool::stop()
+{
+    {
+        boost::mutex::scoped_lock lock(m_Data->m_IdleMutex);
+        m_Data->m_Stop = true;
+        m_Data->m_Idle.notify_all();
+    }
+
+    for (size_t i = 0; i < m_Data->m_Threads.size(); ++i) {
+        if (m_Data->m_Threads[i]->joinable()) {
+            m_Data->m_Threads[i]->join();
+        }
+    }
+
+} // void WorkStealingPool::stop() //
+
+//------------------------------------------------------------------------------
+///@brief   Return true if the calling thread is a worker of any pool.          
+///@note    Used to keep a worker from waiting on a full queue that only        
+///         another task (possibly queued behind it) would empty.               
+//------------------------------------------------------------------------------
+bool WorkStealingPool::isWorkerThread()
+{
+    return s_Pool != nullptr;
+
+} // bool WorkStealingPool::isWorkerThread() //
+
+} // namespace work //
+} // namespace mp //
+} // namespace lib //
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+///@file lib_mp_work_workstealingpool.h                                         
+///@brief Holds lib::mp::work::WorkStealingPool, a fixed set of threads that    
+///       run lib::mp::work::Task objects.                                      
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_MP_WORK_WORKSTEALINGPOOL_H_FILE_GUARD
+#define LIB_MP_WORK_WORKSTEALINGPOOL_H_FILE_GUARD
+
+#include "lib_mp_work_task.h"
+
+#include <memory>
+#include <stddef.h>
+
+namespace lib {
+namespace mp {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   A fixed number of worker threads running whichever Tasks have work. 
+///                                                                             
+///@par Purpose:                                                                
+///         A chain of a hundred Subscribers needs a hundred threads, most of   
+///         them asleep and each one costing a context switch per hand-off.     
+///         The pool runs the same Subscribers as Tasks on (by default) one     
+///         thread per core.                                                    
+///                                                                             
+///@par Design                                                                  
+///         Each worker has its own queue of tasks.  A task submitted from a    
+///         worker goes to that worker's queue (the data it was handed is       
+///         likely still in that core's cache); one submitted from elsewhere    
+///         goes to the workers in turn.  A worker takes from the front of its  
+///         own queue and, when that is empty, steals from the back of the      
+///         others' before going to sleep.                                      
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class WorkStealingPool
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@param   size    The number of worker threads; 0 = one per hardware  
+        ///                 thread.                                             
+        //----------------------------------------------------------------------
+        explicit WorkStealingPool(size_t size = 0);
+        virtual ~WorkStealingPool();
+
+        void submit(Task* task);
+        size_t size() const;
+        void stop();
+
+        static bool isWorkerThread();
+
+    private:
+        WorkStealingPool(const WorkStealingPool& that);
+        WorkStealingPool& operator=(const WorkStealingPool& that);
+
+        struct Data;
+        std::unique_ptr<Data> m_Data;
+
+}; // class WorkStealingPool //
+
+} // namespace work //
+} // namespace mp //
+} // namespace lib //
+
+#endif // #ifndef LIB_MP_WORK_WORKSTEALINGPOOL_H_FILE_GUARD
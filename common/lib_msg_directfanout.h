@@ -0,0 +1,252 @@
+//------------------------------------------------------------------------------
+///@file lib_msg_directfanout.h                                                 
+///@brief Holds the lib::msg::DirectFanOut template and the policies used to    
+///       choose how a lib::msg::Publication reaches its subscriptions.         
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+#ifndef LIB_MSG_DIRECTFANOUT_H_FILE_GUARD
+#define LIB_MSG_DIRECTFANOUT_H_FILE_GUARD
+
+#include "lib_ds_shared_ptr.h"
+#include "lib_msg_subscription.h"
+
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace lib {
+namespace msg {
+
+//------------------------------------------------------------------------------
+///@brief   Fan out policy:  a Publication reaches its subscriptions through    
+///         boost::signals2 (the default).                                      
+//------------------------------------------------------------------------------
+struct SignalFanOutPolicy { };
+
+//------------------------------------------------------------------------------
+///@brief   Fan out policy:  a Publication reaches its subscriptions through a  
+///         lib::msg::DirectFanOut.                                             
+//------------------------------------------------------------------------------
+struct DirectFanOutPolicy { };
+
+//------------------------------------------------------------------------------
+///@brief   Select how Publication<TYPE> reaches its subscriptions.             
+///                                                                             
+///@par Expected Usage:                                                         
+///         Specialize it (before any Publication<MyType> is used) for the      
+///         types published at a high rate:                                     
+///         @code                                                               
+///             namespace lib { namespace msg {                                 
+///             template <> struct PublicationFanOutPolicy<MyType>              
+///             {                                                               
+///                 using type = lib::msg::DirectFanOutPolicy;                  
+///             };                                                              
+///             } }                                                             
+///         @endcode                                                            
+//------------------------------------------------------------------------------
+template <typename TYPE>
+struct PublicationFanOutPolicy
+{
+    using type = lib::msg::SignalFanOutPolicy;
+};
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   The subscriptions of a Publication kept as a copy-on-write vector   
+///         of direct targets.                                                  
+///                                                                             
+///@par Purpose:                                                                
+///         Emitting a boost::signals2::signal locks the signal's mutex, walks  
+///         the slot list (checking each connection) and calls through the      
+///         boost::bind object.  DirectFanOut instead keeps a vector of         
+///         (Subscription*, function) pairs.  A publish takes a snapshot of the 
+///         vector (one atomic shared pointer load) and calls each target.      
+///\n\n                                                                         
+///         Connecting and disconnecting build a new vector (under a mutex) and 
+///         swap it in.  A publish already in flight finishes with the vector   
+///         it started with, so subscriptions may come and go while publishing. 
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+template <typename TYPE>
+class DirectFanOut
+{
+    public:
+        using Item = lib::ds::shared_ptr<const TYPE>;
+        using Batch = std::vector<Item>;
+
+        DirectFanOut() : m_State(std::make_shared<State>())
+        {
+            m_State->m_Targets = std::make_shared<const Targets>();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Add the subscription to those published to.                 
+        ///@return  The function that removes the subscription again; it may be 
+        ///         called after this object is gone (it then does nothing).    
+        //----------------------------------------------------------------------
+        template <typename SUB_TYPE>
+        std::function<void ()> connect(Subscription<SUB_TYPE>& sub)
+        {
+            Target target;
+            target.m_Subscription = &sub;
+            target.m_Inbox = &DirectFanOut::template inbox<SUB_TYPE>;
+            target.m_InboxBatch = &DirectFanOut::template inboxBatch<SUB_TYPE>;
+
+            {
+                boost::mutex::scoped_lock lock(m_State->m_Mutex);
+                std::shared_ptr<Targets> targets(
+                    std::make_shared<Targets>(*m_State->m_Targets)
+                );
+                targets->push_back(target);
+                std::atomic_store(
+                    &m_State->m_Targets
+                  , std::shared_ptr<const Targets>(targets)
+                );
+            }
+
+            std::weak_ptr<State> weak(m_State);
+            void* subscription(&sub);
+            return [weak, subscription]() {
+                std::shared_ptr<State> state(weak.lock());
+                if (state) state->remove(subscription);
+            };
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Hand the item to each connected subscription.               
+        //----------------------------------------------------------------------
+        void publish(const Item& item) const
+        {
+            std::shared_ptr<const Targets> targets(
+                std::atomic_load(&m_State->m_Targets)
+            );
+
+            for (size_t i = 0; i < targets->size(); ++i) {
+                const Target& t((*targets)[i]);
+                t.m_Inbox(t.m_Subscription, item);
+            }
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Hand the batch to each connected subscription.              
+        //----------------------------------------------------------------------
+        void publishBatch(const lib::ds::shared_ptr<const Batch>& items) const
+        {
+            std::shared_ptr<const Targets> targets(
+                std::atomic_load(&m_State->m_Targets)
+            );
+
+            for (size_t i = 0; i < targets->size(); ++i) {
+                const Target& t((*targets)[i]);
+                t.m_InboxBatch(t.m_Subscription, items);
+            }
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Return the number of subscriptions connected.               
+        //----------------------------------------------------------------------
+        size_t size() const
+        {
+            return std::atomic_load(&m_State->m_Targets)->size();
+        }
+
+    private:
+        DirectFanOut(const DirectFanOut& that);
+        DirectFanOut& operator=(const DirectFanOut& that);
+
+        struct Target
+        {
+            void*   m_Subscription;
+            void    (*m_Inbox)(void* sub, const Item& item);
+            void    (*m_InboxBatch)(
+                        void* sub
+                      , const lib::ds::shared_ptr<const Batch>& items
+                    );
+        };
+        using Targets = std::vector<Target>;
+
+        //----------------------------------------------------------------------
+        ///@brief   What the disconnect functions share with this object.       
+        ///@note    std::shared_ptr (not lib::ds) for std::atomic_load/store.   
+        //----------------------------------------------------------------------
+        struct State
+        {
+            void remove(void* subscription)
+            {
+                boost::mutex::scoped_lock lock(m_Mutex);
+                std::shared_ptr<Targets> targets(
+                    std::make_shared<Targets>(*m_Targets)
+                );
+                for (size_t i = 0; i < targets->size(); ++i) {
+                    if ((*targets)[i].m_Subscription == subscription) {
+                        targets->erase(targets->begin() + i);
+                        break;
+                    }
+                }
+                std::atomic_store(
+                    &m_Targets
+                  , std::shared_ptr<const Targets>(targets)
+                );
+            }
+
+            boost::mutex                        m_Mutex;
+            std::shared_ptr<const Targets>      m_Targets;
+        };
+
+        template <typename SUB_TYPE>
+        static void inbox(void* sub, const Item& item)
+        {
+            static_cast<Subscription<SUB_TYPE>*>(sub)->inbox(item);
+        }
+
+        template <typename SUB_TYPE>
+        static void inboxBatch(
+            void* sub
+          , const lib::ds::shared_ptr<const Batch>& items
+        )
+        {
+            deliverBatch(static_cast<Subscription<SUB_TYPE>*>(sub), items);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   The batch is for a base (or convertible) type; it has to be 
+        ///         rebuilt with the other type.                                
+        //----------------------------------------------------------------------
+        template <typename SUB_TYPE>
+        static void deliverBatch(
+            Subscription<SUB_TYPE>* sub
+          , const lib::ds::shared_ptr<const Batch>& items
+        )
+        {
+            typedef typename Subscription<SUB_TYPE>::Batch SubBatch;
+
+            lib::ds::shared_ptr<SubBatch> converted(new SubBatch);
+            converted->reserve(items->size());
+            for (size_t i = 0; i < items->size(); ++i) {
+                converted->push_back((*items)[i]);
+            }
+            sub->inboxBatch(lib::ds::shared_ptr<const SubBatch>(converted));
+        }
+
+        static void deliverBatch(
+            Subscription<TYPE>* sub
+          , const lib::ds::shared_ptr<const Batch>& items
+        )
+        {
+            sub->inboxBatch(items);
+        }
+
+        std::shared_ptr<State>  m_State;
+
+}; // class DirectFanOut //
+
+} // namespace msg //
+} // namespace lib //
+
+#endif // #ifndef LIB_MSG_DIRECTFANOUT_H_FILE_GUARD
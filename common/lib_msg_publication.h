@@ -7,12 +7,15 @@
 #define LIB_MSG_PUBLICATION_H_FILE_GUARD
 
 #include "lib_ds_shared_ptr.h"
+#include "lib_msg_directfanout.h"
 #include "lib_msg_publisherbase.h"
 #include "lib_msg_subscription.h"
 #include <boost/signals2.hpp>
 #include <boost/type_traits/is_base_and_derived.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <stdint.h>
+#include <type_traits>
+#include <vector>
 
 namespace lib {
 namespace msg {
@@ -34,6 +37,12 @@ namespace msg {
 ///         signal to allow subscribers to know that the publisher is shutting  
 ///         down.                                                               
 ///                                                                             
+///@par Fan Out                                                                 
+///         By default the subscriptions are reached via boost::signals2.       
+///         Specializing PublicationFanOutPolicy<TYPE> to DirectFanOutPolicy    
+///         selects the lighter lib::msg::DirectFanOut instead; see             
+///         lib_msg_directfanout.h.                                             
+///                                                                             
 ///@par Thread Safety:  class                                                   
 ///                                                                             
 ///@tparam  TYPE    The base type of the objects being dealt with (why worded   
@@ -52,6 +61,12 @@ namespace msg {
 ///                             modified version.  Let's save ourselves that    
 ///                             headache and only allow @e const objects.       
 ///                                                                             
+///@version 2026-10-16  DHF     Tell each subscription who its publisher is.    
+///                                                                             
+///@version 2026-10-16  DHF     Added PublicationFanOutPolicy / DirectFanOut.   
+///                                                                             
+///@version 2026-10-16  DHF     Added publishBatch.                             
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -102,7 +117,43 @@ class Publication
         ///         can publish multiple data types.\n\n                        
         //----------------------------------------------------------------------
         void publish(lib::ds::shared_ptr<const TYPE> item) {
-            m_PublishSignal(item);
+            if (s_Direct) {
+                m_DirectFanOut.publish(item);
+            } else {
+                m_PublishSignal(item);
+            }
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief A group of items published (and queued) together.             
+        //----------------------------------------------------------------------
+        using Batch = std::vector<lib::ds::shared_ptr<const TYPE> >;
+
+        //----------------------------------------------------------------------
+        ///@brief Publish the items as one batch.                               
+        ///@param items The data to be published.  The batch is shared (not     
+        ///             copied) by all of the subscribers, so it must not be    
+        ///             changed after being published.                          
+        ///@note  Each subscriber receives the whole batch with one queue push  
+        ///       (one lock, one wake up) rather than one per item.             
+        //----------------------------------------------------------------------
+        void publishBatch(lib::ds::shared_ptr<const Batch> items) {
+            if (!items || items->empty()) return;
+
+            if (s_Direct) {
+                m_DirectFanOut.publishBatch(items);
+            } else {
+                m_PublishBatchSignal(items);
+            }
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief Publish the items in the range [first, last) as one batch.    
+        //----------------------------------------------------------------------
+        template <typename ITERATOR>
+        void publishBatch(ITERATOR first, ITERATOR last) {
+            lib::ds::shared_ptr<Batch> items(new Batch(first, last));
+            publishBatch(lib::ds::shared_ptr<const Batch>(items));
         }
 
         //----------------------------------------------------------------------
@@ -119,7 +170,10 @@ class Publication
             bool derived = boost::is_base_and_derived<SUB_TYPE, TYPE>::value;
 
             uint32_t result(0);
-            if (same || derived) {
+            if ((same || derived) && s_Direct) {
+                connectDirect(sub);
+                result = 1;
+            } else if (same || derived) {
                 boost::signals2::connection connection1(
                     m_PublishSignal.connect(
                         boost::bind(
@@ -137,7 +191,23 @@ class Publication
                   , m_PublicationEndingSignal
                 );
 
-                incrementPublicationCount(sub, connection1, connection2);
+                boost::signals2::connection connection3(
+                    m_PublishBatchSignal.connect(
+                        boost::bind(
+                            &Publication<TYPE>::template forwardBatch<SUB_TYPE>
+                          , &sub
+                          , _1
+                        )
+                    )
+                );
+
+                incrementPublicationCount(
+                    sub
+                  , connection1
+                  , connection2
+                  , connection3
+                );
+                addPublisher(sub, this);
                 result = 1;
             }
             return result;
@@ -154,6 +224,11 @@ class Publication
         //----------------------------------------------------------------------
         uint32_t connect(Subscription<TYPE>& sub)
         {
+            if (s_Direct) {
+                connectDirect(sub);
+                return 1;
+            }
+
             boost::signals2::connection connection1(
                 m_PublishSignal.connect(
                     boost::bind(
@@ -171,7 +246,18 @@ class Publication
               , m_PublicationEndingSignal
             );
 
-            incrementPublicationCount(sub, connection1, connection2);
+            boost::signals2::connection connection3(
+                m_PublishBatchSignal.connect(
+                    boost::bind(
+                        &Subscription<TYPE>::inboxBatch
+                      , &sub
+                      , _1
+                    )
+                )
+            );
+
+            incrementPublicationCount(sub, connection1, connection2, connection3);
+            addPublisher(sub, this);
 
             return 1;
         } 
@@ -193,7 +279,10 @@ class Publication
         //----------------------------------------------------------------------
         ///@brief   Return the number of subscribers in for this publication.   
         //----------------------------------------------------------------------
-        size_t subscriptionCount() const { return m_PublishSignal.num_slots(); }
+        size_t subscriptionCount() const
+        {
+            return s_Direct ? m_DirectFanOut.size() : m_PublishSignal.num_slots();
+        }
 
     protected:
 
@@ -204,6 +293,54 @@ class Publication
         Publication(const Publication& that);
         Publication& operator=(const Publication& that);
 
+        //----------------------------------------------------------------------
+        ///@brief   True = PublicationFanOutPolicy picked DirectFanOut.         
+        //----------------------------------------------------------------------
+        static const bool s_Direct = std::is_same<
+            typename PublicationFanOutPolicy<TYPE>::type
+          , DirectFanOutPolicy
+        >::value;
+
+        //----------------------------------------------------------------------
+        ///@brief   Connect the subscription via m_DirectFanOut.  The ending    
+        ///         signal is still a boost::signals2 signal (it fires once).   
+        //----------------------------------------------------------------------
+        template <typename SUB_TYPE>
+        void connectDirect(Subscription<SUB_TYPE>& sub)
+        {
+            boost::signals2::connection connection2;
+            PublisherBase::connectPublicationEnding(
+                connection2
+              , sub
+              , m_PublicationEndingSignal
+            );
+
+            boost::signals2::connection none;
+            incrementPublicationCount(sub, none, connection2, none);
+            addPublisher(sub, this);
+            addDisconnect(sub, m_DirectFanOut.connect(sub));
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Hand a batch to a Subscription of a base (or convertible)   
+        ///         type; the batch has to be rebuilt with the other type.      
+        //----------------------------------------------------------------------
+        template <typename SUB_TYPE>
+        static void forwardBatch(
+            Subscription<SUB_TYPE>* sub
+          , lib::ds::shared_ptr<const Batch> items
+        )
+        {
+            typedef typename Subscription<SUB_TYPE>::Batch SubBatch;
+
+            lib::ds::shared_ptr<SubBatch> converted(new SubBatch);
+            converted->reserve(items->size());
+            for (size_t i = 0; i < items->size(); ++i) {
+                converted->push_back((*items)[i]);
+            }
+            sub->inboxBatch(lib::ds::shared_ptr<const SubBatch>(converted));
+        }
+
         //----------------------------------------------------------------------
         ///@brief Signal to "emit" when there is data to be published.          
         //----------------------------------------------------------------------
@@ -215,6 +352,18 @@ class Publication
         ///@brief Signal to let our subscribers know that we're shutting down.  
         //----------------------------------------------------------------------
         boost::signals2::signal<void ()> m_PublicationEndingSignal;
+
+        //----------------------------------------------------------------------
+        ///@brief Signal to "emit" when there is a batch of data to publish.    
+        //----------------------------------------------------------------------
+        boost::signals2::signal<
+            void (lib::ds::shared_ptr<const Batch> )
+        > m_PublishBatchSignal;
+
+        //----------------------------------------------------------------------
+        ///@brief Used in place of the above publish signals when s_Direct.     
+        //----------------------------------------------------------------------
+        DirectFanOut<TYPE> m_DirectFanOut;
 };
 
 } // namespace msg
@@ -20,7 +20,10 @@
 #include "lib_msg_publisherconnectionhelper.h"
 #include "lib_string.h"                             // lib::format          
 
+#include <iterator>
 #include <stdint.h>
+#include <type_traits>
+#include <vector>
 
 namespace lib {
 namespace msg {
@@ -65,6 +68,10 @@ namespace msg {
 ///         If you don't want to sacrifice compile-time type checking then      
 ///         just inherit multiple times from Publication versus using Publisher.
 ///                                                                             
+///@version 2026-10-16  DHF     Added publishBatch.                             
+///                                                                             
+///@version 2026-10-16  DHF     connect accepts any Subscriber QUEUE_POLICY.    
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -150,6 +157,33 @@ class Publisher
             this->Publication<TYPE>::publish(temp);
         }
 
+        //----------------------------------------------------------------------
+        ///@brief   Publish a batch of items; see Publication::publishBatch.    
+        //----------------------------------------------------------------------
+        template <typename TYPE>
+        void publishBatch(
+            lib::ds::shared_ptr<
+                const std::vector<lib::ds::shared_ptr<const TYPE> >
+            > items
+        ) {
+            this->Publication<TYPE>::publishBatch(items);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Publish the range [first, last) of shared pointers as one   
+        ///         batch; the type published is taken from the iterator.       
+        //----------------------------------------------------------------------
+        template <typename ITERATOR>
+        void publishBatch(ITERATOR first, ITERATOR last) {
+            typedef typename std::remove_const<
+                typename std::iterator_traits<
+                    ITERATOR
+                >::value_type::element_type
+            >::type TYPE;
+
+            this->Publication<TYPE>::publishBatch(first, last);
+        }
+
         //----------------------------------------------------------------------
         ///@brief   Connect the given subscriber to as many items we publish.   
         ///                                                                     
@@ -182,9 +216,10 @@ class Publisher
           , typename S6
           , typename S7
           , typename S8
+          , typename SQ
         >
         uint32_t connect(
-            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8>& s
+            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8, SQ>& s
           , bool allowConnectDerived = false
           , bool allowConnectConvertible = false
         )
@@ -232,9 +267,10 @@ class Publisher
           , typename S6
           , typename S7
           , typename S8
+          , typename SQ
         >
         uint32_t connect(
-            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8>* s
+            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8, SQ>* s
           , bool allowConnectDerived = false
           , bool allowConnectConvertible = false
         )
@@ -7,6 +7,8 @@
 #define LIB_MSG_PUBLISHERBASE_H_FILE_GUARD
 
 #include <boost/signals2.hpp>
+#include <functional>
+#include "lib_msg_publishersubscriberbase.h"
 #include "lib_msg_subscriptionbase.h"
 
 namespace lib {
@@ -33,6 +35,12 @@ namespace msg {
 ///         that we can declare the Publisher a friend of the Subscriber        
 ///         (indirectly).                                                       
 ///                                                                             
+///@version 2026-10-16  DHF     Added addPublisher.                             
+///                                                                             
+///@version 2026-10-16  DHF     Added addDisconnect.                            
+///                                                                             
+///@version 2026-10-16  DHF     Added the batch connection.                     
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-08-30  DHF     Broke out into file of it's own.                
@@ -62,8 +70,30 @@ class PublisherBase
             SubscriptionBase& sub
           , boost::signals2::connection& connection1
           , boost::signals2::connection& connection2
+          , boost::signals2::connection& connection3
+        ) {
+            sub.incrementPublicationCount(connection1, connection2, connection3);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief Give the SubscriptionBase a function to call to disconnect    
+        ///       (for connections that aren't boost::signals2 connections).    
+        //----------------------------------------------------------------------
+        inline void addDisconnect(
+            SubscriptionBase& sub
+          , const std::function<void ()>& disconnect
+        ) {
+            sub.addDisconnect(disconnect);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief Tell the SubscriptionBase who is publishing to it.            
+        //----------------------------------------------------------------------
+        inline void addPublisher(
+            SubscriptionBase& sub
+          , const PublisherSubscriberBase* publisher
         ) {
-            sub.incrementPublicationCount(connection1, connection2);
+            sub.addPublisher(publisher);
         }
 
         //----------------------------------------------------------------------
@@ -41,6 +41,8 @@ class PublisherProxyBase : public lib::mp::work::ThreadableCollection
 ///         SO VERY MUCH.                                                       
 ///                           -- Death, <i>Hogfather</i> by Terry Pratchett     
 ///                                                                             
+///@version 2026-10-16  DHF     connect accepts any Subscriber QUEUE_POLICY.    
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -104,9 +106,10 @@ class PublisherProxy
           , typename S6
           , typename S7
           , typename S8
+          , typename SQ
         >
         uint32_t connect(
-            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8>& s
+            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8, SQ>& s
           , bool allowConnectDerived = false
           , bool allowConnectConvertible = false
         )
@@ -164,9 +167,10 @@ class PublisherProxy
           , typename S6
           , typename S7
           , typename S8
+          , typename SQ
         >
         uint32_t connect(
-            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8>* s
+            lib::msg::Subscriber<S0, S1, S2, S3, S4, S5, S6, S7, S8, SQ>* s
           , bool allowConnectDerived = false
           , bool allowConnectConvertible = false
         )
@@ -7,6 +7,7 @@
 #define LIB_MSG_PUBLISHERSUBSCRIBERBASE_H_FILE_GUARD
 
 #include <boost/scoped_ptr.hpp>
+#include <vector>
 
 namespace lib {
 namespace msg {
@@ -28,6 +29,8 @@ namespace msg {
 ///                                                                             
 ///@par Thread Safety:  class                                                   
 ///                                                                             
+///@version 2026-10-16  DHF     Added publishers.                               
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-04-14  DHF     Made isPublisher and isSubscriber virtual.      
@@ -46,6 +49,16 @@ class PublisherSubscriberBase
 
         virtual size_t subscriptionCount() const { return 0; }
 
+        //----------------------------------------------------------------------
+        ///@brief   Return the publishers this object has been connected to.    
+        ///@warning The publishers may since have been destroyed; the pointers  
+        ///         are only good for identifying them.                         
+        //----------------------------------------------------------------------
+        virtual std::vector<const PublisherSubscriberBase*> publishers() const
+        {
+            return std::vector<const PublisherSubscriberBase*>();
+        }
+
     protected:
         void setPublisher()  { m_Publisher  = true; }
         void setSubscriber() { m_Subscriber = true; }
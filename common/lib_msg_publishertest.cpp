@@ -20,6 +20,7 @@
 #include "lib_msg_publisher.h"
 
 //#include "lib_boost.h"
+#include "lib_ds_bufferpool.h"
 #include "lib_ds_shared_ptr.h"
 #include "lib_ds_vectorwithoffset.h"
 #include "lib_mp_work_threadablecollection.h"
@@ -27,6 +28,29 @@
 
 #include "debug.h"
 
+#include <chrono>
+
+namespace lib {
+namespace msg {
+namespace test {
+
+struct DirectTick { int m_Value; };
+struct SignalTick { int m_Value; };
+
+} // namespace test //
+
+//------------------------------------------------------------------------------
+//  DirectTick goes through the DirectFanOut; SignalTick keeps the default.     
+//------------------------------------------------------------------------------
+template <>
+struct PublicationFanOutPolicy<test::DirectTick>
+{
+    using type = DirectFanOutPolicy;
+};
+
+} // namespace msg //
+} // namespace lib //
+
 namespace lib {
 namespace msg {
 namespace test {
@@ -221,6 +245,217 @@ using BothSubscriberPtr = lib::ds::shared_ptr<BothSubscriber>;
 //------------------------------------------------------------------------------
 //  Register the test class for the dev_test_work_test_classes.                           
 //------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+//  A bare Subscription (no queue, no thread) that counts what it is handed;    
+//  used to look at the Publication fan out by itself.                          
+//------------------------------------------------------------------------------
+template <typename TYPE>
+class CountingSubscription : public lib::msg::Subscription<TYPE>
+{
+    public:
+        CountingSubscription() : m_Count(0), m_Sum(0), m_Ended(0) { }
+
+        void inbox(lib::ds::shared_ptr<const TYPE> item) override
+        {
+            ++m_Count;
+            m_Sum += item->m_Value;
+        }
+
+        void process(lib::ds::shared_ptr<const TYPE>& item) override { }
+
+        int publicationCount() const override
+        {
+            return int(m_Connections.size() / 3);
+        }
+
+        void disconnect()
+        {
+            for (size_t d = 0; d < m_Disconnects.size(); ++d) {
+                m_Disconnects[d]();
+            }
+            for (size_t c = 0; c < m_Connections.size(); ++c) {
+                m_Connections[c].disconnect();
+            }
+        }
+
+        int         m_Count;
+        int64_t     m_Sum;
+        int         m_Ended;
+
+    private:
+        void incrementPublicationCount(
+            boost::signals2::connection& connection1
+          , boost::signals2::connection& connection2
+          , boost::signals2::connection& connection3
+        ) override
+        {
+            m_Connections.push_back(connection1);
+            m_Connections.push_back(connection2);
+            m_Connections.push_back(connection3);
+        }
+
+        void publicationEnding() override { ++m_Ended; }
+
+        void addDisconnect(const std::function<void ()>& disconnect) override
+        {
+            m_Disconnects.push_back(disconnect);
+        }
+
+        std::vector<boost::signals2::connection>    m_Connections;
+        std::vector<std::function<void ()> >        m_Disconnects;
+};
+
+//------------------------------------------------------------------------------
+//  On its first item, disconnects itself and connects another subscription --  
+//  all in the middle of a publish.                                             
+//------------------------------------------------------------------------------
+class ReconnectingSubscription : public CountingSubscription<DirectTick>
+{
+    public:
+        ReconnectingSubscription(
+            lib::msg::Publication<DirectTick>* publication
+          , CountingSubscription<DirectTick>* other
+        )
+            : m_Publication(publication)
+            , m_Other(other)
+        { }
+
+        void inbox(lib::ds::shared_ptr<const DirectTick> item) override
+        {
+            if (m_Count == 0) {
+                disconnect();
+                m_Publication->connect(*m_Other);
+            }
+            CountingSubscription<DirectTick>::inbox(item);
+        }
+
+    private:
+        lib::msg::Publication<DirectTick>*  m_Publication;
+        CountingSubscription<DirectTick>*   m_Other;
+};
+
+class DirectTickPublisher
+    : public lib::msg::Publisher<DirectTick>
+    , public lib::mp::work::Threadable
+{
+    public:
+        void operator()()
+        {
+            for (int i=0; i < 1000; ++i)
+            {
+                lib::ds::shared_ptr<DirectTick> t(new DirectTick);
+                t->m_Value = i;
+                publish(t);
+            }
+            endPublication();
+        }
+};
+using DirectTickPublisherPtr = lib::ds::shared_ptr<DirectTickPublisher>;
+
+class DirectTickSubscriber : public lib::msg::Subscriber<DirectTick>
+{
+    public:
+        DirectTickSubscriber() : m_Count(0) { }
+        void process(lib::ds::shared_ptr<const DirectTick>& t) { ++m_Count; }
+        int m_Count;
+};
+using DirectTickSubscriberPtr = lib::ds::shared_ptr<DirectTickSubscriber>;
+
+//------------------------------------------------------------------------------
+///@brief   Return the average nanoseconds per publish to the given number of   
+///         subscriptions.                                                      
+//------------------------------------------------------------------------------
+template <typename TYPE>
+double nanosecondsPerPublish(size_t subscriptions, int count)
+{
+    lib::msg::Publication<TYPE> pub;
+    std::vector<lib::ds::shared_ptr<CountingSubscription<TYPE> > > subs;
+
+    for (size_t s = 0; s < subscriptions; ++s) {
+        lib::ds::shared_ptr<CountingSubscription<TYPE> > sub;
+        lib::new_shared(sub);
+        pub.connect(*sub);
+        subs.push_back(sub);
+    }
+
+    lib::ds::shared_ptr<TYPE> item(new TYPE);
+    item->m_Value = 1;
+    lib::ds::shared_ptr<const TYPE> published(item);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        pub.publish(published);
+    }
+    std::chrono::duration<double, std::nano> elapsed(
+        std::chrono::steady_clock::now() - start
+    );
+
+    return elapsed.count() / count;
+}
+
+//------------------------------------------------------------------------------
+//  Publishes 1000 pooled buffers, each holding its index.                      
+//------------------------------------------------------------------------------
+using PooledBuffers = lib::ds::BufferPool<int>;
+
+class PooledPublisher
+    : public lib::msg::Publisher<PooledBuffers::Buffer>
+    , public lib::mp::work::Threadable
+{
+    public:
+        void operator()()
+        {
+            for (int i=0; i < 1000; ++i)
+            {
+                PooledBuffers::BufferPtr buffer(PooledBuffers::get(16, i));
+                (*buffer)[0] = i;
+                publish(buffer);
+            }
+            endPublication();
+        }
+};
+using PooledPublisherPtr = lib::ds::shared_ptr<PooledPublisher>;
+
+class PooledSubscriber : public lib::msg::Subscriber<PooledBuffers::Buffer>
+{
+    public:
+        PooledSubscriber() : m_Count(0), m_Errors(0) { }
+        void process(lib::ds::shared_ptr<const PooledBuffers::Buffer>& b)
+        {
+            if (   b->size() != 16
+                || (*b)[0] != m_Count
+                || b->fileOffset() != uint64_t(m_Count)
+            ) {
+                ++m_Errors;
+            }
+            ++m_Count;
+        }
+        int m_Count;
+        int m_Errors;
+};
+using PooledSubscriberPtr = lib::ds::shared_ptr<PooledSubscriber>;
+
+//------------------------------------------------------------------------------
+///@brief   Return the average nanoseconds to get (and release) a buffer.       
+//------------------------------------------------------------------------------
+template <typename GET>
+double nanosecondsPerBuffer(GET get, int count)
+{
+    const size_t inFlight(64);
+    std::vector<lib::ds::shared_ptr<lib::ds::VectorWithOffset<uint8_t> > >
+        buffers(inFlight);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        buffers[i % inFlight] = get();
+    }
+    std::chrono::duration<double, std::nano> elapsed(
+        std::chrono::steady_clock::now() - start
+    );
+
+    return elapsed.count() / count;
+}
+
 TEST_REGISTER(lib::msg::test::PublisherTest);
 
 //------------------------------------------------------------------------------
@@ -271,9 +506,63 @@ void PublisherTest::runTest()
     connect();
     endPublication();
     subscriptionCount();
+    directFanOut();
+    bufferPool();
 
 } // void PublisherTest::runTest() //
 
+//------------------------------------------------------------------------------
+/// @brief Measure the signals2 fan out against the DirectFanOut.               
+//------------------------------------------------------------------------------
+void PublisherTest::runTest3()
+{
+    const int count(1000000);
+
+    for (size_t subscriptions = 1; subscriptions <= 16; subscriptions *= 4) {
+        double signal(nanosecondsPerPublish<SignalTick>(subscriptions, count));
+        double direct(nanosecondsPerPublish<DirectTick>(subscriptions, count));
+
+        output(
+            vSummary
+          , lib::format(
+                "fan out to %2d:  signals2 %6.1lf ns/publish; "
+                "direct %6.1lf ns/publish"
+              , int(subscriptions)
+              , signal
+              , direct
+            )
+        );
+    }
+
+    const int buffers(1000000);
+    double heap(
+        nanosecondsPerBuffer(
+            []() {
+                lib::ds::shared_ptr<lib::ds::VectorWithOffset<uint8_t> > b;
+                lib::new_shared(b, 4096);
+                return b;
+            }
+          , buffers
+        )
+    );
+    double pooled(
+        nanosecondsPerBuffer(
+            []() { return lib::ds::BufferPool<uint8_t>::get(4096); }
+          , buffers
+        )
+    );
+
+    output(
+        vSummary
+      , lib::format(
+            "4 KiB buffer:  new_shared %6.1lf ns; BufferPool %6.1lf ns"
+          , heap
+          , pooled
+        )
+    );
+
+} // void PublisherTest::runTest3() //
+
 
 //------------------------------------------------------------------------------
 /// @brief Tests for the Publisher::Publisher                                   
@@ -696,6 +985,140 @@ void PublisherTest::subscriptionCount()
 }
 
 
+//------------------------------------------------------------------------------
+/// @brief Tests for the DirectFanOut publication backend.                      
+//------------------------------------------------------------------------------
+void PublisherTest::directFanOut()
+{
+    {
+        lib::msg::Publication<DirectTick> pub;
+        CountingSubscription<DirectTick> a;
+        CountingSubscription<DirectTick> b;
+        ReconnectingSubscription r(&pub, &b);
+
+        TEST(pub.subscriptionCount() == 0);
+        pub.connect(a);
+        pub.connect(r);
+        TEST(pub.subscriptionCount() == 2);
+
+        for (int i = 1; i <= 3; ++i) {
+            lib::ds::shared_ptr<DirectTick> t(new DirectTick);
+            t->m_Value = i;
+            pub.publish(lib::ds::shared_ptr<const DirectTick>(t));
+        }
+
+        //----------------------------------------------------------------------
+        //  r saw the publish that it disconnected during; b was connected      
+        //  during that publish, so it only saw the later two.                  
+        //----------------------------------------------------------------------
+        TEST_IS_EQUAL(a.m_Count, 3);
+        TEST_IS_EQUAL(r.m_Count, 1);
+        TEST_IS_EQUAL(b.m_Count, 2);
+        TEST(b.m_Sum == 5);
+        TEST(pub.subscriptionCount() == 2);
+
+        pub.endPublication();
+        TEST_IS_EQUAL(a.m_Ended, 1);
+        TEST_IS_EQUAL(b.m_Ended, 1);
+        TEST_IS_EQUAL(r.m_Ended, 0);
+
+        a.disconnect();
+        TEST(pub.subscriptionCount() == 1);
+    }
+
+    {
+        //----------------------------------------------------------------------
+        //  The disconnect function has to be harmless once the publication     
+        //  is gone.                                                            
+        //----------------------------------------------------------------------
+        CountingSubscription<DirectTick> a;
+        {
+            lib::msg::Publication<DirectTick> pub;
+            pub.connect(a);
+        }
+        a.disconnect();
+        PASS("disconnect after the publication was destroyed");
+    }
+
+    {
+        lib::mp::work::ThreadableCollection threads;
+
+        DirectTickPublisherPtr  pub;
+        DirectTickSubscriberPtr sub;
+        lib::new_shared(pub);
+        lib::new_shared(sub);
+
+        pub >> sub;
+        TEST(pub->subscriptionCount() == 1);
+
+        threads.push_back(pub);
+        threads.push_back(sub);
+        threads.startAll();
+        threads.joinAll();
+
+        TEST_IS_EQUAL(sub->m_Count, 1000);
+        TEST(pub->subscriptionCount() == 0);
+    }
+
+} // void PublisherTest::directFanOut() //
+
+//------------------------------------------------------------------------------
+/// @brief Tests for lib::ds::BufferPool.                                       
+//------------------------------------------------------------------------------
+void PublisherTest::bufferPool()
+{
+    using Pool = lib::ds::BufferPool<double>;
+
+    {
+        //----------------------------------------------------------------------
+        //  A released buffer comes back, storage and all.                      
+        //----------------------------------------------------------------------
+        Pool::BufferPtr a(Pool::get(100, 7));
+        TEST(a->size() == 100);
+        TEST(a->fileOffset() == 7);
+        const Pool::Buffer* address(a.get());
+        const void* memory(a->memory());
+        a.reset();
+
+        size_t created(Pool::created());
+        Pool::BufferPtr b(Pool::get(50));
+        TEST(b.get() == address);
+        TEST(b->memory() == memory);
+        TEST(b->size() == 50);
+        TEST(b->fileOffset() == uint64_t(-1));
+        TEST(Pool::created() == created);
+        b.reset();
+
+        for (int i = 0; i < 10000; ++i) {
+            Pool::BufferPtr c(Pool::get(100));
+        }
+        TEST(Pool::created() == created);
+    }
+
+    {
+        //----------------------------------------------------------------------
+        //  Buffers allocated by one thread and released by another.            
+        //----------------------------------------------------------------------
+        lib::mp::work::ThreadableCollection threads;
+
+        PooledPublisherPtr  pub;
+        PooledSubscriberPtr sub;
+        lib::new_shared(pub);
+        lib::new_shared(sub);
+
+        pub >> sub;
+        threads.push_back(pub);
+        threads.push_back(sub);
+        threads.startAll();
+        threads.joinAll();
+
+        TEST_IS_EQUAL(sub->m_Count, 1000);
+        TEST_IS_EQUAL(sub->m_Errors, 0);
+        TEST(PooledBuffers::created() <= 1000);
+    }
+
+} // void PublisherTest::bufferPool() //
+
 } // namespace test                                                             
 } // namespace msg                                                              
 } // namespace lib                                                              
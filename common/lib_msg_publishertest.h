@@ -19,6 +19,10 @@ namespace test {
 ///         The PublisherTest class provides the regression test for the        
 ///         lib::msg::Publisher class.                                          
 ///                                                                             
+///@version 2026-10-16  DHF     Added bufferPool.                               
+///                                                                             
+///@version 2026-10-16  DHF     Added directFanOut and the runTest3 benchmark.  
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-08-30  MTU         File creation                               
@@ -33,12 +37,15 @@ class PublisherTest : public dev::test::work::Test {
 
     protected:
         void runTest();
+        void runTest3();
 
         void Publisher();
         void publish();
         void connect();
         void endPublication();
         void subscriptionCount();
+        void directFanOut();
+        void bufferPool();
 
     private:
 
@@ -18,16 +18,21 @@
 
 #include "lib_ds_null.h"
 #include "lib_ds_shared_ptr.h"
-#include "lib_mp_work_queue.h"
+#include "lib_mp_work_queuepolicy.h"
+#include "lib_mp_work_queuestats.h"
+#include "lib_mp_work_task.h"
 #include "lib_mp_work_threadable.h"
+#include "lib_mp_work_workstealingpool.h"
 #include "lib_msg_publishersubscriberbase.h"
 #include "lib_msg_subscription.h"
 #include "lib_msg_subscriptionbase.h"
 
 #include <atomic>
 #include <boost/signals2.hpp>
+#include <functional>
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 #include <stdio.h>
 
@@ -156,12 +161,71 @@ namespace msg {
 ///         }                                                                   
 ///     @endcode                                                                
 ///                                                                             
+///@par Queue Policy                                                            
+///         The last template parameter, QUEUE_POLICY, selects the queue that   
+///         holds the order in which the subscriptions are to be processed.     
+///         The default (lib::mp::work::DequeQueuePolicy) is the mutex guarded  
+///         std::deque.  lib::mp::work::RingQueuePolicy selects the lock-free   
+///         ring; see RingSubscriber for a shorter way of spelling it.  The     
+///         queue for each subscribed-to type is chosen separately via          
+///         SubscriptionQueuePolicy.                                            
+///                                                                             
+///@par Single Queue Mode                                                       
+///         By default each Subscription<TYPE> queues the published item in its 
+///         own queue and then the Subscriber queues the SubscriptionBase* (two 
+///         locked pushes and two wake ups per item).  After setSingleQueue()   
+///         the Subscriber's queue holds (slot, payload) records instead, so an 
+///         item is queued only once.  Items are still processed in the order   
+///         received, so the per-type ordering is unchanged.                    
+///                                                                             
+///@par Batches                                                                 
+///         A batch published with Publication::publishBatch is queued as one   
+///         entry and handed to Subscription<TYPE>::process(const Batch&),      
+///         whose default calls process(item) for each item.  Either way,       
+///         next() drains up to DRAIN_SIZE entries from the queue per lock.     
+///                                                                             
+///@par Running As A Task                                                       
+///         A Subscriber is also a lib::mp::work::Task, so a                    
+///         ThreadableCollection using a WorkStealingPool can run it without a  
+///         thread of its own:  queuing an item schedules it, and runTask       
+///         processes up to TASK_BUDGET drains before letting the other tasks   
+///         have the worker.  initialize, cleanUp (and so endPublication) and   
+///         beforeEndThread run in a worker's context just as they would in the 
+///         thread's.                                                           
+///\n\n                                                                         
+///         A worker publishing to a Subscriber does not wait on its governor   
+///         (the worker may be the only one that could empty it).  A Subscriber 
+///         with a bounded queue (RingSubscriber) could still block a worker,   
+///         so it always gets its own thread.                                   
+///                                                                             
+///@par Instrumentation                                                         
+///         instrument() gives the queue a lib::mp::work::QueueStats and adds   
+///         it to the QueueStatsRegistry (every Subscriber does so when made    
+///         after QueueStats::setEnabledByDefault(true)).  Each entry is then   
+///         stamped as it is queued and its residence recorded as it is taken   
+///         out.  Only the Subscriber's own queue is counted, not the           
+///         Subscription<TYPE> queues behind it.                                
+///                                                                             
 ///@par Thread Safety:  object                                                  
 ///         There is an implicit assumption that only one msg::Producer object  
 ///         will be feeding data to a msg::Subscriber object (at a time).  If   
 ///         this is a bad assumption, the publicationEnding code (at least) will
 ///         have to be modified.                                                
 ///                                                                             
+///@version 2026-10-16  DHF     Added instrument.                               
+///                                                                             
+///@version 2026-10-16  DHF     Added publishers.                               
+///                                                                             
+///@version 2026-10-16  DHF     Derived from lib::mp::work::Task.               
+///                                                                             
+///@version 2026-10-16  DHF     Added addDisconnect (for DirectFanOut).         
+///                                                                             
+///@version 2026-10-16  DHF     Added batches; next() drains with popMany.      
+///                                                                             
+///@version 2026-10-16  DHF     Added single queue mode (setSingleQueue).       
+///                                                                             
+///@version 2026-10-16  DHF     Added QUEUE_POLICY template parameter.          
+///                                                                             
 ///@version 2020-05-06  DHF     Removed lib_atomic.h in favor of <atomic>.      
 ///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
@@ -236,6 +300,7 @@ template <
   , typename TYPE6 = ds::NULL_DEFAULT_TYPE_6
   , typename TYPE7 = ds::NULL_DEFAULT_TYPE_7
   , typename TYPE8 = ds::NULL_DEFAULT_TYPE_8
+  , typename QUEUE_POLICY = lib::mp::work::DequeQueuePolicy
 >
 class Subscriber 
     : public Subscription<TYPE0>
@@ -248,6 +313,7 @@ class Subscriber
     , public Subscription<TYPE7>
     , public Subscription<TYPE8>
     , public lib::mp::work::Threadable
+    , public lib::mp::work::Task
     , virtual public PublisherSubscriberBase
 {
     public:
@@ -263,6 +329,7 @@ class Subscriber
         using Type6 = TYPE6;
         using Type7 = TYPE7;
         using Type8 = TYPE8;
+        using QueuePolicy = QUEUE_POLICY;
 
         //----------------------------------------------------------------------
         ///@brief Construct the Subscriber object.                              
@@ -286,18 +353,24 @@ class Subscriber
             : lib::mp::work::Threadable("anonymous")
             , m_PublicationCount(0)
             , m_Stop(false)
+            , m_SingleQueue(false)
             , m_Queue(max_size)
+            , m_TaskStarted(false)
             {
                 setSubscriber();
+                if (lib::mp::work::QueueStats::enabledByDefault()) instrument();
             }
 
         Subscriber(const std::string& name, size_t max_size = 100)
             : lib::mp::work::Threadable(name)
             , m_PublicationCount(0)
             , m_Stop(false)
+            , m_SingleQueue(false)
             , m_Queue(max_size)
+            , m_TaskStarted(false)
             {
                 setSubscriber();
+                if (lib::mp::work::QueueStats::enabledByDefault()) instrument();
             }
 
         //----------------------------------------------------------------------
@@ -318,6 +391,8 @@ class Subscriber
             if (m_PublicationCount <= 0) {
                 m_Queue.setInterrupt(true);
             }
+
+            schedule();
         }
 
         //----------------------------------------------------------------------
@@ -353,12 +428,67 @@ class Subscriber
         //----------------------------------------------------------------------
         virtual void next()
         {
-            SubscriptionBase* item = NULL;
-            if (m_Queue.pop(item)) {
-                //beat();                                                       
-                item->processQueueItem();
+            //------------------------------------------------------------------
+            //  Take everything that is waiting (up to DRAIN_SIZE) with one     
+            //  lock rather than locking for each item.                         
+            //------------------------------------------------------------------
+            m_Drained.clear();
+            m_Queue.popMany(m_Drained, DRAIN_SIZE);
 
-            }
+            processDrained();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   A bounded queue could block a pool worker (see the class    
+        ///         description), so only the unbounded ones run as tasks.      
+        //----------------------------------------------------------------------
+        virtual bool canRunAsTask() const override
+        {
+            return !QUEUE_POLICY::bounded;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Select single queue mode (see class description).           
+        ///@warning Must be called before any publisher starts publishing to    
+        ///         this object; items already queued would be misrouted.       
+        //----------------------------------------------------------------------
+        void setSingleQueue(bool value = true)
+        {
+            m_SingleQueue = value;
+            Subscription<TYPE0>::setSingleQueue(value);
+            Subscription<TYPE1>::setSingleQueue(value);
+            Subscription<TYPE2>::setSingleQueue(value);
+            Subscription<TYPE3>::setSingleQueue(value);
+            Subscription<TYPE4>::setSingleQueue(value);
+            Subscription<TYPE5>::setSingleQueue(value);
+            Subscription<TYPE6>::setSingleQueue(value);
+            Subscription<TYPE7>::setSingleQueue(value);
+            Subscription<TYPE8>::setSingleQueue(value);
+        }
+
+        bool isSingleQueue() const { return m_SingleQueue; }
+
+        //----------------------------------------------------------------------
+        ///@brief   Count what goes through the queue (see class description)   
+        ///         and return the counters.                                    
+        ///@param   name    How the queue is known in the registry's dump (the  
+        ///                 default is the Subscriber's name).                  
+        ///@warning Must be called before any publisher starts publishing to    
+        ///         this object.                                                
+        //----------------------------------------------------------------------
+        lib::mp::work::QueueStatsPtr instrument(const std::string& name = "")
+        {
+            lib::mp::work::QueueStatsPtr stats;
+            lib::new_shared(stats, name.empty() ? this->name() : name);
+
+            m_Queue.setStats(stats);
+            lib::mp::work::QueueStatsRegistry::add(stats);
+            return stats;
+        }
+
+        const lib::mp::work::QueueStatsPtr& stats() const
+        {
+            return m_Queue.stats();
         }
 
         //----------------------------------------------------------------------
@@ -449,6 +579,15 @@ class Subscriber
 
         int publicationCount() const {return m_PublicationCount; }
 
+        //----------------------------------------------------------------------
+        ///@brief   Return the publishers this object has been connected to.    
+        //----------------------------------------------------------------------
+        virtual std::vector<const PublisherSubscriberBase*> publishers() const
+            override
+        {
+            return m_Publishers;
+        }
+
 
     protected:
         //----------------------------------------------------------------------
@@ -482,6 +621,10 @@ class Subscriber
             for (c = m_Connections.begin(); c != m_Connections.end(); ++c) {
                 c->disconnect();
             }
+
+            for (size_t d = 0; d < m_Disconnects.size(); ++d) {
+                m_Disconnects[d]();
+            }
             
         }
 
@@ -491,7 +634,82 @@ class Subscriber
         //----------------------------------------------------------------------
         virtual void addToParentQueue(SubscriptionBase* item) override
         {
-            m_Queue.push(item);
+            m_Queue.push(
+                QueueItem(
+                    item, lib::ds::shared_ptr<const void>(), false, stamp()
+                )
+              , !lib::mp::work::WorkStealingPool::isWorkerThread()
+            );
+            schedule();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Single queue mode version of the above; the payload rides   
+        ///         along with the SubscriptionBase* that will process it.      
+        //----------------------------------------------------------------------
+        virtual void addToParentQueue(
+            SubscriptionBase* item
+          , const lib::ds::shared_ptr<const void>& payload
+        ) override
+        {
+            m_Queue.push(
+                QueueItem(item, payload, false, stamp())
+              , !lib::mp::work::WorkStealingPool::isWorkerThread()
+            );
+            schedule();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Add a whole batch to the master queue as one entry.         
+        //----------------------------------------------------------------------
+        virtual void addBatchToParentQueue(
+            SubscriptionBase* item
+          , const lib::ds::shared_ptr<const void>& batch
+        ) override
+        {
+            m_Queue.push(
+                QueueItem(item, batch, true, stamp())
+              , !lib::mp::work::WorkStealingPool::isWorkerThread()
+            );
+            schedule();
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   The task version of operator()():  process what is queued   
+        ///         (up to TASK_BUDGET drains) and return rather than wait.     
+        //----------------------------------------------------------------------
+        virtual Result runTask() override
+        {
+            try {
+                if (!m_TaskStarted) {
+                    m_TaskStarted = true;
+                    m_Stop = false;
+                    m_Stage = Stage::stage0;
+                    m_DoEndPublication = true;
+
+                    if (!initialize()) {
+                        return Result::finished;
+                    }
+                }
+
+                for (int i = 0; i < TASK_BUDGET; ++i) {
+                    if (stopProcessing()) {
+                        cleanUp();
+                        return Result::finished;
+                    }
+
+                    m_Drained.clear();
+                    if (m_Queue.tryPopMany(m_Drained, DRAIN_SIZE) == 0) {
+                        return Result::idle;
+                    }
+                    processDrained();
+                }
+
+                return Result::yield;
+            } catch(...) {
+                cleanUp();
+                throw;
+            }
         }
 
     private:
@@ -517,11 +735,34 @@ class Subscriber
         void incrementPublicationCount(
             boost::signals2::connection& connection1
           , boost::signals2::connection& connection2
+          , boost::signals2::connection& connection3
         )
         {
             ++m_PublicationCount;
             m_Connections.push_back(connection1);
             m_Connections.push_back(connection2);
+            m_Connections.push_back(connection3);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief Remember how to disconnect from a DirectFanOut publication.   
+        //----------------------------------------------------------------------
+        void addDisconnect(const std::function<void ()>& disconnect)
+        {
+            m_Disconnects.push_back(disconnect);
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief Remember the publisher (once, however many types it sends).   
+        //----------------------------------------------------------------------
+        void addPublisher(const PublisherSubscriberBase* publisher)
+        {
+            if (publisher == nullptr) return;
+
+            for (size_t p = 0; p < m_Publishers.size(); ++p) {
+                if (m_Publishers[p] == publisher) return;
+            }
+            m_Publishers.push_back(publisher);
         }
 
         //----------------------------------------------------------------------
@@ -530,6 +771,65 @@ class Subscriber
         volatile bool m_Stop;
 
         std::vector<boost::signals2::connection>    m_Connections;
+        std::vector<std::function<void ()> >        m_Disconnects;
+        std::vector<const PublisherSubscriberBase*> m_Publishers;
+
+        //----------------------------------------------------------------------
+        ///@brief   True = the published items are held in m_Queue rather than  
+        ///         in the Subscription<TYPE> queues.                           
+        //----------------------------------------------------------------------
+        bool m_SingleQueue;
+
+        //----------------------------------------------------------------------
+        ///@brief   An entry in m_Queue:  the subscription that is to process   
+        ///         the item and, in single queue mode or for a batch, the      
+        ///         item (or batch) itself.                                     
+        //----------------------------------------------------------------------
+        struct QueueItem
+        {
+            QueueItem(
+                SubscriptionBase* subscription = NULL
+              , const lib::ds::shared_ptr<const void>& payload
+                    = lib::ds::shared_ptr<const void>()
+              , bool batch = false
+              , int64_t enqueued = 0
+            )
+                : m_Subscription(subscription)
+                , m_Payload(payload)
+                , m_Batch(batch)
+                , m_Enqueued(enqueued)
+            {
+            }
+
+            SubscriptionBase*                   m_Subscription;
+            lib::ds::shared_ptr<const void>     m_Payload;
+            bool                                m_Batch;
+            int64_t                             m_Enqueued; ///< 0 = untimed
+        };
+
+        //----------------------------------------------------------------------
+        ///@brief   The time to stamp a new entry with (0 if not instrumented). 
+        //----------------------------------------------------------------------
+        int64_t stamp() const
+        {
+            return m_Queue.stats() ? lib::mp::work::QueueStats::now() : 0;
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   The most entries next() takes from m_Queue at one time.     
+        //----------------------------------------------------------------------
+        enum { DRAIN_SIZE = 64 };
+
+        //----------------------------------------------------------------------
+        ///@brief   The most drains runTask does before yielding the worker.    
+        //----------------------------------------------------------------------
+        enum { TASK_BUDGET = 16 };
+
+        //----------------------------------------------------------------------
+        ///@brief   The entries next() took from m_Queue (kept as a member so   
+        ///         its memory is reused).                                      
+        //----------------------------------------------------------------------
+        std::vector<QueueItem>  m_Drained;
                                                                                 
         //----------------------------------------------------------------------
         ///@brief   Queue holding the subscription bases (in order) that they   
@@ -544,8 +844,14 @@ class Subscriber
         ///         execution.  The SubscriptionBase* allows us to effectively  
         ///         have a queue with multiple types (since the templated       
         ///         Subscription<TYPE> has a base of SubscriptionBase>.         
+        ///         In single queue mode the item itself rides along.           
         //----------------------------------------------------------------------
-        lib::mp::work::Queue<SubscriptionBase*>           m_Queue;
+        typename QUEUE_POLICY::template queue<QueueItem>  m_Queue;
+
+        //----------------------------------------------------------------------
+        ///@brief   True once runTask has called initialize.                    
+        //----------------------------------------------------------------------
+        bool m_TaskStarted;
 
         enum class Stage 
         {
@@ -558,6 +864,36 @@ class Subscriber
         //----------------------------------------------------------------------
         bool m_DoEndPublication;
 
+        //----------------------------------------------------------------------
+        ///@brief   Process the entries taken from m_Queue (in order).          
+        //----------------------------------------------------------------------
+        void processDrained()
+        {
+            //------------------------------------------------------------------
+            //  The whole drain left the queue now, so one clock read serves.   
+            //------------------------------------------------------------------
+            lib::mp::work::QueueStats* stats(m_Queue.stats().get());
+            const int64_t now(stats ? lib::mp::work::QueueStats::now() : 0);
+
+            for (size_t i = 0; i < m_Drained.size() && !m_Stop; ++i) {
+                QueueItem& item(m_Drained[i]);
+                if (stats && item.m_Enqueued != 0) {
+                    stats->residence(now - item.m_Enqueued);
+                }
+                //beat();                                                       
+                if (item.m_Batch) {
+                    item.m_Subscription->processQueueBatch(item.m_Payload);
+                } else if (m_SingleQueue) {
+                    item.m_Subscription->processQueueItem(item.m_Payload);
+                } else {
+                    item.m_Subscription->processQueueItem();
+                }
+
+            }
+
+            m_Drained.clear();
+        }
+
         //----------------------------------------------------------------------
         ///@brief   Called after the all of the thread processing is complete;  
         ///         executed in the thread's context.                           
@@ -657,6 +993,34 @@ class Subscriber
 
 }; // class Subscriber                                                          
 
+//------------------------------------------------------------------------------
+///@brief   A Subscriber whose processing order is kept in the lock-free        
+///         lib::mp::work::RingQueue.                                           
+///                                                                             
+///@par Expected Usage:                                                         
+///         @code                                                               
+///             class MySubscriber : public lib::msg::RingSubscriber<int, double>
+///             {                                                               
+///                 // ... as for lib::msg::Subscriber ...                      
+///             };                                                              
+///         @endcode                                                            
+//------------------------------------------------------------------------------
+template <
+    typename TYPE0
+  , typename TYPE1 = ds::NULL_DEFAULT_TYPE_1
+  , typename TYPE2 = ds::NULL_DEFAULT_TYPE_2
+  , typename TYPE3 = ds::NULL_DEFAULT_TYPE_3
+  , typename TYPE4 = ds::NULL_DEFAULT_TYPE_4
+  , typename TYPE5 = ds::NULL_DEFAULT_TYPE_5
+  , typename TYPE6 = ds::NULL_DEFAULT_TYPE_6
+  , typename TYPE7 = ds::NULL_DEFAULT_TYPE_7
+  , typename TYPE8 = ds::NULL_DEFAULT_TYPE_8
+>
+using RingSubscriber = Subscriber<
+    TYPE0, TYPE1, TYPE2, TYPE3, TYPE4, TYPE5, TYPE6, TYPE7, TYPE8
+  , lib::mp::work::RingQueuePolicy
+>;
+
 }  // namespace msg //                                                          
 }  // namespace lib //                                                          
 
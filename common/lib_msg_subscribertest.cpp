@@ -8,11 +8,15 @@
 #include "lib_msg_subscriber.h"
 #include "lib_msg_publisher.h"
 
+#include "lib_mp_work_queue.h"
+#include "lib_mp_work_ringqueue.h"
 #include "lib_mp_work_threadable.h"
 #include "lib_mp_work_threadablecollection.h"
 
 #include "debug.h"
 
+#include <chrono>
+
 
 namespace lib {
 namespace msg {
@@ -56,12 +60,13 @@ SubscriberTest& SubscriberTest::operator=(const SubscriberTest& that)
 } // SubscriberTest::operator=(const SubscriberTest& that) //
 
 
-class MySubscriberTest
-    : public lib::msg::Subscriber<int, double>
+template <typename SUBSCRIBER>
+class MySubscriberTestT
+    : public SUBSCRIBER
     , dev::test::work::TestProxy
 {
     public:
-        MySubscriberTest(SubscriberTest* t)
+        MySubscriberTestT(SubscriberTest* t)
             : dev::test::work::TestProxy(t)
             , m_CountInteger(0)
             , m_CountDouble(0)
@@ -115,8 +120,13 @@ class MySubscriberTest
         int                 m_CountInteger;
         int                 m_CountDouble;
 };
+using MySubscriberTest = MySubscriberTestT<lib::msg::Subscriber<int, double> >;
 using MySubscriberTestPtr = lib::ds::shared_ptr<MySubscriberTest>;
 
+using MyRingSubscriberTest =
+    MySubscriberTestT<lib::msg::RingSubscriber<int, double> >;
+using MyRingSubscriberTestPtr = lib::ds::shared_ptr<MyRingSubscriberTest>;
+
 class MyPublisherTest
     : public lib::msg::Publisher<int, double>
     , public lib::mp::work::Threadable
@@ -137,6 +147,477 @@ class MyPublisherTest
 };
 using MyPublisherTestPtr = lib::ds::shared_ptr<MyPublisherTest>;
 
+//------------------------------------------------------------------------------
+//  Publish enough items through a small ring that it wraps many times and the  
+//  publishers have to wait on the governor.                                    
+//------------------------------------------------------------------------------
+class CountingRingSubscriber
+    : public lib::msg::RingSubscriber<int>
+{
+    public:
+        CountingRingSubscriber()
+            : lib::msg::RingSubscriber<int>("ring", 8)
+            , m_Count(0)
+            , m_Sum(0)
+        { }
+
+        void process(lib::ds::shared_ptr<const int>& i)
+        {
+            ++m_Count;
+            m_Sum += *i;
+        }
+
+        int         m_Count;
+        int64_t     m_Sum;
+};
+using CountingRingSubscriberPtr = lib::ds::shared_ptr<CountingRingSubscriber>;
+
+class ManyPublisher
+    : public lib::msg::Publisher<int>
+    , public lib::mp::work::Threadable
+{
+    public:
+        void operator()()
+        {
+            for (int i=0; i < 10000; ++i)
+            {
+                lib::ds::shared_ptr<int>    p_int(new int(i));
+                publish(p_int);
+            }
+            endPublication();
+        }
+};
+using ManyPublisherPtr = lib::ds::shared_ptr<ManyPublisher>;
+
+//------------------------------------------------------------------------------
+//  One publisher fanning nine different types into one subscriber; used to     
+//  compare the per-type queues with single queue mode.                         
+//------------------------------------------------------------------------------
+template <int N>
+struct Tick
+{
+    Tick(int value) : m_Value(value) { }
+    int m_Value;
+};
+
+using FanInSubscriberBase = lib::msg::Subscriber<
+    Tick<0>, Tick<1>, Tick<2>, Tick<3>, Tick<4>, Tick<5>, Tick<6>, Tick<7>
+  , Tick<8>
+>;
+
+class FanInSubscriber : public FanInSubscriberBase
+{
+    public:
+        FanInSubscriber()
+            : FanInSubscriberBase("fan-in")
+            , m_Count(0)
+            , m_OutOfOrder(0)
+        {
+            for (int n = 0; n < 9; ++n) m_Next[n] = 0;
+        }
+
+        void process(lib::ds::shared_ptr<const Tick<0> >& t) { check(0, *t); }
+        void process(lib::ds::shared_ptr<const Tick<1> >& t) { check(1, *t); }
+        void process(lib::ds::shared_ptr<const Tick<2> >& t) { check(2, *t); }
+        void process(lib::ds::shared_ptr<const Tick<3> >& t) { check(3, *t); }
+        void process(lib::ds::shared_ptr<const Tick<4> >& t) { check(4, *t); }
+        void process(lib::ds::shared_ptr<const Tick<5> >& t) { check(5, *t); }
+        void process(lib::ds::shared_ptr<const Tick<6> >& t) { check(6, *t); }
+        void process(lib::ds::shared_ptr<const Tick<7> >& t) { check(7, *t); }
+        void process(lib::ds::shared_ptr<const Tick<8> >& t) { check(8, *t); }
+
+        int         m_Count;
+        int         m_OutOfOrder;
+
+    private:
+        template <int N>
+        void check(int n, const Tick<N>& t)
+        {
+            if (t.m_Value != m_Next[n]) ++m_OutOfOrder;
+            m_Next[n] = t.m_Value + 1;
+            ++m_Count;
+        }
+
+        int         m_Next[9];
+};
+using FanInSubscriberPtr = lib::ds::shared_ptr<FanInSubscriber>;
+
+class FanInPublisher
+    : public lib::msg::Publisher<
+        Tick<0>, Tick<1>, Tick<2>, Tick<3>, Tick<4>, Tick<5>, Tick<6>
+      , Tick<7>, Tick<8>
+    >
+    , public lib::mp::work::Threadable
+{
+    public:
+        FanInPublisher(int count) : m_Count(count) { }
+
+        void operator()()
+        {
+            for (int i=0; i < m_Count; ++i)
+            {
+                publishTick<0>(i);
+                publishTick<1>(i);
+                publishTick<2>(i);
+                publishTick<3>(i);
+                publishTick<4>(i);
+                publishTick<5>(i);
+                publishTick<6>(i);
+                publishTick<7>(i);
+                publishTick<8>(i);
+            }
+            endPublication();
+        }
+
+    private:
+        template <int N>
+        void publishTick(int i)
+        {
+            lib::ds::shared_ptr<Tick<N> > t(new Tick<N>(i));
+            publish(t);
+        }
+
+        int m_Count;
+};
+using FanInPublisherPtr = lib::ds::shared_ptr<FanInPublisher>;
+
+//------------------------------------------------------------------------------
+//  Publish count integers in batches of batch_size.                            
+//------------------------------------------------------------------------------
+class BatchPublisher
+    : public lib::msg::Publisher<int>
+    , public lib::mp::work::Threadable
+{
+    public:
+        BatchPublisher(int count, int batch_size)
+            : m_Count(count)
+            , m_BatchSize(batch_size)
+        { }
+
+        void operator()()
+        {
+            std::vector<lib::ds::shared_ptr<const int> > batch;
+
+            for (int i=0; i < m_Count; ++i)
+            {
+                batch.push_back(lib::ds::shared_ptr<const int>(new int(i)));
+
+                if (int(batch.size()) == m_BatchSize || i == m_Count - 1) {
+                    publishBatch(batch.begin(), batch.end());
+                    batch.clear();
+                }
+            }
+            endPublication();
+        }
+
+    private:
+        int m_Count;
+        int m_BatchSize;
+};
+using BatchPublisherPtr = lib::ds::shared_ptr<BatchPublisher>;
+
+//------------------------------------------------------------------------------
+//  Count the items (and batches if hooked) received and check their order.     
+//------------------------------------------------------------------------------
+class BatchSubscriber : public lib::msg::Subscriber<int>
+{
+    public:
+        using Batch = lib::msg::Subscription<int>::Batch;
+
+        BatchSubscriber(bool hook)
+            : lib::msg::Subscriber<int>("batch")
+            , m_Hook(hook)
+            , m_Items(0)
+            , m_Batches(0)
+            , m_OutOfOrder(0)
+        { }
+
+        void process(lib::ds::shared_ptr<const int>& i)
+        {
+            if (*i != m_Items) ++m_OutOfOrder;
+            ++m_Items;
+        }
+
+        void process(const Batch& items)
+        {
+            if (!m_Hook) {
+                lib::msg::Subscription<int>::process(items);
+                return;
+            }
+
+            ++m_Batches;
+            for (size_t i = 0; i < items.size(); ++i) {
+                if (*items[i] != m_Items) ++m_OutOfOrder;
+                ++m_Items;
+            }
+        }
+
+        bool    m_Hook;
+        int     m_Items;
+        int     m_Batches;
+        int     m_OutOfOrder;
+};
+using BatchSubscriberPtr = lib::ds::shared_ptr<BatchSubscriber>;
+
+//------------------------------------------------------------------------------
+//  A chain of relays (each a Subscriber and a Publisher) ending in a counter;  
+//  used to run many subscribers on a small WorkStealingPool.                   
+//------------------------------------------------------------------------------
+class Relay
+    : public lib::msg::Subscriber<int>
+    , public lib::msg::Publisher<int>
+{
+    public:
+        Relay() : lib::msg::Subscriber<int>("relay", 8) { }
+
+        void process(lib::ds::shared_ptr<const int>& i)
+        {
+            publish(i);
+        }
+};
+using RelayPtr = lib::ds::shared_ptr<Relay>;
+
+class ChainEnd : public lib::msg::Subscriber<int>
+{
+    public:
+        ChainEnd()
+            : lib::msg::Subscriber<int>("end", 8)
+            , m_Count(0)
+            , m_OutOfOrder(0)
+        { }
+
+        void process(lib::ds::shared_ptr<const int>& i)
+        {
+            if (*i != m_Count) ++m_OutOfOrder;
+            ++m_Count;
+        }
+
+        int m_Count;
+        int m_OutOfOrder;
+};
+using ChainEndPtr = lib::ds::shared_ptr<ChainEnd>;
+
+class CountingPublisher
+    : public lib::msg::Publisher<int>
+    , public lib::mp::work::Threadable
+{
+    public:
+        CountingPublisher(int count) : m_Count(count) { }
+
+        void operator()()
+        {
+            for (int i=0; i < m_Count; ++i)
+            {
+                lib::ds::shared_ptr<int>    p_int(new int(i));
+                publish(p_int);
+            }
+            endPublication();
+        }
+
+    private:
+        int m_Count;
+};
+using CountingPublisherPtr = lib::ds::shared_ptr<CountingPublisher>;
+
+//------------------------------------------------------------------------------
+///@brief   Pass count integers down a chain of length relays.                  
+///@param   pool_size   0 = a thread per subscriber; else the pool size.        
+///@return  The number of seconds it took.                                      
+//------------------------------------------------------------------------------
+double SubscriberTest::chain(
+    int length
+  , int count
+  , size_t pool_size
+  , bool single_queue
+)
+{
+    lib::mp::work::ThreadableCollection threads;
+    if (pool_size > 0) {
+        threads.setExecutor(
+            lib::mp::work::ThreadableCollection::Executor::workStealingPool
+          , pool_size
+        );
+    }
+
+    CountingPublisherPtr pub;
+    ChainEndPtr          end;
+
+    lib::new_shared(pub, count);
+    lib::new_shared(end);
+    end->setSingleQueue(single_queue);
+
+    threads.push_back(pub);
+
+    lib::ds::shared_ptr<lib::msg::Publisher<int> > previous(pub);
+    for (int i = 0; i < length; ++i) {
+        RelayPtr relay;
+        lib::new_shared(relay);
+        relay->setSingleQueue(single_queue);
+
+        previous >> relay;
+        previous = relay;
+
+        threads.push_back(relay);
+    }
+    previous >> end;
+
+    threads.push_back(end);
+
+    auto start = std::chrono::steady_clock::now();
+    threads.startAll();
+    threads.joinAll();
+    std::chrono::duration<double> seconds(
+        std::chrono::steady_clock::now() - start
+    );
+
+    TEST_IS_EQUAL(end->m_Count, count);
+    TEST_IS_EQUAL(end->m_OutOfOrder, 0);
+    TEST((pool_size > 0) == (end->thread().get() == nullptr));
+    TEST(end->isTask() == (pool_size > 0));
+
+    return seconds.count();
+
+} // SubscriberTest::chain //
+
+//------------------------------------------------------------------------------
+//  Method:  workStealingPool                                                   
+//------------------------------------------------------------------------------
+void SubscriberTest::workStealingPool()
+{
+    chain(50, 1000, 2, false);
+    chain(50, 1000, 2, true);
+    chain(5, 1000, 1, false);
+
+    //--------------------------------------------------------------------------
+    //  A RingSubscriber keeps its own thread even in pool mode.                
+    //--------------------------------------------------------------------------
+    {
+        lib::mp::work::ThreadableCollection threads;
+        threads.setExecutor(
+            lib::mp::work::ThreadableCollection::Executor::workStealingPool
+          , 2
+        );
+
+        CountingRingSubscriberPtr sub;
+        ManyPublisherPtr pub;
+
+        lib::new_shared(sub);
+        lib::new_shared(pub);
+
+        pub >> sub;
+
+        threads.push_back(pub);
+        threads.push_back(sub);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST_IS_EQUAL(sub->m_Count, 10000);
+        TEST(sub->thread().get() != nullptr);
+        TEST(!sub->isTask());
+    }
+
+    {
+        lib::mp::work::Queue<int> q(2);
+        q.push(0);
+        q.push(1);
+        q.push(2, false);
+        TEST_IS_EQUAL(q.size(), size_t(3));
+
+        std::vector<int> items;
+        TEST(q.tryPopMany(items) == 3);
+        TEST(q.tryPopMany(items) == 0);
+        TEST(items.size() == 3 && items[2] == 2);
+    }
+
+} // SubscriberTest::workStealingPool //
+
+//------------------------------------------------------------------------------
+//  Method:  placement                                                          
+//------------------------------------------------------------------------------
+void SubscriberTest::placement()
+{
+    std::vector<std::vector<int> > complexes(
+        lib::mp::work::ThreadPlacement::coreComplexes()
+    );
+    TEST(!complexes.empty());
+
+    lib::mp::work::ThreadableCollection threads;
+    threads.setPlacementPolicy(
+        lib::mp::work::ThreadableCollection::PlacementPolicy::colocate
+    );
+
+    CountingPublisherPtr    pub;
+    RelayPtr                relay;
+    ChainEndPtr             end;
+
+    lib::new_shared(pub, 1000);
+    lib::new_shared(relay);
+    lib::new_shared(end);
+
+    pub >> relay >> end;
+
+    //--------------------------------------------------------------------------
+    //  An explicit placement is kept.                                          
+    //--------------------------------------------------------------------------
+    lib::mp::work::ThreadPlacement cpu0;
+    cpu0.setCpus(std::vector<int>(1, 0));
+    end->setPlacement(cpu0);
+
+    threads.push_back(pub);
+    threads.push_back(relay);
+    threads.push_back(end);
+
+    TEST(relay->publishers().size() == 1);
+    TEST(end->publishers().size() == 1);
+
+    threads.startAll();
+    threads.joinAll();
+
+    TEST_IS_EQUAL(end->m_Count, 1000);
+    TEST(end->thread()->placement().cpus() == std::vector<int>(1, 0));
+    TEST_IS_EQUAL(end->thread()->placementError(), std::string());
+    TEST(pub->placement().cpus() == relay->placement().cpus());
+    TEST(relay->placement().isDefault() == (complexes.size() < 2));
+
+} // SubscriberTest::placement //
+
+//------------------------------------------------------------------------------
+///@brief   Run count rounds of the nine type fan-in.                           
+///@return  The number of messages per second delivered.                        
+//------------------------------------------------------------------------------
+double SubscriberTest::fanIn(bool single_queue, int count)
+{
+    lib::mp::work::ThreadableCollection threads;
+
+    FanInSubscriberPtr sub;
+    FanInPublisherPtr  pub;
+
+    lib::new_shared(sub);
+    lib::new_shared(pub, count);
+
+    sub->setSingleQueue(single_queue);
+    TEST(sub->isSingleQueue() == single_queue);
+
+    pub >> sub;
+
+    threads.push_back(pub);
+    threads.push_back(sub);
+
+    auto start = std::chrono::steady_clock::now();
+    threads.startAll();
+    threads.joinAll();
+    std::chrono::duration<double> seconds(
+        std::chrono::steady_clock::now() - start
+    );
+
+    TEST_IS_EQUAL(sub->m_Count, 9 * count);
+    TEST_IS_EQUAL(sub->m_OutOfOrder, 0);
+
+    return seconds.count() > 0 ? sub->m_Count / seconds.count() : 0.0;
+
+} // SubscriberTest::fanIn //
+
 //------------------------------------------------------------------------------
 //  Method:  runTest                                                            
 //------------------------------------------------------------------------------
@@ -164,9 +645,225 @@ void SubscriberTest::runTest()
     TEST(sub->countInteger() == 5);
     TEST(sub->countDouble() == 5);
 
+    ringQueue();
+
+    fanIn(false, 100);
+    fanIn(true, 100);
+
+    batches();
+
+    workStealingPool();
+
+    placement();
 
 } // SubscriberTest::runTest //
 
+//------------------------------------------------------------------------------
+//  Method:  batches                                                            
+//------------------------------------------------------------------------------
+void SubscriberTest::batches()
+{
+    for (int hook = 0; hook < 2; ++hook) {
+        lib::mp::work::ThreadableCollection threads;
+
+        BatchSubscriberPtr  sub;
+        BatchPublisherPtr   pub;
+
+        lib::new_shared(sub, hook != 0);
+        lib::new_shared(pub, 1000, 64);
+
+        pub >> sub;
+
+        threads.push_back(pub);
+        threads.push_back(sub);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST_IS_EQUAL(sub->m_Items, 1000);
+        TEST_IS_EQUAL(sub->m_OutOfOrder, 0);
+        TEST_IS_EQUAL(sub->m_Batches, (hook ? 16 : 0));
+    }
+
+    {
+        lib::mp::work::Queue<int> q;
+        for (int i = 0; i < 10; ++i) q.push(i);
+
+        std::vector<int> items;
+        TEST(q.popMany(items, 4) == 4);
+        TEST(items.size() == 4 && items[0] == 0 && items[3] == 3);
+        TEST(q.popMany(items) == 6);
+        TEST(items.size() == 10 && items[9] == 9);
+
+        q.setInterrupt();
+        TEST(q.popMany(items) == 0);
+    }
+
+    {
+        lib::mp::work::RingQueue<int> q;
+        for (int i = 0; i < 10; ++i) q.push(i);
+
+        std::vector<int> items;
+        TEST(q.popMany(items, 4) == 4);
+        TEST(items.size() == 4 && items[0] == 0 && items[3] == 3);
+        TEST(q.popMany(items) == 6);
+        TEST(items.size() == 10 && items[9] == 9);
+
+        q.setInterrupt();
+        TEST(q.popMany(items) == 0);
+    }
+
+} // SubscriberTest::batches //
+
+//------------------------------------------------------------------------------
+//  Method:  runTest3                                                           
+//                                                                              
+//  Benchmark the nine type fan-in with and without single queue mode.          
+//------------------------------------------------------------------------------
+void SubscriberTest::runTest3()
+{
+    const int count(100000);
+
+    double perType = fanIn(false, count);
+    double single = fanIn(true, count);
+
+    output(
+        vSummary
+      , lib::format(
+            "fan-in of 9 types:  per-type queues %.0lf msgs/sec; "
+            "single queue %.0lf msgs/sec"
+          , perType
+          , single
+        )
+    );
+
+    const int items(1000000);
+    for (int batch = 1; batch <= 256; batch *= 16) {
+        lib::mp::work::ThreadableCollection threads;
+
+        BatchSubscriberPtr  sub;
+        BatchPublisherPtr   pub;
+
+        lib::new_shared(sub, true);
+        lib::new_shared(pub, items, batch);
+
+        pub >> sub;
+
+        threads.push_back(pub);
+        threads.push_back(sub);
+
+        auto start = std::chrono::steady_clock::now();
+        threads.startAll();
+        threads.joinAll();
+        std::chrono::duration<double> seconds(
+            std::chrono::steady_clock::now() - start
+        );
+
+        TEST_IS_EQUAL(sub->m_Items, items);
+
+        output(
+            vSummary
+          , lib::format(
+                "publishBatch of %3d:  %.0lf msgs/sec"
+              , batch
+              , items / seconds.count()
+            )
+        );
+    }
+
+    const int hops(64);
+    const int messages(20000);
+    double threaded = chain(hops, messages, 0, true);
+    double pooled = chain(hops, messages, 4, true);
+
+    output(
+        vSummary
+      , lib::format(
+            "chain of %d subscribers:  thread each %.0lf msgs/sec; "
+            "pool of 4 %.0lf msgs/sec"
+          , hops
+          , messages / threaded
+          , messages / pooled
+        )
+    );
+
+} // SubscriberTest::runTest3 //
+
+//------------------------------------------------------------------------------
+//  Method:  ringQueue                                                          
+//------------------------------------------------------------------------------
+void SubscriberTest::ringQueue()
+{
+    {
+        lib::mp::work::ThreadableCollection threads;
+
+        MyRingSubscriberTestPtr sub;
+        MyPublisherTestPtr  pub;
+
+        lib::new_shared(pub);
+        lib::new_shared(sub, this);
+
+        pub >> sub;
+
+        threads.push_back(pub);
+        threads.push_back(sub);
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST(sub->countInteger() == 5);
+        TEST(sub->countDouble() == 5);
+    }
+
+    {
+        lib::mp::work::ThreadableCollection threads;
+
+        CountingRingSubscriberPtr sub;
+        lib::new_shared(sub);
+        threads.push_back(sub);
+
+        for (int p = 0; p < 3; ++p) {
+            ManyPublisherPtr pub;
+            lib::new_shared(pub);
+            pub >> sub;
+            threads.push_back(pub);
+        }
+
+        threads.startAll();
+        threads.joinAll();
+
+        TEST(sub->m_Count == 30000);
+        TEST(sub->m_Sum == 3 * (int64_t(9999) * 10000 / 2));
+    }
+
+    {
+        lib::mp::work::RingQueue<int> q(5);
+        TEST(q.capacity() == 8);
+        TEST(q.governor() == 5);
+        TEST(q.empty());
+
+        for (int i = 0; i < 5; ++i) q.push(i);
+        TEST(q.size() == 5);
+        TEST(q.maximumSize() == 5);
+
+        int item(-1);
+        TEST(q.pop(item) && item == 0);
+        TEST(q.pop(item) && item == 1);
+
+        q.setInterrupt();
+        while (q.pop(item)) { }
+        TEST(item == 4);
+        TEST(q.empty());
+        TEST(!q.pop(item));
+
+        q.push(42);
+        q.abort();
+        TEST(q.empty());
+        TEST(!q.pop(item));
+    }
+
+} // SubscriberTest::ringQueue //
+
 } // namespace test //
 } // namespace msg //
 } // namespace lib //
@@ -19,6 +19,16 @@ namespace test {
 ///         The SubscriberTest class provides the regression test for the       
 ///         lib::msg::Subscriber class.                                         
 ///                                                                             
+///@version 2026-10-16  DHF     Added placement.                                
+///                                                                             
+///@version 2026-10-16  DHF     Added workStealingPool and chain.               
+///                                                                             
+///@version 2026-10-16  DHF     Added batches.                                  
+///                                                                             
+///@version 2026-10-16  DHF     Added fanIn and the runTest3 benchmark.         
+///                                                                             
+///@version 2026-10-16  DHF     Added ringQueue.                                
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2010-01-26  DHF     Changed outer namespace from tools to lib.      
@@ -44,8 +54,20 @@ class SubscriberTest : public dev::test::work::Test {
         ///          The runTest method executes the actual test.               
         //----------------------------------------------------------------------
         void runTest();
+        void runTest3();
 
     private:
+        void ringQueue();
+        double fanIn(bool single_queue, int count);
+        void batches();
+        void workStealingPool();
+        void placement();
+        double chain(
+            int length
+          , int count
+          , size_t pool_size
+          , bool single_queue
+        );
 
 };  // class SubscriberTest //
 
@@ -7,11 +7,51 @@
 #define LIB_MSG_SUBSCRIPTION_H_FILE_GUARD
 
 #include "lib_ds_shared_ptr.h"
+#include "lib_mp_work_queuepolicy.h"
 #include "lib_msg_subscriptionbase.h"
 
+#include <utility>
+#include <vector>
+
 namespace lib {
 namespace msg {
 
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Select the queue used by Subscription<TYPE> to hold items of TYPE.  
+///                                                                             
+///@par Purpose:                                                                
+///         The default is the std::deque based lib::mp::work::Queue.  A        
+///         high-rate type can be given the lock-free ring by specializing the  
+///         template (at namespace lib::msg scope) before the first Subscription
+///         of that type is instantiated:                                       
+///         @code                                                               
+///             namespace lib {                                                 
+///             namespace msg {                                                 
+///                 template <>                                                 
+///                 struct SubscriptionQueuePolicy<my::Frame>                   
+///                 {                                                           
+///                     using type = lib::mp::work::RingQueuePolicy;            
+///                 };                                                          
+///             }                                                               
+///             }                                                               
+///         @endcode                                                            
+///                                                                             
+///@par Design Decision:                                                        
+///         The policy is a trait on the subscribed-to type rather than a       
+///         template parameter of Subscription.  Publication, Publisher and the 
+///         connection helpers all name Subscription<TYPE>; a second parameter  
+///         would ripple through every one of them.                             
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+template <typename TYPE>
+struct SubscriptionQueuePolicy
+{
+    using type = lib::mp::work::DequeQueuePolicy;
+};
+
 //------------------------------------------------------------------------------
 ///                                                                             
 ///@par Class: Subscription                                                     
@@ -22,6 +62,12 @@ namespace msg {
 ///@tparam TYPE     The base type being subscribed to.  The actual object       
 ///                 passed will be boost::shared_ptr<const TYPE>.               
 ///                                                                             
+///@version 2026-10-16  DHF     Added batches (inboxBatch, process(Batch)).     
+///                                                                             
+///@version 2026-10-16  DHF     Added single queue mode (see Subscriber).       
+///                                                                             
+///@version 2026-10-16  DHF     Queue type chosen by SubscriptionQueuePolicy.   
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2020-02-11  KCG     Changed boost::shared_ptr to lib::ds::shared_ptr
@@ -58,6 +104,28 @@ class Subscription : public SubscriptionBase
         //----------------------------------------------------------------------
         virtual void process(lib::ds::shared_ptr<const TYPE>&  item) = 0;
 
+        //----------------------------------------------------------------------
+        ///@brief A group of items published (and queued) together.             
+        //----------------------------------------------------------------------
+        using Batch = std::vector<lib::ds::shared_ptr<const TYPE> >;
+
+        //----------------------------------------------------------------------
+        ///                                                                     
+        ///@brief Process a published batch of items.                           
+        ///                                                                     
+        ///       The default hands each item to process(item), in order.  A    
+        ///       derived class that can do better with the items all at once   
+        ///       (e.g., write them with one call) should override this.        
+        ///                                                                     
+        //----------------------------------------------------------------------
+        virtual void process(const Batch& items)
+        {
+            for (size_t i = 0; i < items.size(); ++i) {
+                lib::ds::shared_ptr<const TYPE> item(items[i]);
+                process(item);
+            }
+        }
+
         //----------------------------------------------------------------------
         ///                                                                     
         ///@brief Grab a published item off the queue and process it.           
@@ -74,6 +142,34 @@ class Subscription : public SubscriptionBase
 
         }
 
+        //----------------------------------------------------------------------
+        ///                                                                     
+        ///@brief Process an item the parent Subscriber queued for us (single   
+        ///       queue mode); the item is turned back into its real type.      
+        ///                                                                     
+        ///@note  Implements the SubscriptionBase::process pure virutal method. 
+        ///                                                                     
+        //----------------------------------------------------------------------
+        void processQueueItem(const lib::ds::shared_ptr<const void>& payload) {
+            lib::ds::shared_ptr<const TYPE> item(
+                payload
+              , static_cast<const TYPE*>(payload.get())
+            );
+
+            process(item);
+        }
+
+        //----------------------------------------------------------------------
+        ///                                                                     
+        ///@brief Process a batch the parent Subscriber queued for us.          
+        ///                                                                     
+        ///@note  Implements the SubscriptionBase::process pure virutal method. 
+        ///                                                                     
+        //----------------------------------------------------------------------
+        void processQueueBatch(const lib::ds::shared_ptr<const void>& payload) {
+            process(*static_cast<const Batch*>(payload.get()));
+        }
+
         //----------------------------------------------------------------------
         ///                                                                     
         ///@brief Receive another item from the Publisher to put onto our queue 
@@ -84,8 +180,33 @@ class Subscription : public SubscriptionBase
         ///                                                                     
         //----------------------------------------------------------------------
         virtual void inbox(lib::ds::shared_ptr<const TYPE>  item) {
-            m_Queue.push(item);
-            addToParentQueue(this);
+            if (isSingleQueue()) {
+                addToParentQueue(
+                    this
+                  , lib::ds::shared_ptr<const void>(std::move(item))
+                );
+            } else {
+                m_Queue.push(item);
+                addToParentQueue(this);
+            }
+        }
+
+        //----------------------------------------------------------------------
+        ///                                                                     
+        ///@brief Receive a batch of items from the Publisher.                  
+        ///                                                                     
+        ///       The batch goes to the parent's queue as a single entry in     
+        ///       either queue mode, so it crosses to the Subscriber's thread   
+        ///       with one lock and one wake up.                                
+        ///                                                                     
+        //----------------------------------------------------------------------
+        virtual void inboxBatch(lib::ds::shared_ptr<const Batch> items) {
+            if (items && !items->empty()) {
+                addBatchToParentQueue(
+                    this
+                  , lib::ds::shared_ptr<const void>(std::move(items))
+                );
+            }
         }
 
     protected:
@@ -97,8 +218,31 @@ class Subscription : public SubscriptionBase
         {
         }
 
+        //----------------------------------------------------------------------
+        ///@brief   Add the item and its payload to the master queue; used when 
+        ///         isSingleQueue() is true.                                    
+        //----------------------------------------------------------------------
+        virtual void addToParentQueue(
+            SubscriptionBase* item
+          , const lib::ds::shared_ptr<const void>& payload
+        )
+        {
+        }
+
+        //----------------------------------------------------------------------
+        ///@brief   Add the item and its batch of items to the master queue.    
+        //----------------------------------------------------------------------
+        virtual void addBatchToParentQueue(
+            SubscriptionBase* item
+          , const lib::ds::shared_ptr<const void>& batch
+        )
+        {
+        }
+
     private:
-        lib::mp::work::Queue<lib::ds::shared_ptr<const TYPE> > m_Queue;
+        typename SubscriptionQueuePolicy<TYPE>::type::template queue<
+            lib::ds::shared_ptr<const TYPE>
+        > m_Queue;
 
 }; // class Subscription //
 
@@ -6,14 +6,18 @@
 #ifndef LIB_MSG_SUBSCRIPTIONBASE_H_FILE_GUARD
 #define LIB_MSG_SUBSCRIPTIONBASE_H_FILE_GUARD
 
+#include "lib_ds_shared_ptr.h"
+
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/signals2.hpp>
+#include <functional>
 
 namespace lib {
 namespace msg {
 
 class PublisherBase;
+class PublisherSubscriberBase;
 
 //------------------------------------------------------------------------------
 ///@class SubscriptionBase                                                      
@@ -34,6 +38,14 @@ class PublisherBase;
 ///         In this way we can have a std::queue<SubscriptionBase*> and still   
 ///         get to the derived object's process method.                         
 ///                                                                             
+///@version 2026-10-16  DHF     Added addPublisher.                             
+///                                                                             
+///@version 2026-10-16  DHF     Added addDisconnect.                            
+///                                                                             
+///@version 2026-10-16  DHF     Added processQueueBatch; batch connection.      
+///                                                                             
+///@version 2026-10-16  DHF     Added single queue processQueueItem.            
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-08-30  DHF     Moved to its own file.                          
@@ -44,16 +56,46 @@ class PublisherBase;
 class SubscriptionBase 
 {
     public:
+        SubscriptionBase() : m_SingleQueue(false)
+        {
+        }
         virtual ~SubscriptionBase() 
         {
         }
         virtual void processQueueItem() = 0;
 
+        //----------------------------------------------------------------------
+        ///@brief   Process an item that was queued by the parent Subscriber    
+        ///         (single queue mode) rather than by this Subscription.       
+        ///@param   item    The published item with its type erased; the        
+        ///                 derived Subscription<TYPE> knows what it really is. 
+        //----------------------------------------------------------------------
+        virtual void processQueueItem(
+            const lib::ds::shared_ptr<const void>& item
+        ) = 0;
+
+        //----------------------------------------------------------------------
+        ///@brief   Process a batch of items queued by the parent Subscriber.   
+        ///@param   batch   The published batch with its type erased.           
+        //----------------------------------------------------------------------
+        virtual void processQueueBatch(
+            const lib::ds::shared_ptr<const void>& batch
+        ) = 0;
+
+        //----------------------------------------------------------------------
+        ///@brief   Return true if received items are handed directly to the    
+        ///         parent's queue rather than held in a per-type queue.        
+        //----------------------------------------------------------------------
+        bool isSingleQueue() const { return m_SingleQueue; }
+
         virtual int publicationCount() const = 0;
 
     protected:
+        void setSingleQueue(bool value) { m_SingleQueue = value; }
 
     private:
+        bool m_SingleQueue;
+
         //----------------------------------------------------------------------
         ///@brief  Allows Subscriber to track the number of subscriptions the   
         ///        object is listening for.                                     
@@ -78,9 +120,22 @@ class SubscriptionBase
         virtual void incrementPublicationCount(
             boost::signals2::connection& connection1
           , boost::signals2::connection& connection2
+          , boost::signals2::connection& connection3
         ) = 0;
         virtual void publicationEnding() = 0;
 
+        //----------------------------------------------------------------------
+        ///@brief   Remember a function to call (along with disconnecting the   
+        ///         above connections) to disconnect from a publisher.          
+        //----------------------------------------------------------------------
+        virtual void addDisconnect(const std::function<void ()>& disconnect) = 0;
+
+        //----------------------------------------------------------------------
+        ///@brief   Remember who connected to us (see                           
+        ///         PublisherSubscriberBase::publishers).                       
+        //----------------------------------------------------------------------
+        virtual void addPublisher(const PublisherSubscriberBase* publisher) { }
+
         //----------------------------------------------------------------------
         ///@todo    I hate friends (I know, I've said this before, repeatedly). 
         ///         The friend declaration can be eliminated by having a        
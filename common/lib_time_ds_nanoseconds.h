@@ -0,0 +1,181 @@
+//------------------------------------------------------------------------------
+///@file lib_time_ds_nanoseconds.h                                              
+///@brief Holds lib::time::ds::NanoSeconds, a time (or time difference) as one  
+///       signed count of nanoseconds.                                          
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_TIME_DS_NANOSECONDS_H_FILE_GUARD
+#define LIB_TIME_DS_NANOSECONDS_H_FILE_GUARD
+
+#include <stdint.h>
+#include <time.h>
+
+namespace lib {
+namespace time {
+namespace ds {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   A time since 1970 (or a time difference) in nanoseconds, with       
+///         constexpr integer arithmetic, comparisons and conversions.          
+///                                                                             
+///@par Purpose:                                                                
+///         DateTime and DeltaTime are timespecs:  every sum or difference      
+///         needs a carry between the seconds and the nanoseconds, and going    
+///         through their operator double() loses everything under about        
+///         100 ns at today's times.  A NanoSeconds is one int64_t, so adding,  
+///         subtracting and comparing are single instructions and exact.        
+///                                                                             
+///@par Range                                                                   
+///         64 bits of nanoseconds reach about 292 years either side of 1970    
+///         (1677-09-21 to 2262-04-11).  fromTimespec saturates outside that    
+///         (DateTime::maximum() is in 2500).  Products and ratios that would   
+///         overflow 64 bits on the way (scaling by a clock's frequency, say)   
+///         are worked in 128 bits:  see mulDiv.                                
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::time::ds::NanoSeconds t(begin.nanoSeconds());                  
+///         const lib::time::ds::NanoSeconds step(                              
+///             lib::time::ds::NanoSeconds::fromMicroSeconds(100)               
+///         );                                                                  
+///         for (size_t i = 0; i < count; ++i, t += step) {                     
+///             samples[i].m_Time = t.count();                                  
+///         }                                                                   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class NanoSeconds
+{
+    public:
+        static constexpr int64_t perSecond = 1000000000;
+
+        constexpr NanoSeconds() : m_Count(0) { }
+        explicit constexpr NanoSeconds(int64_t count) : m_Count(count) { }
+
+        //----------------------------------------------------------------------
+        //  Conversions in.                                                     
+        //----------------------------------------------------------------------
+        static constexpr NanoSeconds fromSeconds(int64_t seconds)
+            { return NanoSeconds(seconds * perSecond); }
+        static constexpr NanoSeconds fromMilliSeconds(int64_t milli_seconds)
+            { return NanoSeconds(milli_seconds * 1000000); }
+        static constexpr NanoSeconds fromMicroSeconds(int64_t micro_seconds)
+            { return NanoSeconds(micro_seconds * 1000); }
+        static constexpr NanoSeconds fromSeconds(
+            int64_t seconds
+          , int64_t nano_seconds
+        )
+        {
+            return saturate(__int128(seconds) * perSecond + nano_seconds);
+        }
+        static constexpr NanoSeconds fromTimespec(const timespec& time)
+            { return fromSeconds(int64_t(time.tv_sec), int64_t(time.tv_nsec)); }
+
+        static constexpr NanoSeconds maximum()
+            { return NanoSeconds(INT64_MAX); }
+        static constexpr NanoSeconds minimum()
+            { return NanoSeconds(INT64_MIN); }
+
+        //----------------------------------------------------------------------
+        //  Conversions out:  seconds() rounds down, so that                    
+        //  seconds() * perSecond + subSeconds() == count() and subSeconds()    
+        //  is in [0, perSecond), as a timespec wants them.                     
+        //----------------------------------------------------------------------
+        constexpr int64_t count() const { return m_Count; }
+        constexpr int64_t seconds() const
+        {
+            return m_Count / perSecond - (m_Count % perSecond < 0 ? 1 : 0);
+        }
+        constexpr int64_t subSeconds() const
+        {
+            return m_Count % perSecond + (m_Count % perSecond < 0 ? perSecond : 0);
+        }
+        constexpr double inSeconds() const
+        {
+            return double(seconds()) + double(subSeconds()) / double(perSecond);
+        }
+
+        void toTimespec(timespec& time) const
+        {
+            time.tv_sec = time_t(seconds());
+            time.tv_nsec = long(subSeconds());
+        }
+
+        //----------------------------------------------------------------------
+        //  count * numerator / denominator without overflowing on the way      
+        //  (truncated toward zero).                                            
+        //----------------------------------------------------------------------
+        constexpr NanoSeconds mulDiv(int64_t numerator, int64_t denominator) const
+        {
+            return NanoSeconds(
+                int64_t(__int128(m_Count) * numerator / denominator)
+            );
+        }
+
+        //----------------------------------------------------------------------
+        //  Arithmetic.                                                         
+        //----------------------------------------------------------------------
+        constexpr NanoSeconds operator+(NanoSeconds that) const
+            { return NanoSeconds(m_Count + that.m_Count); }
+        constexpr NanoSeconds operator-(NanoSeconds that) const
+            { return NanoSeconds(m_Count - that.m_Count); }
+        constexpr NanoSeconds operator-() const
+            { return NanoSeconds(-m_Count); }
+        constexpr NanoSeconds operator*(int64_t factor) const
+            { return NanoSeconds(m_Count * factor); }
+        constexpr NanoSeconds operator/(int64_t divisor) const
+            { return NanoSeconds(m_Count / divisor); }
+        constexpr int64_t operator/(NanoSeconds that) const
+            { return m_Count / that.m_Count; }
+        constexpr NanoSeconds operator%(NanoSeconds that) const
+            { return NanoSeconds(m_Count % that.m_Count); }
+
+        NanoSeconds& operator+=(NanoSeconds that)
+            { m_Count += that.m_Count; return *this; }
+        NanoSeconds& operator-=(NanoSeconds that)
+            { m_Count -= that.m_Count; return *this; }
+
+        //----------------------------------------------------------------------
+        //  Comparisons.                                                        
+        //----------------------------------------------------------------------
+        constexpr bool operator==(NanoSeconds that) const
+            { return m_Count == that.m_Count; }
+        constexpr bool operator!=(NanoSeconds that) const
+            { return m_Count != that.m_Count; }
+        constexpr bool operator<(NanoSeconds that) const
+            { return m_Count < that.m_Count; }
+        constexpr bool operator<=(NanoSeconds that) const
+            { return m_Count <= that.m_Count; }
+        constexpr bool operator>(NanoSeconds that) const
+            { return m_Count > that.m_Count; }
+        constexpr bool operator>=(NanoSeconds that) const
+            { return m_Count >= that.m_Count; }
+
+    private:
+        int64_t m_Count;
+
+        static constexpr NanoSeconds saturate(__int128 count)
+        {
+            return count > __int128(INT64_MAX) ? maximum()
+                 : count < __int128(INT64_MIN) ? minimum()
+                 : NanoSeconds(int64_t(count));
+        }
+
+}; // class NanoSeconds //
+
+constexpr NanoSeconds operator*(int64_t factor, NanoSeconds time)
+{
+    return time * factor;
+}
+
+} // namespace ds
+} // namespace time
+} // namespace lib
+
+#endif // #ifndef LIB_TIME_DS_NANOSECONDS_H_FILE_GUARD
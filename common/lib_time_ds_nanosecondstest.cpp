@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+///@file lib_time_ds_nanosecondstest.cpp                                        
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_time_ds_nanosecondstest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_time_ds_nanoseconds.h"
+#include "lib_time_work_datetime.h"
+#include "lib_time_work_deltatime.h"
+
+namespace lib {
+namespace time {
+namespace ds {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::time::ds::test::NanoSecondsTest);
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+NanoSecondsTest::NanoSecondsTest()
+    : Test("lib::time::ds::NanoSeconds")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    NanoSecondsTest object to copy.                          
+//------------------------------------------------------------------------------
+NanoSecondsTest::NanoSecondsTest(const NanoSecondsTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+NanoSecondsTest::~NanoSecondsTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+NanoSecondsTest& NanoSecondsTest::operator=(
+    const NanoSecondsTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // NanoSecondsTest::operator=(const NanoSecondsTest& that) //
+
+
+//------------------------------------------------------------------------------
+//  Worked out by the compiler:  the arithmetic is constexpr.                   
+//------------------------------------------------------------------------------
+static_assert(
+    NanoSeconds::fromSeconds(2) - NanoSeconds::fromMilliSeconds(1)
+        == NanoSeconds(1999000000)
+  , "NanoSeconds arithmetic is not constexpr"
+);
+
+//------------------------------------------------------------------------------
+/// @brief Test the conversions, the arithmetic and DateTime and DeltaTime      
+///        through NanoSeconds.                                                 
+//------------------------------------------------------------------------------
+void NanoSecondsTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  seconds() rounds down, so subSeconds() is never negative.               
+    //--------------------------------------------------------------------------
+    NanoSeconds t(-1500000000);
+    TEST_IS_EQUAL(t.seconds(), -2);
+    TEST_IS_EQUAL(t.subSeconds(), 500000000);
+    TEST_IS_EQUAL(NanoSeconds(1500000000).seconds(), 1);
+    TEST_IS_EQUAL(NanoSeconds(1500000000).subSeconds(), 500000000);
+    TEST_IS_EQUAL(NanoSeconds(-2000000000).seconds(), -2);
+    TEST_IS_EQUAL(NanoSeconds(-2000000000).subSeconds(), 0);
+
+    timespec ts;
+    t.toTimespec(ts);
+    TEST(NanoSeconds::fromTimespec(ts) == t);
+
+    //--------------------------------------------------------------------------
+    //  Outside of 64 bits, saturate.                                           
+    //--------------------------------------------------------------------------
+    TEST(NanoSeconds::fromSeconds(int64_t(1) << 40, 0) == NanoSeconds::maximum());
+    TEST(NanoSeconds::fromSeconds(-(int64_t(1) << 40), 0) == NanoSeconds::minimum());
+    TEST(
+        NanoSeconds::fromSeconds(9223372036, 999999999) == NanoSeconds::maximum()
+    );
+    TEST(
+        NanoSeconds::fromSeconds(9223372036, 854775807) == NanoSeconds::maximum()
+    );
+    TEST(
+        NanoSeconds::fromSeconds(9223372036, 854775806) < NanoSeconds::maximum()
+    );
+
+    //--------------------------------------------------------------------------
+    //  mulDiv does not overflow on the way:  a day at a 3 GHz clock.           
+    //--------------------------------------------------------------------------
+    const NanoSeconds day(NanoSeconds::fromSeconds(86400));
+    TEST_IS_EQUAL(
+        day.mulDiv(3000000000LL, NanoSeconds::perSecond).count()
+      , 259200000000000LL
+    );
+    TEST_IS_EQUAL((day / 3).count(), 28800000000000LL);
+    TEST_IS_EQUAL(day / NanoSeconds::fromSeconds(3600), 24);
+    TEST(day % NanoSeconds::fromSeconds(7) == NanoSeconds::fromSeconds(86400 % 7));
+    TEST(2 * day == day + day);
+    TEST(-day < day);
+
+    //--------------------------------------------------------------------------
+    //  Exact at today's times, where a double is not.                          
+    //--------------------------------------------------------------------------
+    lib::time::work::DateTime time;
+    time.setYMD(2026, 9, 16, 12, 0, 0, 123456789);
+    const NanoSeconds since_1970(time.nanoSeconds());
+    TEST_IS_EQUAL(since_1970.subSeconds(), 123456789);
+
+    lib::time::work::DateTime round_trip(since_1970 + NanoSeconds(1));
+    TEST_IS_EQUAL(round_trip.tv_sec, time.tv_sec);
+    TEST_IS_EQUAL(round_trip.tv_nsec, 123456790);
+    TEST(round_trip - time == lib::time::work::DeltaTime(NanoSeconds(1)));
+
+    lib::time::work::DeltaTime delta(NanoSeconds(-1));
+    TEST_IS_EQUAL(delta.tv_sec, -1);
+    TEST_IS_EQUAL(delta.tv_nsec, 999999999);
+    TEST((time + delta).nanoSeconds() == since_1970 - NanoSeconds(1));
+
+    int64_t nano(0);
+    delta.getNanoSeconds(nano);
+    TEST_IS_EQUAL(nano, -1);
+
+    //--------------------------------------------------------------------------
+    //  adjust carries however far tv_nsec is out.                              
+    //--------------------------------------------------------------------------
+    delta.tv_sec = 0;
+    delta.tv_nsec = -2500000000L;
+    delta.adjust();
+    TEST_IS_EQUAL(delta.tv_sec, -3);
+    TEST_IS_EQUAL(delta.tv_nsec, 500000000);
+
+    delta.setSeconds(-1.25);
+    TEST_IS_EQUAL(delta.tv_sec, -2);
+    TEST_IS_EQUAL(delta.tv_nsec, 750000000);
+
+} // void NanoSecondsTest::runTest() //
+
+} // namespace test
+} // namespace ds
+} // namespace time
+} // namespace lib
+
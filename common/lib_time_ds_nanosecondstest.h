@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+///@file lib_time_ds_nanosecondstest.h                                          
+//------------------------------------------------------------------------------
+#ifndef LIB_TIME_DS_NANOSECONDSTEST_H
+#define LIB_TIME_DS_NANOSECONDSTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace time {
+namespace ds {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: NanoSecondsTest                                               
+///                                                                             
+///@par Purpose:                                                                
+///         The NanoSecondsTest class provides the regression test for       
+///         the lib::time::ds::NanoSeconds class.                               
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class NanoSecondsTest : public dev::test::work::Test {
+    public:
+        NanoSecondsTest();
+        NanoSecondsTest(const NanoSecondsTest& that);
+        virtual ~NanoSecondsTest();
+        NanoSecondsTest& operator=(const NanoSecondsTest& that);
+
+    protected:
+        void runTest();
+
+    private:
+
+}; //  class NanoSecondsTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace ds
+} // namespace time
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_TIME_DS_NANOSECONDSTEST_H //
@@ -0,0 +1,424 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_clock.cpp                                                
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_time_work_clock.h"
+#include "lib_si_ds_prefixes.h"
+
+#include <atomic>
+#include <time.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LIB_TIME_WORK_CLOCK_TSC
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#ifdef _WIN32
+#include <sys/time.h>
+#endif
+
+namespace lib {
+namespace time {
+namespace work {
+
+using lib::time::ds::NanoSeconds;
+
+//------------------------------------------------------------------------------
+//  The counter's ticks are turned into nanoseconds with a 32.32 fixed point    
+//  scale (nanoseconds per tick << 32).                                         
+//------------------------------------------------------------------------------
+static const int s_ScaleShift(32);
+static const uint64_t s_UnitScale(uint64_t(1) << s_ScaleShift);
+
+//------------------------------------------------------------------------------
+//  How long the first calibration of the counter takes, and how far a later    
+//  one may move the rate (parts per million) before it is taken as a step      
+//  in the wall clock rather than drift.                                        
+//------------------------------------------------------------------------------
+static const int64_t s_CalibrationNanos(10000000);
+static const int64_t s_MaximumDriftPpm(1000);
+
+//------------------------------------------------------------------------------
+//  The anchor:  the wall clock (in ns) at a tick (of the counter or of         
+//  CLOCK_MONOTONIC), published under a sequence count so that now() never      
+//  locks.  The sequence is odd while the anchor is being written.              
+//------------------------------------------------------------------------------
+struct Anchor
+{
+    std::atomic<uint32_t>   m_Sequence;
+    std::atomic<uint64_t>   m_Tick;
+    std::atomic<int64_t>    m_Wall;
+    std::atomic<uint64_t>   m_Scale;
+    std::atomic<int64_t>    m_ResyncTicks;
+};
+
+static std::atomic<int>     s_Source(int(Clock::Source::realtime));
+static std::atomic<int64_t> s_ResyncNanos(lib::si::ds::nano);
+static std::atomic<uint64_t> s_ElapsedScale(s_UnitScale);
+static std::atomic_flag     s_Anchoring = ATOMIC_FLAG_INIT;
+static Anchor               s_Anchor;
+
+//------------------------------------------------------------------------------
+//  Read a POSIX clock in nanoseconds.                                          
+//------------------------------------------------------------------------------
+#ifndef _WIN32
+static int64_t readClock(clockid_t id)
+{
+    timespec t;
+    clock_gettime(id, &t);
+    return NanoSeconds::fromTimespec(t).count();
+}
+#else
+#ifndef CLOCK_REALTIME
+#define CLOCK_REALTIME  0
+#define CLOCK_MONOTONIC 1
+#endif
+static int64_t readClock(int)
+{
+    timeval t;
+    gettimeofday(&t, NULL);
+    return int64_t(t.tv_sec) * lib::si::ds::nano + int64_t(t.tv_usec) * 1000;
+}
+#endif
+
+static int64_t realtimeCoarse()
+{
+    #ifdef CLOCK_REALTIME_COARSE
+    return readClock(CLOCK_REALTIME_COARSE);
+    #else
+    return readClock(CLOCK_REALTIME);
+    #endif
+}
+
+static int64_t monotonicCoarse()
+{
+    #ifdef CLOCK_MONOTONIC_COARSE
+    return readClock(CLOCK_MONOTONIC_COARSE);
+    #else
+    return readClock(CLOCK_MONOTONIC);
+    #endif
+}
+
+//------------------------------------------------------------------------------
+//  The time stamp counter (0 where there is none).                             
+//------------------------------------------------------------------------------
+static inline uint64_t readTsc()
+{
+    #ifdef LIB_TIME_WORK_CLOCK_TSC
+    return __rdtsc();
+    #else
+    return 0;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+//  The source's tick:  the counter for tsc, otherwise CLOCK_MONOTONIC in ns.   
+//------------------------------------------------------------------------------
+static inline uint64_t readTick(Clock::Source source)
+{
+    return source == Clock::Source::tsc
+         ? readTsc()
+         : uint64_t(readClock(CLOCK_MONOTONIC));
+}
+
+//------------------------------------------------------------------------------
+//  A tick and the wall clock read as close together as we can:  the            
+//  tightest of a few tries, the tick taken halfway across the read.            
+//------------------------------------------------------------------------------
+static void readPair(Clock::Source source, uint64_t& tick, int64_t& wall)
+{
+    uint64_t best(UINT64_MAX);
+    for (int i = 0; i < 3; ++i) {
+        const uint64_t before(readTick(source));
+        const int64_t w(readClock(CLOCK_REALTIME));
+        const uint64_t after(readTick(source));
+        if (after - before < best) {
+            best = after - before;
+            tick = before + (after - before) / 2;
+            wall = w;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//  Convert ticks (of either sign) to nanoseconds at scale.                     
+//------------------------------------------------------------------------------
+static inline int64_t scaled(int64_t ticks, uint64_t scale)
+{
+    return int64_t((__int128(ticks) * __int128(scale)) >> s_ScaleShift);
+}
+
+//------------------------------------------------------------------------------
+//  Publish a new anchor.  The caller holds s_Anchoring.                        
+//------------------------------------------------------------------------------
+static void publish(uint64_t tick, int64_t wall, uint64_t scale)
+{
+    const int64_t resync_ticks(
+        int64_t((__int128(s_ResyncNanos.load()) << s_ScaleShift) / scale)
+    );
+
+    s_Anchor.m_Sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    s_Anchor.m_Tick.store(tick, std::memory_order_relaxed);
+    s_Anchor.m_Wall.store(wall, std::memory_order_relaxed);
+    s_Anchor.m_Scale.store(scale, std::memory_order_relaxed);
+    s_Anchor.m_ResyncTicks.store(resync_ticks, std::memory_order_relaxed);
+
+    s_Anchor.m_Sequence.fetch_add(1, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+//  Re-anchor source to the wall clock; for tsc, refine the rate from the time  
+//  since the last anchor (unless the wall clock was stepped meanwhile).        
+//  The caller holds s_Anchoring.                                               
+//------------------------------------------------------------------------------
+static void anchor(Clock::Source source)
+{
+    uint64_t tick(0);
+    int64_t wall(0);
+    readPair(source, tick, wall);
+
+    uint64_t scale(s_Anchor.m_Scale.load(std::memory_order_relaxed));
+    if (source != Clock::Source::tsc) {
+        scale = s_UnitScale;
+
+    } else {
+        const int64_t ticks(
+            int64_t(tick - s_Anchor.m_Tick.load(std::memory_order_relaxed))
+        );
+        const int64_t nanos(
+            wall - s_Anchor.m_Wall.load(std::memory_order_relaxed)
+        );
+        if (ticks > 0 && nanos > 0) {
+            const uint64_t refined(
+                uint64_t((__int128(nanos) << s_ScaleShift) / ticks)
+            );
+            const int64_t change(int64_t(refined) - int64_t(scale));
+            const int64_t ppm(
+                int64_t(__int128(change) * 1000000 / int64_t(scale))
+            );
+            if (ppm < s_MaximumDriftPpm && ppm > -s_MaximumDriftPpm) {
+                scale = refined;
+            }
+        }
+    }
+
+    publish(tick, wall, scale);
+}
+
+//------------------------------------------------------------------------------
+//  Take (and give back) the right to write the anchor.                         
+//------------------------------------------------------------------------------
+static void lockAnchor()
+{
+    while (s_Anchoring.test_and_set(std::memory_order_acquire)) { }
+}
+
+static void unlockAnchor()
+{
+    s_Anchoring.clear(std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+///@brief   Select where now() gets the time.                                   
+///@return  false if source is not available here (tsc without an invariant     
+///         counter):  monotonic is used instead.                               
+///@note    Selecting tsc calibrates the counter, which takes 10 ms.            
+//------------------------------------------------------------------------------
+bool Clock::setSource(Source source)
+{
+    bool result(true);
+    if (source == Source::tsc && !hasInvariantTsc()) {
+        source = Source::monotonic;
+        result = false;
+    }
+
+    lockAnchor();
+
+    if (source == Source::tsc) {
+        uint64_t tick0(0), tick1(0);
+        int64_t wall0(0), wall1(0);
+        readPair(source, tick0, wall0);
+
+        const int64_t until(readClock(CLOCK_MONOTONIC) + s_CalibrationNanos);
+        while (readClock(CLOCK_MONOTONIC) < until) { }
+
+        readPair(source, tick1, wall1);
+
+        const uint64_t scale(
+            uint64_t(
+                (__int128(wall1 - wall0) << s_ScaleShift) / (tick1 - tick0)
+            )
+        );
+        s_ElapsedScale.store(scale);
+        publish(tick1, wall1, scale);
+
+    } else if (source == Source::monotonic) {
+        anchor(source);
+
+    }
+
+    s_Source.store(int(source), std::memory_order_release);
+
+    unlockAnchor();
+
+    return result;
+
+} // bool Clock::setSource(Source source) //
+
+//------------------------------------------------------------------------------
+///@brief   Return where now() gets the time.                                   
+//------------------------------------------------------------------------------
+Clock::Source Clock::source()
+{
+    return Source(s_Source.load(std::memory_order_acquire));
+}
+
+//------------------------------------------------------------------------------
+///@brief   Return the time (since 1970) from the selected source.              
+//------------------------------------------------------------------------------
+NanoSeconds Clock::now()
+{
+    const Source source(Source(s_Source.load(std::memory_order_relaxed)));
+
+    switch (source) {
+        case Source::realtime:
+            return NanoSeconds(readClock(CLOCK_REALTIME));
+
+        case Source::realtimeCoarse:
+            return NanoSeconds(realtimeCoarse());
+
+        default:
+            break;
+    }
+
+    const uint64_t tick(readTick(source));
+
+    uint64_t base;
+    int64_t wall;
+    uint64_t scale;
+    int64_t resync_ticks;
+    uint32_t sequence;
+    do {
+        sequence = s_Anchor.m_Sequence.load(std::memory_order_acquire);
+        base = s_Anchor.m_Tick.load(std::memory_order_relaxed);
+        wall = s_Anchor.m_Wall.load(std::memory_order_relaxed);
+        scale = s_Anchor.m_Scale.load(std::memory_order_relaxed);
+        resync_ticks = s_Anchor.m_ResyncTicks.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while (
+        (sequence & 1) != 0
+     || sequence != s_Anchor.m_Sequence.load(std::memory_order_relaxed)
+    );
+
+    //--------------------------------------------------------------------------
+    //  Due a resynchronisation:  one thread does it, the rest carry on with    
+    //  the old anchor.                                                         
+    //--------------------------------------------------------------------------
+    const int64_t since(int64_t(tick - base));
+    if (
+        since > resync_ticks
+     && !s_Anchoring.test_and_set(std::memory_order_acquire)
+    ) {
+        anchor(source);
+        unlockAnchor();
+        return now();
+    }
+
+    return NanoSeconds(wall + scaled(since, scale));
+
+} // NanoSeconds Clock::now() //
+
+//------------------------------------------------------------------------------
+///@brief   Return a time for measuring intervals:  it never goes backward and  
+///         counts from an arbitrary start (not 1970).                          
+//------------------------------------------------------------------------------
+NanoSeconds Clock::elapsed()
+{
+    switch (Source(s_Source.load(std::memory_order_relaxed))) {
+        case Source::tsc:
+            return NanoSeconds(
+                scaled(
+                    int64_t(readTsc())
+                  , s_ElapsedScale.load(std::memory_order_relaxed)
+                )
+            );
+
+        case Source::realtimeCoarse:
+            return NanoSeconds(monotonicCoarse());
+
+        default:
+            return NanoSeconds(readClock(CLOCK_MONOTONIC));
+    }
+
+} // NanoSeconds Clock::elapsed() //
+
+//------------------------------------------------------------------------------
+///@brief   Set how often monotonic and tsc are re-anchored to the wall clock.  
+//------------------------------------------------------------------------------
+void Clock::setResyncInterval(NanoSeconds interval)
+{
+    s_ResyncNanos.store(interval.count());
+    resynchronize();
+}
+
+//------------------------------------------------------------------------------
+///@brief   Return how often monotonic and tsc are re-anchored.                 
+//------------------------------------------------------------------------------
+NanoSeconds Clock::resyncInterval()
+{
+    return NanoSeconds(s_ResyncNanos.load());
+}
+
+//------------------------------------------------------------------------------
+///@brief   Re-anchor now (after setting the wall clock, say).                  
+//------------------------------------------------------------------------------
+void Clock::resynchronize()
+{
+    lockAnchor();
+    const Source current(source());
+    if (current == Source::monotonic || current == Source::tsc) {
+        anchor(current);
+    }
+    unlockAnchor();
+}
+
+//------------------------------------------------------------------------------
+///@brief   Return true if the CPU's time stamp counter runs at a constant rate 
+///         in every power state (CPUID 8000_0007h, EDX bit 8).                 
+//------------------------------------------------------------------------------
+bool Clock::hasInvariantTsc()
+{
+    #ifdef LIB_TIME_WORK_CLOCK_TSC
+    static const bool s_Invariant([]() {
+        unsigned int eax(0), ebx(0), ecx(0), edx(0);
+        if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) return false;
+        __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+        return (edx & (1u << 8)) != 0;
+    }());
+    return s_Invariant;
+    #else
+    return false;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+///@brief   Return the counter's measured rate (Hz); 0 unless the source is tsc.
+//------------------------------------------------------------------------------
+double Clock::tscFrequency()
+{
+    if (source() != Source::tsc) return 0.0;
+
+    return double(lib::si::ds::nano) * double(s_UnitScale)
+         / double(s_Anchor.m_Scale.load(std::memory_order_relaxed));
+}
+
+} // namespace work
+} // namespace time
+} // namespace lib
@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_clock.h                                                  
+///@brief Holds lib::time::work::Clock, where DateTime::now() gets the time.    
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_TIME_WORK_CLOCK_H_FILE_GUARD
+#define LIB_TIME_WORK_CLOCK_H_FILE_GUARD
+
+#include "lib_time_ds_nanoseconds.h"
+
+#include <stdint.h>
+
+namespace lib {
+namespace time {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   The source of the current time for DateTime::now() (and so for      
+///         WallTime, dev::debug::Time and every log Message).                  
+///                                                                             
+///@par Purpose:                                                                
+///         DateTime::now() read CLOCK_REALTIME every time.  That is cheap      
+///         enough for a time stamp now and then, but not for one on every      
+///         message of a busy pipeline.  The process picks its source once:     
+///             -   realtime:  clock_gettime(CLOCK_REALTIME); the default.      
+///             -   realtimeCoarse:  CLOCK_REALTIME_COARSE; a few ns, but only  
+///                 as fine as the kernel tick (1 to 4 ms).                     
+///             -   monotonic:  CLOCK_MONOTONIC plus the offset to the wall     
+///                 clock; not stepped when the wall clock is set.              
+///             -   tsc:  the CPU's time stamp counter scaled to nanoseconds.   
+///                 A few ns and as fine as the counter.  Only where the        
+///                 counter is invariant (constant rate, all cores in step);    
+///                 elsewhere setSource gives monotonic instead.                
+///                                                                             
+///@par Resynchronisation                                                       
+///         monotonic and tsc are anchored to CLOCK_REALTIME and re-anchored    
+///         every resynchronisation interval (a second unless set):  the        
+///         first now() after the interval reads CLOCK_REALTIME again and       
+///         (for tsc) refines the counter's rate from the interval just gone.   
+///         Between anchors now() may be off the wall clock by the drift of     
+///         one interval (and by any step in the wall clock).                   
+///                                                                             
+///@par elapsed()                                                               
+///         For measuring intervals use elapsed():  it never goes backward      
+///         (the counter, or CLOCK_MONOTONIC) and is as cheap as now().         
+///                                                                             
+///@par Thread Safety:  class                                                   
+///         Select the source before starting threads; now() is safe from any   
+///         thread.                                                             
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         using lib::time::work::Clock;                                       
+///         Clock::setSource(Clock::Source::tsc);                               
+///         ...                                                                 
+///         lib::time::work::DateTime stamp(lib::time::work::DateTime::now());  
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class Clock
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   Where now() gets the time.                                  
+        //----------------------------------------------------------------------
+        enum class Source {
+            realtime        ///< CLOCK_REALTIME on every call.
+          , realtimeCoarse  ///< CLOCK_REALTIME_COARSE on every call.
+          , monotonic       ///< CLOCK_MONOTONIC, anchored to the wall clock.
+          , tsc             ///< The time stamp counter, anchored likewise.
+        };
+
+        static bool setSource(Source source);
+        static Source source();
+
+        static lib::time::ds::NanoSeconds now();
+        static lib::time::ds::NanoSeconds elapsed();
+
+        static void setResyncInterval(lib::time::ds::NanoSeconds interval);
+        static lib::time::ds::NanoSeconds resyncInterval();
+        static void resynchronize();
+
+        static bool hasInvariantTsc();
+        static double tscFrequency();
+
+    private:
+        Clock();
+
+}; // class Clock //
+
+} // namespace work
+} // namespace time
+} // namespace lib
+
+#endif // #ifndef LIB_TIME_WORK_CLOCK_H_FILE_GUARD
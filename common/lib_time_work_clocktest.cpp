@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_clocktest.cpp                                            
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_time_work_clocktest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_string.h"
+#include "lib_time_work_clock.h"
+#include "lib_time_work_datetime.h"
+
+#include <chrono>
+#include <stdlib.h>
+#include <time.h>
+
+namespace lib {
+namespace time {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::time::work::test::ClockTest);
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+ClockTest::ClockTest()
+    : Test("lib::time::work::Clock")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    ClockTest object to copy.                                   
+//------------------------------------------------------------------------------
+ClockTest::ClockTest(const ClockTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+ClockTest::~ClockTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+ClockTest& ClockTest::operator=(
+    const ClockTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // ClockTest::operator=(const ClockTest& that) //
+
+
+using lib::time::ds::NanoSeconds;
+
+//------------------------------------------------------------------------------
+//  The sources, and what to call them.                                         
+//------------------------------------------------------------------------------
+static const Clock::Source s_Sources[] = {
+    Clock::Source::realtime
+  , Clock::Source::realtimeCoarse
+  , Clock::Source::monotonic
+  , Clock::Source::tsc
+};
+
+static const char* name(Clock::Source source)
+{
+    switch (source) {
+        case Clock::Source::realtime:       return "realtime";
+        case Clock::Source::realtimeCoarse: return "realtimeCoarse";
+        case Clock::Source::monotonic:      return "monotonic";
+        case Clock::Source::tsc:            return "tsc";
+    }
+    return "?";
+}
+
+//------------------------------------------------------------------------------
+//  How far source's now() is from CLOCK_REALTIME (ns).                         
+//------------------------------------------------------------------------------
+static int64_t offset()
+{
+    timespec t;
+    clock_gettime(CLOCK_REALTIME, &t);
+    return llabs((Clock::now() - NanoSeconds::fromTimespec(t)).count());
+}
+
+//------------------------------------------------------------------------------
+/// @brief Each source keeps to the wall clock, and elapsed() never goes back.  
+//------------------------------------------------------------------------------
+void ClockTest::runTest()
+{
+    const int64_t close(50000000);
+
+    TEST(Clock::source() == Clock::Source::realtime);
+
+    for (auto source : s_Sources) {
+        const bool selected(Clock::setSource(source));
+        if (source == Clock::Source::tsc) {
+            TEST(selected == Clock::hasInvariantTsc());
+            TEST(
+                Clock::source()
+             == (selected ? Clock::Source::tsc : Clock::Source::monotonic)
+            );
+            TEST(!selected || Clock::tscFrequency() > 1e8);
+        } else {
+            TEST(selected);
+            TEST(Clock::source() == source);
+        }
+
+        TEST(offset() < close);
+
+        DateTime now(DateTime::now());
+        TEST(llabs((now.nanoSeconds() - Clock::now()).count()) < close);
+
+        NanoSeconds last(Clock::elapsed());
+        bool forward(true);
+        for (int i = 0; i < 10000; ++i) {
+            NanoSeconds next(Clock::elapsed());
+            if (next < last) forward = false;
+            last = next;
+        }
+        TEST(forward);
+
+        //----------------------------------------------------------------------
+        //  Resynchronised (and, for tsc, refined) every millisecond.           
+        //----------------------------------------------------------------------
+        Clock::setResyncInterval(NanoSeconds::fromMilliSeconds(1));
+        auto until(
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(20)
+        );
+        int64_t worst(0);
+        while (std::chrono::steady_clock::now() < until) {
+            const int64_t o(offset());
+            if (o > worst) worst = o;
+        }
+        TEST(worst < close);
+        output(
+            vSummary
+          , lib::format(
+                "%-16s worst offset %lld ns", name(source), (long long) worst
+            )
+        );
+
+        Clock::setResyncInterval(NanoSeconds::fromSeconds(1));
+        TEST(Clock::resyncInterval() == NanoSeconds::fromSeconds(1));
+    }
+
+    Clock::setSource(Clock::Source::realtime);
+    TEST(Clock::source() == Clock::Source::realtime);
+
+} // void ClockTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure now() from each source.                                      
+//------------------------------------------------------------------------------
+void ClockTest::runTest3()
+{
+    const int count(1000000);
+
+    for (auto source : s_Sources) {
+        Clock::setSource(source);
+
+        int64_t sum(0);
+        auto start(std::chrono::steady_clock::now());
+        for (int i = 0; i < count; ++i) {
+            sum += Clock::now().count();
+        }
+        std::chrono::duration<double> took(
+            std::chrono::steady_clock::now() - start
+        );
+        TEST(sum != 0);
+
+        output(
+            vSummary
+          , lib::format(
+                "%-16s now() %6.1lf ns"
+              , name(Clock::source())
+              , took.count() * 1e9 / count
+            )
+        );
+    }
+
+    Clock::setSource(Clock::Source::realtime);
+
+} // void ClockTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace time
+} // namespace lib
+
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_clocktest.h                                              
+//------------------------------------------------------------------------------
+#ifndef LIB_TIME_WORK_CLOCKTEST_H
+#define LIB_TIME_WORK_CLOCKTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace time {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: ClockTest                                                       
+///                                                                             
+///@par Purpose:                                                                
+///         The ClockTest class provides the regression test for                
+///         the lib::time::work::Clock class.                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class ClockTest : public dev::test::work::Test {
+    public:
+        ClockTest();
+        ClockTest(const ClockTest& that);
+        virtual ~ClockTest();
+        ClockTest& operator=(const ClockTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class ClockTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace time
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_TIME_WORK_CLOCKTEST_H //
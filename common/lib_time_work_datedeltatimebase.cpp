@@ -4,6 +4,10 @@
 ///                                                                             
 ///@brief   Base class used by lib::DateTime and lib::DeltaTime.                
 ///                                                                             
+///@version 2026-10-16  DHF     adjust carries in one step; setNanoSeconds and  
+///                             getNanoSeconds go through NanoSeconds;          
+///                             setSeconds of a negative time fixed.            
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2014-10-01  DHF     Break out class from lib_datetime.cpp           
@@ -20,19 +24,19 @@ namespace time {
 namespace work {
 
 //------------------------------------------------------------------------------
-///@brief   Adjust the date/time that has a negative nsec.                      
+///@brief   Adjust the date/time so that 0 <= tv_nsec < one second.             
+///@note    A sum or difference of adjusted times needs at most one carry, but  
+///         tv_nsec may be anything (setting it directly, say).                 
 //------------------------------------------------------------------------------
 void DateDeltaTimeBase::adjust()
 {
+    const int64_t nano(lib::si::ds::nano);
+    if (int64_t(tv_nsec) < 0 || int64_t(tv_nsec) >= nano) {
+        int64_t carry(int64_t(tv_nsec) / nano);
+        if (int64_t(tv_nsec) % nano < 0) --carry;
 
-    while (int64_t(tv_nsec) < 0) {
-        --tv_sec;
-        tv_nsec += lib::si::ds::nano;
-    }
-
-    while (tv_nsec >= int64_t(lib::si::ds::nano)) {
-        ++tv_sec;
-        tv_nsec -= lib::si::ds::nano;
+        tv_sec += carry;
+        tv_nsec -= carry * nano;
     }
 
 }
@@ -41,57 +45,27 @@ void DateDeltaTimeBase::adjust()
 //------------------------------------------------------------------------------
 void DateDeltaTimeBase::setNanoSeconds(int64_t nano)
 {
-    if (nano < 0) {
-        nano *= (-1);
-
-        tv_sec = (nano / lib::si::ds::nano) * (-1);
-        tv_nsec = (nano % lib::si::ds::nano) * (-1);
-
-        adjust();
-
-    } else {
-        tv_sec = nano / lib::si::ds::nano;
-        tv_nsec = nano % lib::si::ds::nano;
-
-    }
+    setNanoSeconds(lib::time::ds::NanoSeconds(nano));
 }
 
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 void DateDeltaTimeBase::getNanoSeconds(int64_t& nano) const
 {
-    nano = 0;
-    if (tv_sec < 0) {
-        int64_t temp_sec = tv_sec * (-1);
-        int64_t temp_nsec = tv_nsec;
-        if (tv_nsec < 0) temp_nsec = tv_nsec * (-1);
-
-        nano = temp_sec * lib::si::ds::nano + temp_nsec;
-        nano = nano * (-1);
-    } else {
-        nano = tv_sec * lib::si::ds::nano + tv_nsec;
-    }
+    nano = nanoSeconds().count();
 }
 
 //------------------------------------------------------------------------------
+///@brief   Set the time from seconds (as near as a double holds them).         
 //------------------------------------------------------------------------------
 void DateDeltaTimeBase::setSeconds(double seconds)
 {
-    if (seconds == 0) {
-        tv_sec = tv_nsec = 0;
+    const double whole(floor(seconds));
 
-    } else if (seconds > 0) {
-        tv_sec = floor(seconds);
-        tv_nsec = round((seconds - tv_sec) * lib::si::ds::nano);
+    tv_sec = time_t(whole);
+    tv_nsec = long(round((seconds - whole) * lib::si::ds::nano));
 
-    } else {
-        seconds *= -1;
-        tv_sec = floor(seconds);
-        tv_nsec = round((seconds - tv_nsec) * lib::si::ds::nano);
-
-        tv_sec *= -1;
-        tv_nsec *= -1;
-    }
+    adjust();
 }
 
 //------------------------------------------------------------------------------
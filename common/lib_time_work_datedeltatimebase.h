@@ -6,6 +6,8 @@
 #ifndef LIB_TIME_WORK_DATEDELTATIMEBASE_H_FILE_GUARD
 #define LIB_TIME_WORK_DATEDELTATIMEBASE_H_FILE_GUARD
 
+#include "lib_time_ds_nanoseconds.h"
+
 #include <stdint.h>
 #include <time.h>
 #ifndef IS_VISUAL_STUDIO
@@ -31,6 +33,9 @@ namespace work {
 ///         Frankly, you're not expected to use this class.  Only DateTime and  
 ///         DeltaTime should be using it.                                       
 ///                                                                             
+///@version 2026-10-16  DHF     Added nanoSeconds() and the NanoSeconds         
+///                             constructor and setNanoSeconds.                 
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-08-02  DHF     Renamed seconds to inSeconds.                   
@@ -46,11 +51,22 @@ class DateDeltaTimeBase : public timespec
     public:
         DateDeltaTimeBase() : m_IsSmoothed(false) {tv_sec = tv_nsec = 0;}
         DateDeltaTimeBase(const DateDeltaTimeBase& that) = default;
+        explicit DateDeltaTimeBase(lib::time::ds::NanoSeconds time)
+            : m_IsSmoothed(false) { time.toTimespec(*this); }
 
         DateDeltaTimeBase& operator=(const DateDeltaTimeBase& that) = default;
 
         void setNanoSeconds(int64_t nano);
         void getNanoSeconds(int64_t& nano) const;
+
+        //----------------------------------------------------------------------
+        //  The time as one integer:  what to do arithmetic on in a loop.       
+        //----------------------------------------------------------------------
+        lib::time::ds::NanoSeconds nanoSeconds() const
+            { return lib::time::ds::NanoSeconds::fromTimespec(*this); }
+        void setNanoSeconds(lib::time::ds::NanoSeconds time)
+            { time.toTimespec(*this); }
+
         void setSeconds(double seconds);
 
         void adjust();
@@ -12,6 +12,12 @@
 ///                                                                             
 ///@par Thread Safety:  class                                                   
 ///                                                                             
+///@version 2026-10-16  DHF     now() reads lib::time::work::Clock.             
+///                                                                             
+///@version 2026-10-16  DHF     fromString scans the common formats by hand     
+///                             (DateTimeParser); the regular expressions are   
+///                             left for the rest (fromPattern).                
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2019-06-07  DHF     Added "smoothed" functionality.                 
@@ -50,6 +56,8 @@
 ///                                                                             
 //------------------------------------------------------------------------------
 #include "lib_time_work_datetime.h"
+#include "lib_time_work_clock.h"
+#include "lib_time_work_datetimeparser.h"
 #include "lib_si_ds_prefixes.h"
 #include "lib_string.h"
 #include "lib_time_ds.h"
@@ -165,6 +173,21 @@ DateTime& DateTime::operator=(const std::string& that)
 ///                                                                             
 //------------------------------------------------------------------------------
 bool DateTime::fromString(const std::string& str, bool strict)
+{
+    DateTimeParser::Format format;
+    if (DateTimeParser::scan(str.data(), str.size(), *this, strict, format)) {
+        return true;
+    }
+
+    return fromPattern(str, strict);
+
+} // bool DateTime::fromString(const std::string& str)
+
+//------------------------------------------------------------------------------
+///@brief   fromString by regular expression alone:  what fromString falls      
+///         back to for the formats DateTimeParser does not scan.               
+//------------------------------------------------------------------------------
+bool DateTime::fromPattern(const std::string& str, bool strict)
 {
     bool result = true;
     bool dddFormat = false;
@@ -295,31 +318,16 @@ bool DateTime::fromString(const std::string& str, bool strict)
     
     return result;
         
-} // bool DateTime::fromString(const std::string& str)
+} // bool DateTime::fromPattern(const std::string& str, bool strict)
 
 //------------------------------------------------------------------------------
 ///@brief   Return the current system time as a DateTime object.                
+///@note    The time comes from Clock's selected source (CLOCK_REALTIME unless   
+///         changed).                                                           
 //------------------------------------------------------------------------------
 DateTime DateTime::now()
 {
-    DateTime result;
-
-    #ifndef _WIN32
-
-    clock_gettime(CLOCK_REALTIME, &result);
-
-    #else 
-    
-    timeval t;
-    gettimeofday(&t, NULL);
-    result.tv_sec = t.tv_sec;
-    result.tv_nsec = t.tv_usec * (lib::si::ds::nano / lib::si::ds::micro);
-
-    #endif
-
-    result.setSmoothed(false);
-
-    return result;
+    return DateTime(Clock::now());
 }
 
 //------------------------------------------------------------------------------
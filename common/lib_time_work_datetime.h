@@ -65,6 +65,8 @@ namespace work {
 ///         ;                                                                   
 ///     @endcode                                                                
 ///                                                                             
+///@version 2026-10-16  DHF     Added DateTime(NanoSeconds).                    
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-05-26  YBS     Added operator <<.                              
@@ -86,6 +88,8 @@ class DateTime : public lib::time::work::DateDeltaTimeBase
         DateTime() {}
         explicit DateTime(const std::string& str);
         explicit DateTime(double sec) { setSeconds(sec); }
+        explicit DateTime(lib::time::ds::NanoSeconds since_1970)
+            : lib::time::work::DateDeltaTimeBase(since_1970) {}
         DateTime(const DateTime& t) { tv_sec = t.tv_sec; tv_nsec = t.tv_nsec;}
         virtual ~DateTime() {}
 
@@ -176,6 +180,7 @@ class DateTime : public lib::time::work::DateDeltaTimeBase
         void truncateSecondsTo(uint64_t si_units);
 
         bool fromString(const std::string& str, bool strict = false);
+        bool fromPattern(const std::string& str, bool strict = false);
 
         inline static bool isLeapYear(int year)
         { return (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0); }
@@ -0,0 +1,450 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeformatter.cpp                                    
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_time_work_datetimeformatter.h"
+
+#include <limits>
+#include <string.h>
+
+namespace lib {
+namespace time {
+namespace work {
+
+static const int64_t s_SecondsPerDay(86400);
+static const int64_t s_NoDay(std::numeric_limits<int64_t>::min());
+
+static const char* const s_Months[] = {
+    "January", "February", "March", "April", "May", "June", "July"
+  , "August", "September", "October", "November", "December"
+};
+
+static const char* const s_Days[] = {
+    "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday"
+  , "Saturday"
+};
+
+//------------------------------------------------------------------------------
+//  Division (and so days and hours) rounding towards minus infinity, for       
+//  times before 1970.                                                          
+//------------------------------------------------------------------------------
+static int64_t floorDivide(int64_t value, int64_t divisor)
+{
+    const int64_t quotient(value / divisor);
+    return quotient * divisor > value ? quotient - 1 : quotient;
+}
+
+//------------------------------------------------------------------------------
+//  Write value as exactly digits digits (leading zeros).                       
+//------------------------------------------------------------------------------
+static void putDigits(char* out, uint64_t value, int digits)
+{
+    for (int d = digits - 1; d >= 0; --d) {
+        out[d] = char('0' + value % 10);
+        value /= 10;
+    }
+}
+
+//------------------------------------------------------------------------------
+//  Write value in decimal; return the number of characters.                    
+//------------------------------------------------------------------------------
+static size_t putInteger(char* out, int64_t value)
+{
+    char digits[24];
+    size_t n(0);
+    uint64_t magnitude(value < 0 ? 0 - uint64_t(value) : uint64_t(value));
+    do {
+        digits[n++] = char('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    size_t size(0);
+    if (value < 0) out[size++] = '-';
+    while (n > 0) out[size++] = digits[--n];
+    return size;
+}
+
+//------------------------------------------------------------------------------
+///@param   format      As DateTime::toString's format.                         
+///@param   location    GMT or LOCAL time.                                      
+//------------------------------------------------------------------------------
+DateTimeFormatter::DateTimeFormatter(
+    const std::string&          format
+  , DateTime::TIME_LOCATION     location
+) : m_Format(format)
+  , m_Location(location)
+  , m_Compiled(false)
+  , m_FieldCount(0)
+  , m_Day(s_NoDay)
+  , m_OffsetHour(s_NoDay)
+  , m_Offset(0)
+{
+    m_Compiled = compile();
+
+} // DateTimeFormatter::DateTimeFormatter() //
+
+//------------------------------------------------------------------------------
+//  The longest text of a date field (0 for the other fields).                  
+//------------------------------------------------------------------------------
+static size_t longestText(char code)
+{
+    switch (code) {
+        case 'Y':                               return 12;
+        case 'C': case 'y': case 'm': case 'd':
+        case 'e':                               return 2;
+        case 'j': case 'b': case 'h': case 'a': return 3;
+        case 'B': case 'A':                     return 9;
+        case 'u': case 'w':                     return 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+///@brief   Add a field; a date field gets its place in the day's text.         
+///@return  false if there are too many fields.                                 
+//------------------------------------------------------------------------------
+bool DateTimeFormatter::addField(char code, uint8_t width)
+{
+    if (m_FieldCount == MAXIMUM_FIELDS) return false;
+
+    size_t used(0);
+    for (size_t f = 0; f < m_FieldCount; ++f) {
+        const size_t longest(longestText(m_Fields[f].m_Code));
+        if (longest > 0 && m_Fields[f].m_Begin + longest > used) {
+            used = m_Fields[f].m_Begin + longest;
+        }
+    }
+    if (used + longestText(code) > MAXIMUM_DAY_TEXT) return false;
+
+    Field& field(m_Fields[m_FieldCount++]);
+    field.m_Code = code;
+    field.m_Width = width;
+    field.m_Begin = uint16_t(longestText(code) > 0 ? used : 0);
+    field.m_Size = 0;
+    return true;
+
+} // bool DateTimeFormatter::addField(char code, uint8_t width) //
+
+//------------------------------------------------------------------------------
+///@brief   Parse the format into fields.                                       
+///@return  false if the format has anything strftime does that this does not.  
+//------------------------------------------------------------------------------
+bool DateTimeFormatter::compile()
+{
+    const std::string& f(m_Format);
+    bool have_fraction(false);
+    size_t literal(0);          // Start of the literal text being gathered.
+
+    m_Literals.clear();
+    m_Literals.reserve(f.size());
+
+    //--------------------------------------------------------------------------
+    //  Close off the literal text gathered so far as a field.                  
+    //--------------------------------------------------------------------------
+    auto flush = [&]() -> bool {
+        if (m_Literals.size() == literal) return true;
+        if (m_FieldCount == MAXIMUM_FIELDS) return false;
+        Field& field(m_Fields[m_FieldCount++]);
+        field.m_Code = 0;
+        field.m_Width = 0;
+        field.m_Begin = uint16_t(literal);
+        field.m_Size = uint16_t(m_Literals.size() - literal);
+        literal = m_Literals.size();
+        return true;
+    };
+    auto add = [&](char code) -> bool { return flush() && addField(code); };
+    auto text = [&](const char* t) { m_Literals += t; };
+
+    for (size_t i = 0; i < f.size(); ++i) {
+        if (f[i] != '%') {
+            m_Literals += f[i];
+            continue;
+        }
+        if (++i == f.size()) return false;
+
+        bool ok(true);
+        switch (f[i]) {
+            case '%': {
+                //--------------------------------------------------------------
+                //  %%Nf is the (first) fraction; otherwise a percent sign.     
+                //--------------------------------------------------------------
+                size_t d(i + 1);
+                int width(0);
+                while (d < f.size() && f[d] >= '0' && f[d] <= '9') {
+                    width = width * 10 + (f[d] - '0');
+                    ++d;
+                }
+                if (!have_fraction && d > i + 1 && d < f.size() && f[d] == 'f') {
+                    have_fraction = true;
+                    if (width > 18) return false;
+                    ok = flush() && addField('f', uint8_t(width));
+                    i = d;
+                } else {
+                    m_Literals += '%';
+                }
+                break;
+            }
+
+            case 'F':
+                ok = add('Y'); text("-"); ok = ok && add('m'); text("-");
+                ok = ok && add('d');
+                break;
+            case 'D':
+                ok = add('m'); text("/"); ok = ok && add('d'); text("/");
+                ok = ok && add('y');
+                break;
+            case 'T':
+                ok = add('H'); text(":"); ok = ok && add('M'); text(":");
+                ok = ok && add('S');
+                break;
+            case 'R':
+                ok = add('H'); text(":"); ok = ok && add('M');
+                break;
+
+            case 'n':   m_Literals += '\n';   break;
+            case 't':   m_Literals += '\t';   break;
+
+            case 'Y': case 'C': case 'y': case 'm': case 'd': case 'e':
+            case 'j': case 'b': case 'h': case 'B': case 'a': case 'A':
+            case 'u': case 'w':
+            case 'H': case 'I': case 'M': case 'S': case 'p':
+                ok = add(f[i]);
+                break;
+
+            default:
+                return false;
+        }
+        if (!ok) return false;
+    }
+
+    return flush();
+
+} // bool DateTimeFormatter::compile() //
+
+//------------------------------------------------------------------------------
+///@brief   Convert days since 1970-01-01 to a (proleptic Gregorian) date.      
+///@note    H. Hinnant's civil_from_days:  integer arithmetic on 400 year eras. 
+//------------------------------------------------------------------------------
+void DateTimeFormatter::civilFromDays(
+    int64_t days
+  , int&    year
+  , int&    month
+  , int&    mday
+)
+{
+    days += 719468;
+    const int64_t era((days >= 0 ? days : days - 146096) / 146097);
+    const int64_t doe(days - era * 146097);                          // [0, 146096]
+    const int64_t yoe((doe - doe / 1460 + doe / 36524 - doe / 146096) / 365);
+    const int64_t doy(doe - (365 * yoe + yoe / 4 - yoe / 100));      // [0, 365]
+    const int64_t mp((5 * doy + 2) / 153);                           // [0, 11]
+
+    mday = int(doy - (153 * mp + 2) / 5 + 1);
+    month = int(mp < 10 ? mp + 3 : mp - 9);
+    year = int(yoe + era * 400 + (month <= 2 ? 1 : 0));
+
+} // void DateTimeFormatter::civilFromDays() //
+
+//------------------------------------------------------------------------------
+///@brief   Convert a date (month 1 to 12) to days since 1970-01-01.            
+//------------------------------------------------------------------------------
+int64_t DateTimeFormatter::daysFromCivil(int year, int month, int mday)
+{
+    const int64_t y(month <= 2 ? year - 1 : year);
+    const int64_t era((y >= 0 ? y : y - 399) / 400);
+    const int64_t yoe(y - era * 400);                                // [0, 399]
+    const int64_t doy((153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + mday - 1);
+    const int64_t doe(yoe * 365 + yoe / 4 - yoe / 100 + doy);        // [0, 146096]
+
+    return era * 146097 + doe - 719468;
+
+} // int64_t DateTimeFormatter::daysFromCivil() //
+
+//------------------------------------------------------------------------------
+///@brief   Render the date fields for day (days since 1970-01-01).             
+//------------------------------------------------------------------------------
+void DateTimeFormatter::renderDay(int64_t day)
+{
+    int year, month, mday;
+    civilFromDays(day, year, month, mday);
+    const int yday(int(day - daysFromCivil(year, 1, 1)) + 1);
+    const int wday(int(day - floorDivide(day + 4, 7) * 7 + 4));     // 0 = Sunday
+
+    for (size_t f = 0; f < m_FieldCount; ++f) {
+        Field& field(m_Fields[f]);
+        char* out(m_DayText + field.m_Begin);
+        size_t size(0);
+
+        switch (field.m_Code) {
+            case 'Y':   size = putInteger(out, year);                       break;
+            case 'C':   putDigits(out, uint64_t(year / 100) % 100, 2); size = 2;
+                        break;
+            case 'y':   putDigits(out, uint64_t(year % 100 + 100) % 100, 2);
+                        size = 2;
+                        break;
+            case 'm':   putDigits(out, month, 2);           size = 2;       break;
+            case 'd':   putDigits(out, mday, 2);            size = 2;       break;
+            case 'e':   putDigits(out, mday, 2);            size = 2;
+                        if (out[0] == '0') out[0] = ' ';
+                        break;
+            case 'j':   putDigits(out, yday, 3);            size = 3;       break;
+            case 'b':
+            case 'h':   memcpy(out, s_Months[month - 1], 3); size = 3;      break;
+            case 'B':   size = strlen(s_Months[month - 1]);
+                        memcpy(out, s_Months[month - 1], size);
+                        break;
+            case 'a':   memcpy(out, s_Days[wday], 3);       size = 3;       break;
+            case 'A':   size = strlen(s_Days[wday]);
+                        memcpy(out, s_Days[wday], size);
+                        break;
+            case 'u':   out[0] = char('0' + (wday == 0 ? 7 : wday)); size = 1;
+                        break;
+            case 'w':   out[0] = char('0' + wday);          size = 1;       break;
+            default:    continue;
+        }
+        field.m_Size = uint16_t(size);
+    }
+
+    m_Day = day;
+
+} // void DateTimeFormatter::renderDay(int64_t day) //
+
+//------------------------------------------------------------------------------
+///@brief   Format time into buffer.                                            
+///@copydetails format(int64_t, int32_t, char*, size_t)                         
+//------------------------------------------------------------------------------
+size_t DateTimeFormatter::format(const DateTime& time, char* buffer, size_t size)
+{
+    return format(int64_t(time.tv_sec), int32_t(time.tv_nsec), buffer, size);
+
+} // size_t DateTimeFormatter::format(const DateTime& time, ...) //
+
+//------------------------------------------------------------------------------
+///@brief   Format the time seconds (and nano_seconds) since 1970 into buffer.  
+///@return  The length of the whole text (as snprintf):  if that is size or     
+///         more, the text was cut short.  The text is nul terminated if size   
+///         is not 0.                                                           
+//------------------------------------------------------------------------------
+size_t DateTimeFormatter::format(
+    int64_t     seconds
+  , int32_t     nano_seconds
+  , char*       buffer
+  , size_t      size
+)
+{
+    size_t used(0);
+    auto put = [&](char const* text, size_t n) {
+        if (used < size) {
+            const size_t room(size - used);
+            memcpy(buffer + used, text, n < room ? n : room);
+        }
+        used += n;
+    };
+
+    if (!m_Compiled) {
+        DateTime time;
+        time.tv_sec = time_t(seconds);
+        time.tv_nsec = nano_seconds;
+        const std::string text(time.toString(m_Format, m_Location));
+        put(text.data(), text.size());
+    } else {
+        //----------------------------------------------------------------------
+        //  Local time:  the offset from UTC is looked up once an hour.         
+        //----------------------------------------------------------------------
+        if (m_Location == DateTime::LOCAL) {
+            const int64_t hour(floorDivide(seconds, 3600));
+            if (hour != m_OffsetHour) {
+                DateTime time;
+                time.tv_sec = time_t(seconds);
+                tm local;
+                time.localtime(local);
+                const int64_t local_seconds(
+                    daysFromCivil(
+                        local.tm_year + 1900, local.tm_mon + 1, local.tm_mday
+                    ) * s_SecondsPerDay
+                  + local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec
+                );
+                m_Offset = local_seconds - seconds;
+                m_OffsetHour = hour;
+            }
+            seconds += m_Offset;
+        }
+
+        const int64_t day(floorDivide(seconds, s_SecondsPerDay));
+        if (day != m_Day) renderDay(day);
+
+        const int second_of_day(int(seconds - day * s_SecondsPerDay));
+        const int hour(second_of_day / 3600);
+        char digits[24];
+
+        for (size_t f = 0; f < m_FieldCount; ++f) {
+            const Field& field(m_Fields[f]);
+            switch (field.m_Code) {
+                case 0:
+                    put(m_Literals.data() + field.m_Begin, field.m_Size);
+                    break;
+                case 'H':
+                    putDigits(digits, hour, 2);
+                    put(digits, 2);
+                    break;
+                case 'I':
+                    putDigits(digits, hour % 12 == 0 ? 12 : hour % 12, 2);
+                    put(digits, 2);
+                    break;
+                case 'M':
+                    putDigits(digits, second_of_day / 60 % 60, 2);
+                    put(digits, 2);
+                    break;
+                case 'S':
+                    putDigits(digits, second_of_day % 60, 2);
+                    put(digits, 2);
+                    break;
+                case 'p':
+                    put(hour < 12 ? "AM" : "PM", 2);
+                    break;
+                case 'f': {
+                    //----------------------------------------------------------
+                    //  Truncated to width digits (zeros added past 9).         
+                    //----------------------------------------------------------
+                    uint64_t value(nano_seconds < 0 ? 0 : nano_seconds);
+                    for (int w = field.m_Width; w < 9; ++w) value /= 10;
+                    for (int w = 9; w < field.m_Width; ++w) value *= 10;
+                    putDigits(digits, value, field.m_Width);
+                    put(digits, field.m_Width);
+                    break;
+                }
+                default:
+                    put(m_DayText + field.m_Begin, field.m_Size);
+                    break;
+            }
+        }
+    }
+
+    if (size > 0) buffer[used < size ? used : size - 1] = '\0';
+    return used;
+
+} // size_t DateTimeFormatter::format() //
+
+//------------------------------------------------------------------------------
+///@brief   Return time formatted (for when a string is wanted anyway).         
+//------------------------------------------------------------------------------
+std::string DateTimeFormatter::toString(const DateTime& time)
+{
+    char buffer[128];
+    const size_t n(format(time, buffer, sizeof(buffer)));
+    if (n < sizeof(buffer)) return std::string(buffer, n);
+
+    std::string result(n + 1, '\0');
+    format(time, &result[0], result.size());
+    result.resize(n);
+    return result;
+
+} // std::string DateTimeFormatter::toString(const DateTime& time) //
+
+} // namespace work
+} // namespace time
+} // namespace lib
@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeformatter.h                                      
+///@brief Holds lib::time::work::DateTimeFormatter, a DateTime::toString format 
+///       compiled once and written into the caller's buffer.                   
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_TIME_WORK_DATETIMEFORMATTER_H_FILE_GUARD
+#define LIB_TIME_WORK_DATETIMEFORMATTER_H_FILE_GUARD
+
+#include "lib_time_work_datetime.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace time {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Format DateTimes the way DateTime::toString does, without           
+///         strftime, gmtime or allocation.                                     
+///                                                                             
+///@par Purpose:                                                                
+///         DateTime::toString converts with gmtime (or localtime), formats     
+///         with strftime, scans the result for the fraction and builds         
+///         strings along the way; logs and exports do that for every record.   
+///         The formatter parses the format once into fields, works the date    
+///         out with integer arithmetic (days to civil date) and writes into    
+///         a buffer the caller supplies.                                       
+///                                                                             
+///@par Day Cache                                                               
+///         The date fields (%Y, %m, %d, %j, %b, %a, ...) are rendered once     
+///         per day and reused while the times formatted stay in that day,      
+///         which is how a recording's times arrive.  For LOCAL times the       
+///         offset from UTC is taken from localtime once per UTC hour.          
+///                                                                             
+///@par Formats                                                                 
+///         %Y %y %C %m %d %e %j %H %I %M %S %p %F %T %D %R %b %h %B %a %A      
+///         %u %w %n %t and %%, plus the %%Nf fractions of a second of          
+///         DateTime::toString (N digits, truncated).  A format with anything   
+///         else is handed to DateTime::toString (isCompiled() is false), so    
+///         the result is always the same.                                      
+///                                                                             
+///@par Thread Safety:  object                                                  
+///         The day cache changes as times are formatted:  one formatter per    
+///         thread.                                                             
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::time::work::DateTimeFormatter formatter("%F %H:%M:%S.%%6f");   
+///         char text[64];                                                      
+///         for (...) {                                                         
+///             size_t n(formatter.format(record.time(), text, sizeof(text)));  
+///             out.write(text, n);                                             
+///         }                                                                   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class DateTimeFormatter
+{
+    public:
+        explicit DateTimeFormatter(
+            const std::string&          format = "%F %H:%M:%S.%%6f"
+          , DateTime::TIME_LOCATION     location = DateTime::GMT
+        );
+
+        const std::string& formatString() const { return m_Format; }
+        DateTime::TIME_LOCATION location() const { return m_Location; }
+        bool isCompiled() const { return m_Compiled; }
+
+        size_t format(const DateTime& time, char* buffer, size_t size);
+        size_t format(
+            int64_t     seconds
+          , int32_t     nano_seconds
+          , char*       buffer
+          , size_t      size
+        );
+        std::string toString(const DateTime& time);
+
+        static void civilFromDays(int64_t days, int& year, int& month, int& mday);
+        static int64_t daysFromCivil(int year, int month, int mday);
+
+    private:
+        //----------------------------------------------------------------------
+        ///@brief   One piece of the format:  literal text or a field.          
+        //----------------------------------------------------------------------
+        struct Field
+        {
+            char        m_Code;         ///< 0 for literal text; 'f' fraction.
+            uint8_t     m_Width;        ///< Digits of a fraction.
+            uint16_t    m_Begin;        ///< Literal text in m_Literals;
+            uint16_t    m_Size;         ///< for a date field, its text in
+                                        ///< m_DayText.                         
+        };
+
+        enum { MAXIMUM_FIELDS = 96, MAXIMUM_DAY_TEXT = 160 };
+
+        bool compile();
+        bool addField(char code, uint8_t width = 0);
+        void renderDay(int64_t day);
+
+        std::string                 m_Format;
+        DateTime::TIME_LOCATION     m_Location;
+        bool                        m_Compiled;
+
+        Field                       m_Fields[MAXIMUM_FIELDS];
+        size_t                      m_FieldCount;
+        std::string                 m_Literals;
+
+        int64_t                     m_Day;          ///< Cached day (or none).
+        char                        m_DayText[MAXIMUM_DAY_TEXT];
+        int64_t                     m_OffsetHour;   ///< UTC hour of m_Offset.
+        int64_t                     m_Offset;       ///< Local - UTC seconds.
+
+}; // class DateTimeFormatter //
+
+} // namespace work
+} // namespace time
+} // namespace lib
+
+#endif // #ifndef LIB_TIME_WORK_DATETIMEFORMATTER_H_FILE_GUARD
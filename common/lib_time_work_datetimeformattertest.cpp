@@ -0,0 +1,229 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeformattertest.cpp                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_time_work_datetimeformattertest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_string.h"
+#include "lib_time_work_datetime.h"
+#include "lib_time_work_datetimeformatter.h"
+
+#include <chrono>
+#include <string.h>
+
+namespace lib {
+namespace time {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::time::work::test::DateTimeFormatterTest);
+
+//------------------------------------------------------------------------------
+//  Return a time seconds since 1970 (and nano_seconds).                        
+//------------------------------------------------------------------------------
+static DateTime at(int64_t seconds, long nano_seconds = 0)
+{
+    DateTime time;
+    time.tv_sec = time_t(seconds);
+    time.tv_nsec = nano_seconds;
+    return time;
+}
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+DateTimeFormatterTest::DateTimeFormatterTest()
+    : Test("lib::time::work::DateTimeFormatter")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    DateTimeFormatterTest object to copy.                       
+//------------------------------------------------------------------------------
+DateTimeFormatterTest::DateTimeFormatterTest(const DateTimeFormatterTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+DateTimeFormatterTest::~DateTimeFormatterTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+DateTimeFormatterTest& DateTimeFormatterTest::operator=(
+    const DateTimeFormatterTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // DateTimeFormatterTest::operator=(const DateTimeFormatterTest& that) //
+
+
+//------------------------------------------------------------------------------
+/// @brief Check the calendar arithmetic, then the formatter against            
+///        DateTime::toString.                                                  
+//------------------------------------------------------------------------------
+void DateTimeFormatterTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  Days to date and back, about 2000 years either side of 1970.            
+    //--------------------------------------------------------------------------
+    {
+        int wrong(0);
+        int year, month, mday;
+        int last_year(0), last_month(0), last_mday(0);
+        for (int64_t day = -730000; day <= 730000; ++day) {
+            DateTimeFormatter::civilFromDays(day, year, month, mday);
+            if (DateTimeFormatter::daysFromCivil(year, month, mday) != day) {
+                ++wrong;
+            }
+            if (day > -730000 && mday != last_mday + 1 && mday != 1) ++wrong;
+            if (mday == 1 && day > -730000) {
+                if (month != last_month % 12 + 1) ++wrong;
+                if (month == 1 && year != last_year + 1) ++wrong;
+            }
+            last_year = year;
+            last_month = month;
+            last_mday = mday;
+        }
+        TEST_IS_EQUAL(wrong, 0);
+
+        DateTimeFormatter::civilFromDays(0, year, month, mday);
+        TEST(year == 1970 && month == 1 && mday == 1);
+        TEST_IS_EQUAL(DateTimeFormatter::daysFromCivil(2000, 3, 1), 11017);
+        TEST_IS_EQUAL(DateTimeFormatter::daysFromCivil(1969, 12, 31), -1);
+    }
+
+    //--------------------------------------------------------------------------
+    //  The fraction (truncated) and the default format.                        
+    //--------------------------------------------------------------------------
+    DateTime t;
+    t.setYMD(2011, 0, 13, 16, 29, 42, 654321987);
+    {
+        DateTimeFormatter formatter;
+        TEST(formatter.isCompiled());
+        TEST_IS_EQUAL(formatter.toString(t), "2011-01-13 16:29:42.654321");
+        TEST_IS_EQUAL(formatter.toString(t), t.toString());
+    }
+    TEST_IS_EQUAL(DateTimeFormatter("%T.%%3f").toString(t), "16:29:42.654");
+    TEST_IS_EQUAL(DateTimeFormatter("%S.%%9f").toString(t), "42.654321987");
+    TEST_IS_EQUAL(DateTimeFormatter("%S.%%12f").toString(t), "42.654321987000");
+    TEST_IS_EQUAL(DateTimeFormatter("%%1f %%2f").toString(t), "6 %2f");
+    TEST_IS_EQUAL(DateTimeFormatter("100%% %%f").toString(t), "100% %f");
+    TEST_IS_EQUAL(
+        DateTimeFormatter("%a %A %b %h %B %j %e %u %w %C %y %D %I %p %R%n%t")
+            .toString(t)
+      , "Thu Thursday Jan Jan January 013 13 4 4 20 11 01/13/11 04 PM 16:29\n\t"
+    );
+
+    //--------------------------------------------------------------------------
+    //  Field for field the same as strftime, GMT and local, day after day      
+    //  (and across the day boundaries the cache keeps).                        
+    //--------------------------------------------------------------------------
+    {
+        const char* format(
+            "%Y %C %y %m %d %e %j %b %h %B %a %A %u %w "
+            "%H %I %M %S %p %F %T %D %R %%"
+        );
+        DateTimeFormatter gmt(format);
+        DateTimeFormatter local(format, DateTime::LOCAL);
+        TEST(gmt.isCompiled());
+
+        int wrong_gmt(0);
+        int wrong_local(0);
+        for (int64_t seconds = 0; seconds < int64_t(4102444800); seconds += 7777777) {
+            for (int64_t s = seconds - 3; s < seconds + 86400 * 2; s += 4999) {
+                if (gmt.toString(at(s)) != at(s).toString(format)) ++wrong_gmt;
+                if (local.toString(at(s)) != at(s).toString(format, DateTime::LOCAL)) {
+                    ++wrong_local;
+                }
+            }
+        }
+        TEST_IS_EQUAL(wrong_gmt, 0);
+        TEST_IS_EQUAL(wrong_local, 0);
+    }
+
+    //--------------------------------------------------------------------------
+    //  What it does not know is left to DateTime::toString.                    
+    //--------------------------------------------------------------------------
+    {
+        DateTimeFormatter formatter("%F %Z");
+        TEST(!formatter.isCompiled());
+        TEST_IS_EQUAL(formatter.toString(t), t.toString("%F %Z"));
+    }
+
+    //--------------------------------------------------------------------------
+    //  A buffer that is too small:  cut short, still terminated, and the       
+    //  length it needed returned.                                              
+    //--------------------------------------------------------------------------
+    {
+        DateTimeFormatter formatter("%F %T");
+        char buffer[8];
+        memset(buffer, 'x', sizeof(buffer));
+        TEST_IS_EQUAL(formatter.format(t, buffer, sizeof(buffer)), 19);
+        TEST_IS_EQUAL(std::string(buffer), "2011-01");
+        TEST_IS_EQUAL(formatter.format(t, buffer, 0), 19);
+    }
+
+} // void DateTimeFormatterTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure DateTime::toString against the formatter (a millisecond      
+///        apart, as a log or export sees them).                                
+//------------------------------------------------------------------------------
+void DateTimeFormatterTest::runTest3()
+{
+    const int count(1000000);
+    const int64_t first(1700000000);
+    size_t length(0);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        length += at(first + i / 1000, (i % 1000) * 1000000L).toString().size();
+    }
+    std::chrono::duration<double> strftime(std::chrono::steady_clock::now() - start);
+
+    DateTimeFormatter formatter;
+    char buffer[64];
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        length -= formatter.format(
+            first + i / 1000, int32_t((i % 1000) * 1000000), buffer, sizeof(buffer)
+        );
+    }
+    std::chrono::duration<double> compiled(std::chrono::steady_clock::now() - start);
+
+    TEST_IS_EQUAL(length, 0);
+
+    output(
+        vSummary
+      , lib::format(
+            "%d times:  DateTime::toString %6.1lf ns; formatter %6.1lf ns"
+          , count
+          , strftime.count() * 1e9 / count
+          , compiled.count() * 1e9 / count
+        )
+    );
+
+} // void DateTimeFormatterTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace time
+} // namespace lib
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeformattertest.h                                  
+//------------------------------------------------------------------------------
+#ifndef LIB_TIME_WORK_DATETIMEFORMATTERTEST_H
+#define LIB_TIME_WORK_DATETIMEFORMATTERTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace time {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: DateTimeFormatterTest                                            
+///                                                                             
+///@par Purpose:                                                                
+///         The DateTimeFormatterTest class provides the regression test for    
+///         the lib::time::work::DateTimeFormatter class.                       
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class DateTimeFormatterTest : public dev::test::work::Test {
+    public:
+        DateTimeFormatterTest();
+        DateTimeFormatterTest(const DateTimeFormatterTest& that);
+        virtual ~DateTimeFormatterTest();
+        DateTimeFormatterTest& operator=(const DateTimeFormatterTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class DateTimeFormatterTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace time
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_TIME_WORK_DATETIMEFORMATTERTEST_H //
@@ -0,0 +1,356 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeparser.cpp                                       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+
+#include "lib_time_work_datetimeparser.h"
+#include "lib_time_work_datetimeformatter.h"
+
+namespace lib {
+namespace time {
+namespace work {
+
+static const int64_t s_Nano(1000000000);
+
+//------------------------------------------------------------------------------
+//  The characters \s and \d match.                                             
+//------------------------------------------------------------------------------
+static bool isSpace(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+//------------------------------------------------------------------------------
+//  Read up to most digits (at least one); false if there are none.             
+//------------------------------------------------------------------------------
+static bool digits(
+    const char*&    p
+  , const char*     end
+  , size_t          most
+  , int64_t&        value
+  , size_t*         count = nullptr
+)
+{
+    const char* begin(p);
+    value = 0;
+    while (p != end && isDigit(*p) && size_t(p - begin) < most) {
+        value = value * 10 + (*p++ - '0');
+    }
+    if (count != nullptr) *count = size_t(p - begin);
+    return p != begin;
+}
+
+//------------------------------------------------------------------------------
+//  DeltaTime::fromString's formats (all of the text):                          
+//      d[ :]h:m:s[.f]  d h:m  d h  h:m:s[.f]  m:s[.f]  s[.f]  .f               
+//  where d, h and s of the first number may have any number of digits and      
+//  the rest one or two.                                                        
+//------------------------------------------------------------------------------
+static bool scanDelta(
+    const char* p
+  , const char* end
+  , int64_t&    seconds
+  , int64_t&    nano_seconds
+)
+{
+    int64_t n[4] = { 0, 0, 0, 0 };
+    char separator[3] = { 0, 0, 0 };
+    size_t count(0);
+
+    //--------------------------------------------------------------------------
+    //  The first number (up to 9 digits here; more go to the patterns).        
+    //--------------------------------------------------------------------------
+    if (p != end && isDigit(*p)) {
+        size_t width(0);
+        digits(p, end, 10, n[0], &width);
+        if (width > 9) return false;
+        count = 1;
+
+        while (count < 4 && p != end && (*p == ' ' || *p == ':')) {
+            separator[count - 1] = *p++;
+            if (!digits(p, end, 2, n[count])) return false;
+            ++count;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    //  Which format:  a space only after the first number, and no fraction     
+    //  after d h or d h:m.                                                     
+    //--------------------------------------------------------------------------
+    const bool spaced(separator[0] == ' ');
+    if (separator[1] == ' ' || separator[2] == ' ') return false;
+
+    int64_t days(0), hours(0), minutes(0), secs(0);
+    bool fraction_allowed(true);
+    switch (count) {
+        case 0:
+            if (p == end || *p != '.') return false;
+            break;
+        case 1:
+            secs = n[0];
+            break;
+        case 2:
+            if (spaced) {
+                days = n[0]; hours = n[1]; fraction_allowed = false;
+            } else {
+                minutes = n[0]; secs = n[1];
+            }
+            break;
+        case 3:
+            if (spaced) {
+                days = n[0]; hours = n[1]; minutes = n[2]; fraction_allowed = false;
+            } else {
+                hours = n[0]; minutes = n[1]; secs = n[2];
+            }
+            break;
+        case 4:
+            days = n[0]; hours = n[1]; minutes = n[2]; secs = n[3];
+            break;
+    }
+
+    //--------------------------------------------------------------------------
+    //  The fraction:  nine digits, rounded on the tenth.                       
+    //--------------------------------------------------------------------------
+    int64_t nano(0);
+    if (p != end) {
+        if (*p != '.' || !fraction_allowed) return false;
+        ++p;
+
+        int64_t scale(s_Nano);
+        size_t width(0);
+        while (p != end && isDigit(*p)) {
+            if (width < 9) {
+                scale /= 10;
+                nano += (*p - '0') * scale;
+            } else if (width == 9 && *p >= '5') {
+                ++nano;
+            }
+            ++width;
+            ++p;
+        }
+        if (p != end) return false;
+    }
+
+    //--------------------------------------------------------------------------
+    //  DeltaTime adds these up in 32 bits; leave the overflows to it.          
+    //--------------------------------------------------------------------------
+    seconds = days * 86400 + hours * 3600 + minutes * 60 + secs;
+    if (seconds >= (int64_t(1) << 32)) return false;
+
+    nano_seconds = nano;
+    return true;
+
+} // static bool scanDelta() //
+
+//------------------------------------------------------------------------------
+//  The time after the date:  nothing, or (after one space or colon) a delta.   
+//------------------------------------------------------------------------------
+static bool scanRemainder(
+    const char* p
+  , const char* end
+  , int64_t&    seconds
+  , int64_t&    nano_seconds
+)
+{
+    seconds = 0;
+    nano_seconds = 0;
+    if (p == end) return true;
+    if (*p == ' ' || *p == ':') ++p;
+    return scanDelta(p, end, seconds, nano_seconds);
+
+} // static bool scanRemainder() //
+
+//------------------------------------------------------------------------------
+//  Years as DateTime::fromString takes them:  00-69 are 2000-2069 and 70-99    
+//  are 1970-1999 (whatever the number of digits).                              
+//------------------------------------------------------------------------------
+static int fullYear(int64_t year)
+{
+    if (year < 70) year += 2000;
+    if (year < 100) year += 1900;
+    return int(year);
+}
+
+//------------------------------------------------------------------------------
+//  Check a date the way DateTime::fromString's strict mode does.               
+//------------------------------------------------------------------------------
+static bool strictlyValid(int year, int month, int day, const char* year_text)
+{
+    if (year < 1970 || year > 2500) return false;
+    if (month < 1 || month > 12) return false;
+    if (year_text[0] == '0') return false;
+
+    int length(DateTime::monthLength(uint32_t(month - 1)));
+    if (month == 2 && DateTime::isLeapYear(year)) length = 29;
+    return day > 0 && day <= length;
+}
+
+//------------------------------------------------------------------------------
+///@brief   Parse text (all of it) as DateTime::fromString would, remembering   
+///         the format for next time.                                           
+///@return  As DateTime::fromString.                                            
+//------------------------------------------------------------------------------
+bool DateTimeParser::parse(
+    const char* text
+  , size_t      size
+  , DateTime&   time
+  , bool        strict
+)
+{
+    if (
+        m_Last != Format::none
+     && m_Last != Format::pattern
+     && scan(m_Last, text, size, time, strict)
+    ) {
+        return true;
+    }
+
+    Format format;
+    if (scan(text, size, time, strict, format)) {
+        m_Last = format;
+        return true;
+    }
+
+    m_Last = Format::pattern;
+    return time.fromPattern(std::string(text, size), strict);
+
+} // bool DateTimeParser::parse() //
+
+//------------------------------------------------------------------------------
+///@copydoc parse(const char*, size_t, DateTime&, bool)                         
+//------------------------------------------------------------------------------
+bool DateTimeParser::parse(const std::string& text, DateTime& time, bool strict)
+{
+    return parse(text.data(), text.size(), time, strict);
+
+} // bool DateTimeParser::parse(const std::string& text, ...) //
+
+//------------------------------------------------------------------------------
+///@brief   Work out which of the scanner's formats text is in and scan it.     
+///@return  false if it is in none of them (or is not valid in it):  it is for  
+///         DateTime::fromString's patterns to say.  time is only changed if    
+///         true.                                                               
+//------------------------------------------------------------------------------
+bool DateTimeParser::scan(
+    const char* text
+  , size_t      size
+  , DateTime&   time
+  , bool        strict
+  , Format&     format
+)
+{
+    const char* p(text);
+    const char* end(text + size);
+    while (p != end && isSpace(*p)) ++p;
+
+    int64_t value;
+    size_t count(0);
+    digits(p, end, 5, value, &count);
+    const char next(p == end ? 0 : *p);
+
+    if (count == 4 && (next == '-' || next == '/')) {
+        format = Format::yearMonthDay;
+    } else if (count == 2 && (next == '-' || next == '/')) {
+        format = Format::monthDayYear;
+    } else if (count >= 1 && count <= 3 && (next == 0 || next == ':' || next == ' ')) {
+        format = Format::dayOfYear;
+    } else {
+        format = Format::pattern;
+        return false;
+    }
+
+    return scan(format, text, size, time, strict);
+
+} // bool DateTimeParser::scan(const char* text, ...) //
+
+//------------------------------------------------------------------------------
+///@brief   Scan text in the given format.                                      
+///@copydetails scan(const char*, size_t, DateTime&, bool, Format&)             
+//------------------------------------------------------------------------------
+bool DateTimeParser::scan(
+    Format      format
+  , const char* text
+  , size_t      size
+  , DateTime&   time
+  , bool        strict
+)
+{
+    const char* p(text);
+    const char* end(text + size);
+    while (p != end && isSpace(*p)) ++p;
+
+    int64_t year(0), month(0), day(0);
+    const char* year_text(nullptr);
+    size_t count(0);
+
+    switch (format) {
+        case Format::yearMonthDay:
+            year_text = p;
+            if (!digits(p, end, 4, year, &count) || count != 4) return false;
+            if (p == end || (*p != '-' && *p != '/')) return false;
+            ++p;
+            if (!digits(p, end, 2, month, &count) || count != 2) return false;
+            if (p == end || (*p != '-' && *p != '/')) return false;
+            ++p;
+            if (!digits(p, end, 2, day, &count) || count != 2) return false;
+            break;
+
+        case Format::monthDayYear:
+            if (!digits(p, end, 2, month, &count) || count != 2) return false;
+            if (p == end || (*p != '-' && *p != '/')) return false;
+            ++p;
+            if (!digits(p, end, 2, day, &count) || count != 2) return false;
+            if (p == end || (*p != '-' && *p != '/')) return false;
+            ++p;
+            year_text = p;
+            if (!digits(p, end, 4, year, &count) || count != 4) return false;
+            break;
+
+        case Format::dayOfYear:
+            if (!digits(p, end, 3, day, &count)) return false;
+            if (p != end && *p != ':' && *p != ' ') return false;
+            while (p != end && *p == ':') ++p;
+            break;
+
+        default:
+            return false;
+    }
+
+    int64_t seconds, nano_seconds;
+    if (!scanRemainder(p, end, seconds, nano_seconds)) return false;
+
+    //--------------------------------------------------------------------------
+    //  The date:  a day of year is in the baseline year (1970).                
+    //--------------------------------------------------------------------------
+    int64_t days;
+    if (format == Format::dayOfYear) {
+        if (strict && (day < 1 || day > 365)) return false;
+        days = day - 1;
+    } else {
+        const int full_year(fullYear(year));
+        if (strict && !strictlyValid(full_year, int(month), int(day), year_text)) {
+            return false;
+        }
+        if (month < 1 || month > 12) return false;
+        days = DateTimeFormatter::daysFromCivil(full_year, int(month), 1) + day - 1;
+    }
+
+    time.tv_sec = time_t(days * 86400 + seconds);
+    time.tv_nsec = long(nano_seconds);
+    time.adjust();
+    time.setSmoothed(false);
+    return true;
+
+} // bool DateTimeParser::scan(Format format, ...) //
+
+} // namespace work
+} // namespace time
+} // namespace lib
@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeparser.h                                         
+///@brief Holds lib::time::work::DateTimeParser, DateTime::fromString without   
+///       the regular expressions for the common formats.                       
+///@par Classification:  UNCLASSIFIED, OPEN SOURCE                              
+//------------------------------------------------------------------------------
+
+#ifndef LIB_TIME_WORK_DATETIMEPARSER_H_FILE_GUARD
+#define LIB_TIME_WORK_DATETIMEPARSER_H_FILE_GUARD
+
+#include "lib_time_work_datetime.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace lib {
+namespace time {
+namespace work {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@brief   Parse date times as DateTime::fromString does, scanning the common  
+///         formats by hand and remembering which one the last text was in.     
+///                                                                             
+///@par Purpose:                                                                
+///         DateTime::fromString matched each text against up to five           
+///         regular expressions for the date and eleven more for the time;      
+///         importing a large CSV or log file spent most of its time there.     
+///         The scanner handles these without them:                             
+///             -   yyyy-mm-dd[ time] and yyyy/mm/dd[ time]                     
+///             -   mm-dd-yyyy[ time] and mm/dd/yyyy[ time]                     
+///             -   ddd[:time] and ddd[ time] (day of year)                     
+///         where time is any of DeltaTime's formats (hh:mm:ss.ffffff, ...).    
+///         Anything else (ddmmmyyyy, "mmm dd, yyyy", odd spacing) goes to the  
+///         regular expressions, so the result is always that of                
+///         DateTime::fromString.                                               
+///                                                                             
+///@par Format Cache                                                            
+///         A file's times are all in one format:  the parser tries the         
+///         format of the last text it parsed first.                            
+///                                                                             
+///@par Thread Safety:  object                                                  
+///                                                                             
+///@par Expected Usage:                                                         
+///     @code                                                                   
+///         lib::time::work::DateTimeParser parser;                             
+///         lib::time::work::DateTime time;                                     
+///         while (std::getline(csv, line)) {                                   
+///             if (!parser.parse(line.substr(0, comma), time)) ...             
+///         }                                                                   
+///     @endcode                                                                
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class DateTimeParser
+{
+    public:
+        //----------------------------------------------------------------------
+        ///@brief   The formats the scanner knows.                              
+        //----------------------------------------------------------------------
+        enum class Format {
+            none            ///< Nothing parsed yet.
+          , yearMonthDay    ///< yyyy-mm-dd
+          , monthDayYear    ///< mm-dd-yyyy
+          , dayOfYear       ///< ddd
+          , pattern         ///< Left to the regular expressions.
+        };
+
+        DateTimeParser() : m_Last(Format::none) { }
+
+        bool parse(const std::string& text, DateTime& time, bool strict = false);
+        bool parse(
+            const char* text
+          , size_t      size
+          , DateTime&   time
+          , bool        strict = false
+        );
+
+        Format lastFormat() const { return m_Last; }
+
+        static bool scan(
+            const char* text
+          , size_t      size
+          , DateTime&   time
+          , bool        strict
+          , Format&     format
+        );
+        static bool scan(
+            Format      format
+          , const char* text
+          , size_t      size
+          , DateTime&   time
+          , bool        strict
+        );
+
+    private:
+        Format  m_Last;
+
+}; // class DateTimeParser //
+
+} // namespace work
+} // namespace time
+} // namespace lib
+
+#endif // #ifndef LIB_TIME_WORK_DATETIMEPARSER_H_FILE_GUARD
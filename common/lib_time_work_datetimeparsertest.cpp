@@ -0,0 +1,267 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeparsertest.cpp                                   
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+//------------------------------------------------------------------------------
+#include "lib_time_work_datetimeparsertest.h"
+#include "dev_test_work.h"
+#include "dev_test_work_test.h"
+#include "lib_string.h"
+#include "lib_time_work_datetime.h"
+#include "lib_time_work_datetimeparser.h"
+
+#include <chrono>
+#include <vector>
+
+namespace lib {
+namespace time {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+//  Register the test class for the dev_test_classes.                           
+//------------------------------------------------------------------------------
+TEST_REGISTER(lib::time::work::test::DateTimeParserTest);
+
+//------------------------------------------------------------------------------
+/// @brief Default constructor                                                  
+//------------------------------------------------------------------------------
+DateTimeParserTest::DateTimeParserTest()
+    : Test("lib::time::work::DateTimeParser")
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+//------------------------------------------------------------------------------
+/// @brief Copy constructor                                                     
+/// @param  that    DateTimeParserTest object to copy.                          
+//------------------------------------------------------------------------------
+DateTimeParserTest::DateTimeParserTest(const DateTimeParserTest& that)
+    : Test(that)
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Destructor                                                           
+//------------------------------------------------------------------------------
+DateTimeParserTest::~DateTimeParserTest()
+{
+    //  This space intentionally left mostly blank.                             
+}
+
+
+//------------------------------------------------------------------------------
+/// @brief Assignment operator.                                                 
+//------------------------------------------------------------------------------
+DateTimeParserTest& DateTimeParserTest::operator=(
+    const DateTimeParserTest& that
+)
+{
+    Test::operator=(that);
+    return *this;
+} // DateTimeParserTest::operator=(const DateTimeParserTest& that) //
+
+
+//------------------------------------------------------------------------------
+//  What a parse did:  the result and the time, or that it threw.               
+//------------------------------------------------------------------------------
+static std::string outcome(bool result, const DateTime& time)
+{
+    return lib::format(
+        "%d %lld.%09ld", int(result), (long long)time.tv_sec, long(time.tv_nsec)
+    );
+}
+
+//------------------------------------------------------------------------------
+//  Date times in the scanner's formats (valid and not), and in the ones it     
+//  leaves to the regular expressions.                                          
+//------------------------------------------------------------------------------
+static std::vector<std::string> texts()
+{
+    const char* years[] = {
+        "1969", "1970", "2000", "2011", "2024", "2100", "2500", "2501", "0070",
+        "0000", "0069", "9999"
+    };
+    const char* months[] = { "00", "01", "02", "12", "13" };
+    const char* days[] = { "00", "01", "28", "29", "30", "31", "32" };
+    const char* separators[] = { "-", "/" };
+    const char* times[] = {
+        "", " 16:29:42", " 16:29:42.654321", ":16:29:42.5", " 1 02:03:04",
+        " 1:02:03:04.25", " 12:34", " 12:34.5", " 7", " .5", " 1 02",
+        " 1 02:03", " 1 02.5", "  16:29", " 16:29:42.1234567895",
+        " 16:29:42.1234567894", " 25:61:61", " 16 29:42", " 16:29:", " 1234567890",
+        " 49710 06:28:16", " 49710 06:28:15", "T16:29", " 16:29:42 "
+    };
+
+    std::vector<std::string> result;
+    for (auto year : years) {
+        for (auto month : months) {
+            for (auto day : days) {
+                for (auto separator : separators) {
+                    for (auto time : times) {
+                        result.push_back(
+                            std::string(year) + separator + month + separator + day + time
+                        );
+                        result.push_back(
+                            std::string(month) + separator + day + separator + year + time
+                        );
+                    }
+                }
+            }
+        }
+    }
+
+    const char* days_of_year[] = { "0", "1", "013", "365", "366", "999", "1234" };
+    const char* after[] = { "", ":", "::", " ", ":16:29:42.5", "::16:29", " 16:29", "x" };
+    for (auto day : days_of_year) {
+        for (auto time : times) {
+            result.push_back(std::string(day) + time);
+        }
+        for (auto text : after) {
+            result.push_back(std::string(day) + text);
+        }
+    }
+
+    const char* others[] = {
+        "", " ", "abc", "13Jan2011", "13Jan2011 16:29:42.5", "Jan 13, 2011",
+        " 2011-01-13", "\t2011-01-13 16:29", "2011-1-13", "2011-01-1",
+        "11-01-13", "2011-01-13\n", "2011.01.13", "01-13-11", "2011-01-13 16:29:42.",
+        "2011-01-13 .", "20110-01-13"
+    };
+    for (auto text : others) result.push_back(text);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// @brief Check the parser and DateTime::fromString against the regular        
+///        expressions they replace, then the format cache.                     
+//------------------------------------------------------------------------------
+void DateTimeParserTest::runTest()
+{
+    //--------------------------------------------------------------------------
+    //  The same result and time (or the same exception) as the patterns,       
+    //  strict or not.                                                          
+    //--------------------------------------------------------------------------
+    const std::vector<std::string> all(texts());
+    int wrong(0);
+    int scanned(0);
+    for (int strict = 0; strict < 2; ++strict) {
+        DateTimeParser parser;
+        for (const auto& text : all) {
+            std::string expected, from_string, parsed;
+            DateTime a, b, c;
+            try { expected = outcome(a.fromPattern(text, strict), a); }
+            catch (...) { expected = "throw"; }
+            try { from_string = outcome(b.fromString(text, strict), b); }
+            catch (...) { from_string = "throw"; }
+            try { parsed = outcome(parser.parse(text, c, strict), c); }
+            catch (...) { parsed = "throw"; }
+
+            if (expected != from_string || expected != parsed) {
+                ++wrong;
+                output(
+                    vSummary
+                  , lib::format(
+                        "\"%s\" strict %d: %s, fromString %s, parser %s"
+                      , text.c_str()
+                      , strict
+                      , expected.c_str()
+                      , from_string.c_str()
+                      , parsed.c_str()
+                    )
+                );
+            }
+
+            DateTimeParser::Format format;
+            DateTime d;
+            if (DateTimeParser::scan(text.data(), text.size(), d, strict, format)) {
+                ++scanned;
+            }
+        }
+    }
+    TEST_IS_EQUAL(wrong, 0);
+    TEST(scanned > int(all.size()) / 2);
+
+    //--------------------------------------------------------------------------
+    //  Some values, to be sure the parser is not just agreeing with itself.    
+    //--------------------------------------------------------------------------
+    DateTimeParser parser;
+    DateTime t, expected;
+    expected.setYMD(2011, 0, 13, 16, 29, 42, 654321000);
+    TEST(parser.parse("2011-01-13 16:29:42.654321", t));
+    TEST(t == expected);
+    TEST(parser.lastFormat() == DateTimeParser::Format::yearMonthDay);
+
+    TEST(parser.parse("01/13/2011 16:29:42.654321", t, true));
+    TEST(t == expected);
+    TEST(parser.lastFormat() == DateTimeParser::Format::monthDayYear);
+
+    TEST(parser.parse("013:16:29:42", t));
+    TEST_IS_EQUAL(t.tv_sec, 12 * 86400 + 16 * 3600 + 29 * 60 + 42);
+    TEST(parser.lastFormat() == DateTimeParser::Format::dayOfYear);
+
+    TEST(parser.parse("13Jan2011 16:29:42.654321", t));
+    TEST(t == expected);
+    TEST(parser.lastFormat() == DateTimeParser::Format::pattern);
+
+    TEST(!parser.parse("2011-02-29", t, true));
+    TEST(parser.parse("2012-02-29", t, true));
+
+} // void DateTimeParserTest::runTest() //
+
+//------------------------------------------------------------------------------
+/// @brief Measure the regular expressions against the parser (a millisecond    
+///        apart, as a CSV or log import sees them).                            
+//------------------------------------------------------------------------------
+void DateTimeParserTest::runTest3()
+{
+    const int count(100000);
+    std::vector<std::string> lines;
+    lines.reserve(count);
+    DateTime time;
+    time.setYMD(2023, 10, 14, 22, 13, 20, 0);
+    for (int i = 0; i < count; ++i) {
+        lines.push_back(time.toString());
+        time.tv_nsec += 1000000;
+        time.adjust();
+    }
+
+    int64_t sum(0);
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& line : lines) {
+        DateTime t;
+        t.fromPattern(line);
+        sum += t.tv_sec + t.tv_nsec;
+    }
+    std::chrono::duration<double> pattern(std::chrono::steady_clock::now() - start);
+
+    DateTimeParser parser;
+    start = std::chrono::steady_clock::now();
+    for (const auto& line : lines) {
+        DateTime t;
+        parser.parse(line, t);
+        sum -= t.tv_sec + t.tv_nsec;
+    }
+    std::chrono::duration<double> scanned(std::chrono::steady_clock::now() - start);
+
+    TEST_IS_EQUAL(sum, 0);
+
+    output(
+        vSummary
+      , lib::format(
+            "%d times:  regular expressions %8.1lf ns; parser %6.1lf ns"
+          , count
+          , pattern.count() * 1e9 / count
+          , scanned.count() * 1e9 / count
+        )
+    );
+
+} // void DateTimeParserTest::runTest3() //
+
+} // namespace test
+} // namespace work
+} // namespace time
+} // namespace lib
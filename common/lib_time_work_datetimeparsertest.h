@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+///@file lib_time_work_datetimeparsertest.h                                     
+//------------------------------------------------------------------------------
+#ifndef LIB_TIME_WORK_DATETIMEPARSERTEST_H
+#define LIB_TIME_WORK_DATETIMEPARSERTEST_H
+
+#include "dev_test_work_test.h"
+
+namespace lib {
+namespace time {
+namespace work {
+namespace test {
+
+//------------------------------------------------------------------------------
+///                                                                             
+///@par Class: DateTimeParserTest                                               
+///                                                                             
+///@par Purpose:                                                                
+///         The DateTimeParserTest class provides the regression test for       
+///         the lib::time::work::DateTimeParser class.                          
+///                                                                             
+///@version 2026-10-16  DHF     File creation                                   
+///                                                                             
+//------------------------------------------------------------------------------
+class DateTimeParserTest : public dev::test::work::Test {
+    public:
+        DateTimeParserTest();
+        DateTimeParserTest(const DateTimeParserTest& that);
+        virtual ~DateTimeParserTest();
+        DateTimeParserTest& operator=(const DateTimeParserTest& that);
+
+    protected:
+        void runTest();
+        void runTest3();
+
+    private:
+
+}; //  class DateTimeParserTest : public dev::test::work::Test //
+
+} // namespace test
+} // namespace work
+} // namespace time
+} // namespace lib
+
+
+
+#endif // #ifndef LIB_TIME_WORK_DATETIMEPARSERTEST_H //
@@ -27,6 +27,8 @@ namespace work {
 ///         stopTime = startTime + delta;                                       
 ///     @endcode                                                                
 ///                                                                             
+///@version 2026-10-16  DHF     Added DeltaTime(NanoSeconds).                   
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2017-03-20  DHF     Added operator+=, operator-=                    
@@ -48,6 +50,8 @@ class DeltaTime : public lib::time::work::DateDeltaTimeBase
         DeltaTime(const DeltaTime& dt) : lib::time::work::DateDeltaTimeBase(dt) {}
         explicit DeltaTime(const std::string& time);
         explicit DeltaTime(double sec) { setSeconds(sec); }
+        explicit DeltaTime(lib::time::ds::NanoSeconds delta)
+            : lib::time::work::DateDeltaTimeBase(delta) {}
         operator double() const;
 
         std::string toString(bool stopAtSeconds = false) const;
@@ -33,6 +33,10 @@
 ///                                                                   -- unknown
 ///                                                                             
 ///                                                                             
+///@version 2026-10-16  DHF     Timed with Clock::elapsed() (monotonic, and as  
+///                             cheap as the clock source allows) rather than   
+///                             DateTime::now().                                
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2015-08-02  DHF     DeltaTime::seconds renamed inSeconds.           
@@ -42,6 +46,7 @@
 //------------------------------------------------------------------------------
 
 #include "lib_time_work_walltime.h"
+#include "lib_time_work_clock.h"
 #include "lib_time_work_deltatime.h"
 
 namespace lib {
@@ -52,7 +57,7 @@ namespace work {
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 WallTime::WallTime()
-    : m_StartTime(lib::time::work::DateTime::now())
+    : m_StartTime(lib::time::work::Clock::elapsed())
 {
 } // WallTime::WallTime(const std::string& message) //
 
@@ -74,7 +79,9 @@ void WallTime::write(
   , bool performReset
 )
 {
-    lib::time::work::DeltaTime diff(lib::time::work::DateTime::now() - m_StartTime);
+    lib::time::work::DeltaTime diff(
+        lib::time::work::Clock::elapsed() - m_StartTime
+    );
 
     out << diff.toString() << " " << message << std::endl;
 
@@ -86,7 +93,7 @@ void WallTime::write(
 //------------------------------------------------------------------------------
 void WallTime::reset()
 {
-    m_StartTime = lib::time::work::DateTime::now();
+    m_StartTime = lib::time::work::Clock::elapsed();
 }
 
 
@@ -94,7 +101,9 @@ void WallTime::reset()
 //------------------------------------------------------------------------------
 std::string WallTime::toString() const
 {
-    return (lib::time::work::DateTime::now() - m_StartTime).toString();
+    return lib::time::work::DeltaTime(
+        lib::time::work::Clock::elapsed() - m_StartTime
+    ).toString();
 }
 
 
@@ -102,7 +111,7 @@ std::string WallTime::toString() const
 //------------------------------------------------------------------------------
 double WallTime::seconds() const
 {
-    return (lib::time::work::DateTime::now() - m_StartTime).inSeconds();
+    return (lib::time::work::Clock::elapsed() - m_StartTime).inSeconds();
 }
 
 } // namespace work //
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <string>
 
+#include "lib_time_ds_nanoseconds.h"
 #include "lib_time_work_datetime.h"
 
 namespace lib {
@@ -52,6 +53,8 @@ namespace work {
 ///                       9/11/01                                               
 ///                                                                             
 ///                                                                             
+///@version 2026-10-16  DHF     Timed with Clock::elapsed().                    
+///                                                                             
 ///@version 2020-05-04  DHF     Open sourced                                    
 ///                                                                             
 ///@version 2011-01-24  DHF         File creation                               
@@ -87,7 +90,7 @@ class WallTime
         WallTime(const WallTime& that);
         WallTime& operator=(const WallTime& that);
 
-        lib::time::work::DateTime   m_StartTime;
+        lib::time::ds::NanoSeconds  m_StartTime;
 
 }; // class WallTime //
 